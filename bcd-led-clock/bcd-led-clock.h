@@ -9,6 +9,7 @@
 #include "bcd_led_clock/matrix_pixel.h"
 #include "bcd_led_clock/effect_bleed.h"
 #include "bcd_led_clock/effect_flicker.h"
+#include "time-snapshot.h"
 
 /**
  * Colors to display.
@@ -45,22 +46,10 @@ std::vector<Effect*> allEffects = {
 #define BIT_TO_INT(x) (x == 0) ? ((int) 0) : ((int) 1)
 
 /**
- * Convert an integer to BCD, in four bit groups.
- *    <10         will return one four bit group.
- *    =>10, <=99  will return two four bit groups.
- *
- * I got this algorithm from:
- *   https://stackoverflow.com/questions/48291111/converting-from-decimal-to-bcd
+ * The time, sampled once per frame. Its BCD digits are only
+ * recomputed when the second (or minute) changes.
  */
-std::vector<std::bitset<4>> dec_to_bin(int n) {
-    std::vector<std::bitset<4>> repr;
-    while(n > 0){
-        repr.push_back(std::bitset<4>(n % 10));
-        n /= 10;
-    }
-    std::reverse(repr.begin(), repr.end());
-    return repr;
-}
+TimeSnapshot timeSnapshot;
 
 /**
  * The led strip positions for the hours, minutes, and seconds columns.
@@ -131,20 +120,19 @@ void setBCDLEDs(esphome::light::AddressableLight &strip, std::bitset<4> &bits, s
 }
 
 /**
- * Set the LED color for one group (hour, minute, or second).
+ * Set the LED color for one group (hour, minute, or second) from its
+ * two BCD digits, tens in the high nibble (see TimeSnapshot::toBcd()).
+ * A zero digit lights nothing, so 5 only lights the ones column.
  */
 void setLEDGroup(
         esphome::light::AddressableLight &strip, 
-        std::vector<std::bitset<4>> &bcd, 
+        uint8_t bcd, 
         std::vector<std::vector<int>> &ledStripColums,
         Color &color) {
-    if (bcd.size() == 1) {
-        setBCDLEDs(strip, bcd[0], ledStripColums[1], color);
-    }
-    else if (bcd.size() == 2) {
-        setBCDLEDs(strip, bcd[0], ledStripColums[0], color);
-        setBCDLEDs(strip, bcd[1], ledStripColums[1], color);
-    }
+    std::bitset<4> tens(bcd >> 4);
+    std::bitset<4> ones(bcd & 0x0F);
+    setBCDLEDs(strip, tens, ledStripColums[0], color);
+    setBCDLEDs(strip, ones, ledStripColums[1], color);
 }
 
 /**
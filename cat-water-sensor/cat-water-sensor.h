@@ -1,10 +1,21 @@
 #include <display-panel.h>
+#include "panel-text.h"
+#include "panel-layout.h"
+#include "ssd1306-pages.h"
+#include "frame-scheduler.h"
+#include "time-snapshot.h"
 
 // The display/lcd we are working with. Defined in initializePanels().
-esphome::display::DisplayBuffer* lcd = NULL;
+esphome::display::Display* lcd = NULL;
 
-// For sprintf calls.
-char buffer[25];
+// The OLED. Only the changed parts of the screen are sent to it.
+// See ssd1306-pages.h.
+Ssd1306Pages oled;
+
+// Renders a frame only when the screen can change. See frame-scheduler.h.
+FrameScheduler frameScheduler;
+// The clock, sampled once per frame. See time-snapshot.h.
+TimeSnapshot timeSnapshot;
 
 #define TIME_WIDTH 92
 #define TIME_HEIGHT 37
@@ -20,13 +31,53 @@ char buffer[25];
 
 #define TOTAL_WIDTH (TIME_WIDTH + COL_2_WIDTH)
 
-// The Panels used by this app
-DisplayPanel timePanel(0, 0, TIME_WIDTH, TIME_HEIGHT);
-DisplayPanel alarmPanel(0, TIME_HEIGHT, ALARM_WIDTH, ALARM_HEIGHT);
-DisplayPanel datePanel(0, TIME_HEIGHT + ALARM_HEIGHT, DATE_WIDTH, DATE_HEIGHT);
+// The panels placed by the layouts below, in their order.
+enum layout_panel_t {
+    TIME_PANEL,
+    ALARM_PANEL,
+    DATE_PANEL,
+    WATER_SYMBOL_PANEL,
+    WATER_PERCENT_PANEL,
+    LAYOUT_PANELS,
+};
 
-DisplayPanel waterSymbolPanel(TIME_WIDTH, 0, COL_2_WIDTH, COL_2_ROW_HEIGHT);
-DisplayPanel waterPercentPanel(TIME_WIDTH, COL_2_ROW_HEIGHT, COL_2_WIDTH, COL_2_ROW_HEIGHT);
+// Where the panels go. See panel-layout.h. X, Y, W, H
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_WATER = {{
+    {0, 0, TIME_WIDTH, TIME_HEIGHT},
+    {0, TIME_HEIGHT, ALARM_WIDTH, ALARM_HEIGHT},
+    {0, TIME_HEIGHT + ALARM_HEIGHT, DATE_WIDTH, DATE_HEIGHT},
+    {TIME_WIDTH, 0, COL_2_WIDTH, COL_2_ROW_HEIGHT},
+    {TIME_WIDTH, COL_2_ROW_HEIGHT, COL_2_WIDTH, COL_2_ROW_HEIGHT},
+}};
+
+// If we don't have a water level, just show time.
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_ONLY = {{
+    {0, 0, TOTAL_WIDTH, TIME_HEIGHT},
+    {0, TIME_HEIGHT, TOTAL_WIDTH, ALARM_HEIGHT},
+    {0, TIME_HEIGHT + ALARM_HEIGHT, TOTAL_WIDTH, DATE_HEIGHT},
+    LAYOUT_HIDDEN,
+    LAYOUT_HIDDEN,
+}};
+
+// Switching between the layouts moves every panel, and the area to
+// repaint is the whole 128x64 screen: drawPanels() redraws every panel
+// into a cleared buffer anyway, and flush() sends only what changed.
+static_assert(layoutChanges(LAYOUT_TIME_ONLY, LAYOUT_TIME_WATER) == (1u << LAYOUT_PANELS) - 1,
+    "a layout switch moves every panel");
+static_assert(layoutSame(layoutChangedBounds(LAYOUT_TIME_ONLY, LAYOUT_TIME_WATER),
+    layout_rect_t{0, 0, TOTAL_WIDTH, TIME_HEIGHT + ALARM_HEIGHT + DATE_HEIGHT}),
+    "a layout switch repaints the whole screen");
+
+// The layout the panels are in. See switchLayout().
+const panel_layout_t<LAYOUT_PANELS>* shownLayout = NULL;
+
+// The Panels used by this app, placed by switchLayout()
+DisplayPanel timePanel(0, 0, 0, 0);
+DisplayPanel alarmPanel(0, 0, 0, 0);
+DisplayPanel datePanel(0, 0, 0, 0);
+
+DisplayPanel waterSymbolPanel(0, 0, 0, 0);
+DisplayPanel waterPercentPanel(0, 0, 0, 0);
 
 std::vector<DisplayPanel*> panels = {
     &timePanel,
@@ -36,11 +87,28 @@ std::vector<DisplayPanel*> panels = {
     &waterPercentPanel
 };
 
+// The panels the layouts place, in layout_panel_t order.
+std::array<DisplayPanel*, LAYOUT_PANELS> layoutPanels = {{
+    &timePanel,
+    &alarmPanel,
+    &datePanel,
+    &waterSymbolPanel,
+    &waterPercentPanel,
+}};
+
 std::vector<std::string> waterSymbolText = { "Cat", "H2O" };
 std::vector<std::string> blankText = {};
 
-void initializePanels(esphome::display::DisplayBuffer &display) {
+// Render a frame when an input of the panels changes.
+void watchPanelInputs() {
+    next_alarm->add_on_state_callback([](std::string) { frameScheduler.requestFrame(); });
+    cat_water_percentage->add_on_state_callback([](float) { frameScheduler.requestFrame(); });
+}
+
+void initializePanels(esphome::display::Display &display) {
     lcd = &display;
+    PanelText::reserve(panels);
+    switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_ONLY);
 
     timePanel.font = font_time;
     timePanel.color = Color::BLACK;
@@ -63,63 +131,54 @@ void initializePanels(esphome::display::DisplayBuffer &display) {
     waterPercentPanel.color = Color::BLACK;
     waterPercentPanel.textColor = Color::WHITE;
     waterPercentPanel.text = blankText;
+
+    watchPanelInputs();
 }
 
 void updatePanelStates() {
-    // Time      
-    auto now = esptime->now();
-    int hour = now.hour;
-    int minute = now.minute;
-    bool is_pm = hour >= 12;
-    hour = hour == 0 ? 12 : 
-        hour > 12 ? hour - 12 : hour;
-    sprintf(buffer, "%d:%02d", hour, minute);
-    std::vector<std::string> timeText = { buffer };
-    timePanel.text = timeText;
+    // Time and date, when the minute rolls over (or the clock is set)
+    if (timeSnapshot.tick(esptime->now())) {
+        PanelText timeText;
+        timeText.add(timeSnapshot.hourMinute).applyTo(timePanel);
+
+        PanelText dateText;
+        dateText.addf("%s %s", timeSnapshot.monthName, timeSnapshot.dayOfMonth).applyTo(datePanel);
+    }
 
     // Next alarm in room
     if (next_alarm->has_state() && next_alarm->state != "unavailable") {
-        sprintf(buffer, "%s", next_alarm->state.c_str());
-        std::vector<std::string> alarmText = { buffer };
-        alarmPanel.text = alarmText;
+        PanelText alarmText;
+        alarmText.add(next_alarm->state.c_str()).applyTo(alarmPanel);
         // ESP_LOGD("update", "next_alarm=%s", next_alarm->state.c_str());
     }
     else {
-        std::string dayName = now.strftime("%A");
-        std::vector<std::string> dayText = { dayName };
-        alarmPanel.text = dayText;
+        PanelText dayText;
+        dayText.add(timeSnapshot.dayNameLong).applyTo(alarmPanel);
     }
 
-    // Date
-    std::string monthName = now.strftime("%b");
-    sprintf(buffer, "%s %d", monthName.c_str(), now.day_of_month);
-    std::vector<std::string> dateText = { buffer };
-    datePanel.text = dateText;
-
     if (cat_water_percentage->has_state()) {
-        timePanel.w = TIME_WIDTH;
-        datePanel.w = DATE_WIDTH;
-        alarmPanel.w = ALARM_WIDTH;
-        waterSymbolPanel.enabled = true;
-        waterPercentPanel.enabled = true;
+        switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_WATER);
         if (cat_water_percentage->has_state()) {
             // Cat water percent
-            sprintf(buffer, "%.0f%%", cat_water_percentage->state);
-            std::vector<std::string> tempText = { buffer };
-            waterPercentPanel.text = tempText;
+            PanelText percentText;
+            percentText.addf("%.0f%%", cat_water_percentage->state).applyTo(waterPercentPanel);
         }
     }
     else {
-        // If we don't have a temperature state, just show time.
-        timePanel.w = TOTAL_WIDTH;
-        datePanel.w = TOTAL_WIDTH;
-        alarmPanel.w = TOTAL_WIDTH;
-        waterSymbolPanel.enabled = false;
-        waterPercentPanel.enabled = false;
+        switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_ONLY);
     }
 }
 
-// Draw all of the panels
+// Ask for the next frame when the minute (and so maybe the day) rolls
+// over, the only change to the screen that no input announces.
+void scheduleNextFrame() {
+    frameScheduler.frameIn(timeSnapshot.secondsToNextMinute() * 1000);
+}
+
+// Draw all of the panels, then send what changed to the OLED
 void drawPanels() {
+    oled.clear();
     DisplayPanel::drawAllPanels(*lcd, panels);
+    oled.flush();
+    scheduleNextFrame();
 }
@@ -77,3 +77,91 @@ int recentMinForSample(int newValue) {
     recentMin = newValue;
     return recentMin;
 }
+
+//
+// Multi-channel version of the above for devices that smooth several
+// sensors in lockstep (e.g. every channel of an ads1115 on the same tick).
+//
+// State is kept as a structure of arrays: taps[tap][channel] keeps one
+// tap of every channel contiguous, and each channel keeps a running sum,
+// so observing one sample per channel is a single straight loop over the
+// channels with no per-channel branching. That lets the compiler vectorize
+// it on the host and keeps it short on the Xtensa.
+//
+// Declare one MultiChannelFIR<NUM_CHANNELS> per group of channels and call
+// observeSamples(in, out) with one reading per channel. Optionally pass the
+// result through recentMinForSamples(in, out) for the recentMin smoothing.
+//
+template <int NUM_CHANNELS, int NUM_TAPS = NUM_FIR_TAPS>
+class MultiChannelFIR {
+    public:
+    // taps[tap][channel] is a cyclic window per channel.
+    int taps[NUM_TAPS][NUM_CHANNELS];
+    // Running sum of the taps for each channel.
+    int sums[NUM_CHANNELS];
+    int tapPosition;
+    int numTapsUsed;
+
+    // The recent minimum value per channel. -1 if there isn't one yet.
+    int recentMins[NUM_CHANNELS];
+
+    MultiChannelFIR() {
+        init();
+    }
+
+    /**
+     * Initialize (or reset) every channel.
+     */
+    void init() {
+        for (int t = 0; t < NUM_TAPS; t++) {
+            for (int c = 0; c < NUM_CHANNELS; c++) {
+                taps[t][c] = 0;
+            }
+        }
+        for (int c = 0; c < NUM_CHANNELS; c++) {
+            sums[c] = 0;
+            recentMins[c] = -1;
+        }
+        tapPosition = 0;
+        numTapsUsed = 0;
+    }
+
+    /**
+     * Observe one sample per channel from newReadings[] and write the
+     * smoothed value for each channel to smoothed[].
+     */
+    void observeSamples(const int *newReadings, int *smoothed) {
+        int *slot = taps[tapPosition];
+        for (int c = 0; c < NUM_CHANNELS; c++) {
+            // The oldest tap leaves the window as the new reading enters it.
+            sums[c] += newReadings[c] - slot[c];
+            slot[c] = newReadings[c];
+        }
+        if (++tapPosition == NUM_TAPS) {
+            tapPosition = 0;
+        }
+        if (numTapsUsed < NUM_TAPS) {
+            numTapsUsed++;
+        }
+        // The exact average, truncated. observeSample() sums in double, so
+        // it can come out 1 lower where the average is a whole number.
+        for (int c = 0; c < NUM_CHANNELS; c++) {
+            smoothed[c] = sums[c] / numTapsUsed;
+        }
+    }
+
+    /**
+     * recentMinForSample() for every channel. For each channel, if the
+     * value is within [recentMin, recentMin+RECENT_MIN_WINDOW] the output
+     * is recentMin, otherwise the value becomes the new recentMin.
+     */
+    void recentMinForSamples(const int *newValues, int *smoothed) {
+        for (int c = 0; c < NUM_CHANNELS; c++) {
+            const int min = recentMins[c];
+            const int value = newValues[c];
+            const bool inWindow = (min != -1) & (value >= min) & (value <= min + RECENT_MIN_WINDOW);
+            recentMins[c] = inWindow ? min : value;
+            smoothed[c] = recentMins[c];
+        }
+    }
+};
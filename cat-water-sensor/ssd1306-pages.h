@@ -0,0 +1,178 @@
+#ifndef SSD1306_PAGES_H
+#define SSD1306_PAGES_H
+
+// An SSD1306 (128x64, I2C) display that only sends what changed.
+//
+// ESPHome's ssd1306_i2c display sends the whole 1KB buffer every update,
+// which at 800kHz holds up the loop (and the HX711 sampling in it) for
+// milliseconds. Ssd1306Pages keeps, besides the buffer it draws into, a
+// copy of what the controller already shows. flush() compares the two a
+// page (8 rows) at a time and, for each page that changed, sets the
+// controller's column and page address to the changed columns and sends
+// only those bytes.
+//
+// Each frame:
+//
+//     oled.clear();
+//     ... draw ...
+//     oled.flush();
+
+#include <stdint.h>
+#include <string.h>
+
+#define SSD1306_WIDTH (128)
+#define SSD1306_HEIGHT (64)
+#define SSD1306_PAGES (SSD1306_HEIGHT / 8)
+// Data bytes per I2C write, after the control byte.
+#define SSD1306_I2C_CHUNK (32)
+
+#define SSD1306_CONTROL_COMMAND (0x00)
+#define SSD1306_CONTROL_DATA (0x40)
+#define SSD1306_SET_COLUMN_ADDRESS (0x21)
+#define SSD1306_SET_PAGE_ADDRESS (0x22)
+
+class Ssd1306Pages : public esphome::display::Display {
+    public:
+    // Diagnostics. Bytes on the bus (including the address and control
+    // bytes) and flushes since the last takeAverageUpdateBytes().
+    uint32_t busBytes = 0;
+    uint32_t flushes = 0;
+
+    /**
+     * Initialize the controller. contrast is 0-1, like the contrast
+     * of ESPHome's ssd1306 display.
+     */
+    void begin(esphome::i2c::I2CBus* bus_, uint8_t address_, float contrast) {
+        bus = bus_;
+        address = address_;
+        const uint8_t init[] = {
+            0xAE,                      // Display off
+            0xD5, 0x80,                // Clock divide
+            0xA8, SSD1306_HEIGHT - 1,  // Multiplex ratio
+            0xD3, 0x00,                // Display offset
+            0x40,                      // Start line 0
+            0x8D, 0x14,                // Charge pump on
+            0x20, 0x00,                // Horizontal addressing
+            0xA1,                      // Segment remap
+            0xC8,                      // COM scan decrementing
+            0xDA, 0x12,                // COM pins
+            0x81, (uint8_t) (contrast * 255),
+            0xD9, 0xF1,                // Pre-charge
+            0xDB, 0x40,                // VCOMH deselect level
+            0xA4,                      // Display from RAM
+            0xA6,                      // Not inverted
+            0xAF,                      // Display on
+        };
+        command(init, sizeof(init));
+        clear();
+        fullRefresh = true;
+    }
+
+    void clear() {
+        memset(buffer, 0, sizeof(buffer));
+    }
+
+    // Send the changed columns of each changed page.
+    void flush() {
+        for (int page = 0; page < SSD1306_PAGES; page++) {
+            const uint8_t* now = &buffer[page * SSD1306_WIDTH];
+            uint8_t* shown = &sent[page * SSD1306_WIDTH];
+            int first = 0;
+            int last = SSD1306_WIDTH - 1;
+            if (!fullRefresh) {
+                while (first < SSD1306_WIDTH && now[first] == shown[first]) {
+                    first++;
+                }
+                if (first == SSD1306_WIDTH) {
+                    continue;
+                }
+                while (now[last] == shown[last]) {
+                    last--;
+                }
+            }
+            const uint8_t window[] = {
+                SSD1306_SET_COLUMN_ADDRESS, (uint8_t) first, (uint8_t) last,
+                SSD1306_SET_PAGE_ADDRESS, (uint8_t) page, (uint8_t) page,
+            };
+            command(window, sizeof(window));
+            data(&now[first], last - first + 1);
+            memcpy(&shown[first], &now[first], last - first + 1);
+        }
+        fullRefresh = false;
+        flushes++;
+    }
+
+    /**
+     * Average bytes sent on the bus per flush() since the last call,
+     * and start counting again. A full frame is about 1.1KB.
+     */
+    float takeAverageUpdateBytes() {
+        const float average = flushes == 0 ? 0 : (float) busBytes / flushes;
+        busBytes = 0;
+        flushes = 0;
+        return average;
+    }
+
+    void draw_pixel_at(int x, int y, Color color) override {
+        if (x < 0 || x >= SSD1306_WIDTH || y < 0 || y >= SSD1306_HEIGHT) {
+            return;
+        }
+        const int index = x + (y / 8) * SSD1306_WIDTH;
+        if (color.is_on()) {
+            buffer[index] |= 1 << (y % 8);
+        }
+        else {
+            buffer[index] &= ~(1 << (y % 8));
+        }
+    }
+
+    int get_width() override {
+        return SSD1306_WIDTH;
+    }
+
+    int get_height() override {
+        return SSD1306_HEIGHT;
+    }
+
+    esphome::display::DisplayType get_display_type() override {
+        return esphome::display::DISPLAY_TYPE_BINARY;
+    }
+
+    void update() override {
+    }
+
+    private:
+    esphome::i2c::I2CBus* bus = NULL;
+    uint8_t address = 0x3C;
+    // What is being drawn, and what the controller shows. A byte is a
+    // column of 8 rows of a page, the top row in the low bit.
+    uint8_t buffer[SSD1306_WIDTH * SSD1306_PAGES];
+    uint8_t sent[SSD1306_WIDTH * SSD1306_PAGES];
+    bool fullRefresh = true;
+
+    // Commands, at most SSD1306_I2C_CHUNK bytes of them.
+    void command(const uint8_t* commands, int length) {
+        uint8_t write[1 + SSD1306_I2C_CHUNK];
+        write[0] = SSD1306_CONTROL_COMMAND;
+        memcpy(&write[1], commands, length);
+        send(write, 1 + length);
+    }
+
+    void data(const uint8_t* bytes, int length) {
+        uint8_t write[1 + SSD1306_I2C_CHUNK];
+        write[0] = SSD1306_CONTROL_DATA;
+        for (int offset = 0; offset < length; offset += SSD1306_I2C_CHUNK) {
+            const int chunk = length - offset < SSD1306_I2C_CHUNK ? length - offset : SSD1306_I2C_CHUNK;
+            memcpy(&write[1], &bytes[offset], chunk);
+            send(write, 1 + chunk);
+        }
+    }
+
+    void send(const uint8_t* bytes, int length) {
+        bus->write(address, bytes, length);
+        // The address byte, then the bytes.
+        busBytes += 1 + length;
+    }
+};
+
+#endif  // SSD1306_PAGES_H
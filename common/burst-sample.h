@@ -0,0 +1,132 @@
+#ifndef BURST_SAMPLE_H
+#define BURST_SAMPLE_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Number of ads1115 channels sampled on each wake (A0-A3).
+#define BURST_CHANNELS 4
+// Number of back-to-back samples taken per channel on each wake.
+#define BURST_SAMPLES 5
+// Most rounds of readings taken per wake, so a channel that keeps
+// failing (NAN) can't keep the node awake.
+#define BURST_MAX_ROUNDS (BURST_SAMPLES * 2)
+
+//
+// Burst sampling for the deep sleep moisture nodes.
+//
+// Rather than staying awake on a fixed timer while the ads1115 sensors
+// poll every few seconds, each wake takes BURST_SAMPLES back-to-back
+// readings of every channel, reduces each channel to a single robust
+// value (the median, which ignores the odd spike from the ADC) and
+// publishes that once.
+//
+// Call beginCycle() at the start of each wake, then take a round of
+// readings (observe(channel, value) for each) for as long as nextRound()
+// returns true. Once complete() is true use reduce(channel) to obtain the
+// value to publish. awakeMillis() reports how long the
+// device has been awake for the current cycle.
+//
+
+class BurstSampler {
+    public:
+    float samples[BURST_CHANNELS][BURST_SAMPLES];
+    int numSamples[BURST_CHANNELS];
+
+    // millis() at the start of the current cycle. The first cycle starts at
+    // boot (millis() == 0) so the time spent connecting to WiFi is counted.
+    uint32_t cycleStart = 0;
+    bool firstCycle = true;
+    // Rounds of readings taken this cycle.
+    int rounds = 0;
+
+    /**
+     * Start a new burst, discarding any previous samples.
+     */
+    void beginCycle() {
+        if (firstCycle) {
+            firstCycle = false;
+        }
+        else {
+            cycleStart = millis();
+        }
+        for (int c = 0; c < BURST_CHANNELS; c++) {
+            numSamples[c] = 0;
+        }
+        rounds = 0;
+    }
+
+    /**
+     * Record one raw reading for a channel. Readings that fail (NAN) or
+     * arrive after the burst is full are ignored.
+     */
+    void observe(int channel, float value) {
+        if (channel < 0 || channel >= BURST_CHANNELS || isnan(value)) {
+            return;
+        }
+        if (numSamples[channel] < BURST_SAMPLES) {
+            samples[channel][numSamples[channel]++] = value;
+        }
+    }
+
+    /**
+     * True once every channel has BURST_SAMPLES readings.
+     */
+    bool complete() {
+        for (int c = 0; c < BURST_CHANNELS; c++) {
+            if (numSamples[c] < BURST_SAMPLES) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * True if another round of readings should be taken: the burst isn't
+     * complete and fewer than BURST_MAX_ROUNDS rounds have been taken.
+     */
+    bool nextRound() {
+        if (complete() || rounds >= BURST_MAX_ROUNDS) {
+            return false;
+        }
+        rounds++;
+        return true;
+    }
+
+    /**
+     * The median of the readings for a channel, or NAN if the channel
+     * has no readings.
+     */
+    float reduce(int channel) {
+        int n = numSamples[channel];
+        if (n == 0) {
+            return NAN;
+        }
+        // Insertion sort a copy. n is tiny so this is cheaper than anything clever.
+        float sorted[BURST_SAMPLES];
+        for (int i = 0; i < n; i++) {
+            float v = samples[channel][i];
+            int j = i - 1;
+            while (j >= 0 && sorted[j] > v) {
+                sorted[j + 1] = sorted[j];
+                j--;
+            }
+            sorted[j + 1] = v;
+        }
+        if (n % 2 == 1) {
+            return sorted[n / 2];
+        }
+        return (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    }
+
+    /**
+     * Milliseconds awake in the current cycle.
+     */
+    uint32_t awakeMillis() {
+        return millis() - cycleStart;
+    }
+};
+
+BurstSampler burstSampler;
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+// Render frames only when the screen can change, instead of polling.
+//
+// Only a few things change what the panels show: the minute rolling over,
+// a sensor update, a touch, or a timed panel (such as the flash panel)
+// expiring. Rendering at a fixed update_interval wakes up every 0.1s (or
+// 1s) to find, almost every time, that nothing changed.
+//
+// FrameScheduler renders (calls frame) from an ESPHome scheduler timeout
+// instead. During a frame, the app calls frameIn() with the time until the
+// next thing it knows will change (the next minute, the flash expiring),
+// and input callbacks call requestFrame() to render right away. A pending
+// timeout is only ever replaced by a sooner one. With nothing to wait for,
+// it still renders every FRAME_SCHEDULER_MAX_MS.
+//
+// Give the display `update_interval: never` and make frame call its
+// update(), so the display lambda (updatePanelStates(), drawPanels())
+// only runs when scheduled. With PANEL_TIMING_ENABLED, include
+// panel-timing.h first.
+//
+// Touches don't wait for the next loop. A touch on a panel calls
+// touchedAt(), and the end of on_touch calls renderRequestedFrame(),
+// which renders the frame the touch handler requested (if any) right
+// there. The time from touchedAt() to the end of that frame, when
+// update() has flushed it to the display, is the touch latency.
+
+#include <math.h>
+#include <stdint.h>
+#include <functional>
+
+#ifndef FRAME_SCHEDULER_MAX_MS
+#define FRAME_SCHEDULER_MAX_MS (60000)
+#endif
+
+class FrameScheduler {
+    public:
+    // Diagnostics. Frames rendered, and the time spent in them, since
+    // the last takeReport().
+    uint32_t frames = 0;
+    uint32_t frameMicros = 0;
+    // The last report, from takeReport(): frames per hour, and CPU time
+    // in frames as ms per hour.
+    float reportFramesPerHour = 0;
+    float reportFrameMsPerHour = 0;
+    // Touch to the end of the frame that shows it: the average and the
+    // slowest in the last report, in ms. NAN with no such touches.
+    float reportTouchLatencyMs = NAN;
+    float reportTouchLatencyMaxMs = NAN;
+
+    /**
+     * Start rendering. owner is the component the timeout belongs to
+     * (usually the display), frame renders one frame.
+     */
+    void begin(esphome::Component* owner_, std::function<void()> frame_) {
+        owner = owner_;
+        frame = frame_;
+        reportStartMs = millis();
+        requestFrame();
+    }
+
+    // Render as soon as possible, e.g. when an input of a panel changed.
+    void requestFrame() {
+        frameIn(0);
+    }
+
+    // Render in ms at the latest.
+    void frameIn(uint32_t ms) {
+        if (owner == NULL) {
+            return;
+        }
+        if (ms > FRAME_SCHEDULER_MAX_MS) {
+            ms = FRAME_SCHEDULER_MAX_MS;
+        }
+        const uint32_t now = millis();
+        if (pending && (int32_t) (pendingAtMs - now) <= (int32_t) ms) {
+            return;
+        }
+        pending = true;
+        pendingAtMs = now + ms;
+        const uint32_t dueUs = micros() + ms * 1000;
+        esphome::App.scheduler.set_timeout(owner, "frame", ms, [this, dueUs]() {
+            runFrame(dueUs);
+        });
+    }
+
+    // A panel was touched at atUs (micros()).
+    void touchedAt(uint32_t atUs) {
+        touchUs = atUs;
+        touchPending = true;
+    }
+
+    /**
+     * If a frame is due now (requestFrame() was called, e.g. by a touch
+     * handler), render it right away rather than on the next loop.
+     * Otherwise the touch changed nothing on the screen, and isn't timed.
+     */
+    void renderRequestedFrame() {
+        if (owner == NULL || !pending || (int32_t) (pendingAtMs - millis()) > 0) {
+            touchPending = false;
+            return;
+        }
+        esphome::App.scheduler.cancel_timeout(owner, "frame");
+        runFrame(micros());
+    }
+
+    /**
+     * Scale the counts since the last report to an hour into the report
+     * fields, and start counting again.
+     */
+    void takeReport() {
+        const uint32_t now = millis();
+        const float hours = (now - reportStartMs) / 3600000.0f;
+        reportFramesPerHour = hours > 0 ? frames / hours : 0;
+        reportFrameMsPerHour = hours > 0 ? frameMicros / 1000.0f / hours : 0;
+        reportTouchLatencyMs = touches == 0 ? NAN : touchMicros / 1000.0f / touches;
+        reportTouchLatencyMaxMs = touches == 0 ? NAN : touchMaxMicros / 1000.0f;
+        frames = 0;
+        frameMicros = 0;
+        touches = 0;
+        touchMicros = 0;
+        touchMaxMicros = 0;
+        reportStartMs = now;
+    }
+
+    private:
+    esphome::Component* owner = NULL;
+    std::function<void()> frame;
+    bool pending = false;
+    uint32_t pendingAtMs = 0;
+    uint32_t reportStartMs = 0;
+    // The touch not yet shown, and the touches shown since the last report.
+    bool touchPending = false;
+    uint32_t touchUs = 0;
+    uint32_t touches = 0;
+    uint32_t touchMicros = 0;
+    uint32_t touchMaxMicros = 0;
+
+    void runFrame(uint32_t dueUs) {
+        pending = false;
+#ifdef PANEL_TIMING_ENABLED
+        // Waiting for the timeout isn't a dropped frame.
+        panelTiming.expectFrameAt(dueUs);
+#else
+        (void) dueUs;
+#endif
+        const uint32_t start = micros();
+        frame();
+        const uint32_t end = micros();
+        frameMicros += end - start;
+        frames++;
+        if (touchPending) {
+            const uint32_t latency = end - touchUs;
+            touches++;
+            touchMicros += latency;
+            touchMaxMicros = latency > touchMaxMicros ? latency : touchMaxMicros;
+            touchPending = false;
+        }
+        if (!pending) {
+            frameIn(FRAME_SCHEDULER_MAX_MS);
+        }
+    }
+};
+
+#endif  // FRAME_SCHEDULER_H
@@ -0,0 +1,229 @@
+#ifndef PANEL_BITMAP_CACHE_H
+#define PANEL_BITMAP_CACHE_H
+
+// Cache of rendered panels.
+//
+// Drawing a panel with a large font (font_time is 110px) rasterizes every
+// glyph pixel by pixel through the font renderer, even when the text is
+// the same "10:42" as last time. PanelBitmapCache renders a panel once
+// into an off-screen 1bpp bitmap (a bit per pixel: text colour or panel
+// colour) and afterwards redraws it as a blit (see panel-blit.h). A panel
+// is only rendered again when its content hash (see PanelDamage) changes.
+//
+// The cache holds at most PANEL_BITMAP_CACHE_BYTES of bitmaps and evicts
+// the least recently used ones to stay under that. The bitmaps are packed
+// into one buffer of that size, allocated with the first miss, so later
+// misses don't allocate: an eviction moves the bitmaps after it down.
+//
+// Panels that can't be represented this way (an image, anything drawn in
+// a third colour, or text that spills outside the panel) are drawn
+// directly, as before.
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <vector>
+#include <display-panel.h>
+#include "panel-blit.h"
+
+#ifndef PANEL_BITMAP_CACHE_BYTES
+#define PANEL_BITMAP_CACHE_BYTES (16 * 1024)
+#endif
+// Most entries kept, including those for panels drawn directly.
+#define PANEL_BITMAP_CACHE_ENTRIES (32)
+
+struct panel_bitmap_t {
+    uint32_t hash;
+    int w, h;
+    Color foreground;
+    Color background;
+    // False if the panel couldn't be captured in two colours.
+    bool cacheable;
+    uint32_t lastUsed;
+    // Where the bitmap is in the cache's buffer, and its size (0 if not
+    // cacheable). Row-major, each row padded to a whole byte, MSB first.
+    uint32_t offset;
+    uint32_t size;
+};
+
+// Off-screen Display that records which pixels of one panel were drawn in
+// its text colour.
+class PanelBitmapCapture : public esphome::display::Display {
+    public:
+    panel_bitmap_t* target = NULL;
+    uint8_t* bits = NULL;
+    int originX = 0;
+    int originY = 0;
+    int width = 0;
+    int height = 0;
+
+    void draw_pixel_at(int x, int y, Color color) override {
+        x -= originX;
+        y -= originY;
+        if (x < 0 || y < 0 || x >= target->w || y >= target->h) {
+            // Drawn outside the panel (e.g. text wider than the panel),
+            // which a blit of the panel wouldn't reproduce.
+            if (x + originX >= 0 && y + originY >= 0 && x + originX < width && y + originY < height) {
+                target->cacheable = false;
+            }
+            return;
+        }
+        const int rowBytes = (target->w + 7) / 8;
+        uint8_t &byte = bits[y * rowBytes + x / 8];
+        const uint8_t mask = 0x80 >> (x % 8);
+        if (color == target->foreground) {
+            byte |= mask;
+        }
+        else if (color == target->background) {
+            byte &= ~mask;
+        }
+        else {
+            target->cacheable = false;
+        }
+    }
+
+    int get_width() override {
+        return width;
+    }
+
+    int get_height() override {
+        return height;
+    }
+
+    esphome::display::DisplayType get_display_type() override {
+        return esphome::display::DISPLAY_TYPE_COLOR;
+    }
+
+    void update() override {
+    }
+};
+
+class PanelBitmapCache {
+    public:
+    // Diagnostics. hits and misses are counted by whichever task draws
+    // (see panel-render-task.h) and reset by takeHitRate().
+    std::atomic<uint32_t> hits{0};
+    std::atomic<uint32_t> misses{0};
+    uint32_t evictions = 0;
+    uint32_t bytesUsed = 0;
+
+    /**
+     * Draw panel, from the cache if its content (contentHash) has been
+     * drawn before.
+     */
+    void draw(esphome::display::Display &display, PanelBlitter &blitter, DisplayPanel* panel, uint32_t contentHash) {
+        if (panel->image != NULL) {
+            panel->draw(display);
+            return;
+        }
+        tick++;
+        panel_bitmap_t* entry = find(contentHash, panel->w, panel->h);
+        if (entry != NULL) {
+            hits++;
+        }
+        else {
+            misses++;
+            entry = capture(display, panel, contentHash);
+        }
+        entry->lastUsed = tick;
+        if (entry->cacheable) {
+            blitter.blitBits(display, panel->x, panel->y, entry->w, entry->h, buffer.data() + entry->offset,
+                (entry->w + 7) / 8, entry->foreground, entry->background);
+        }
+        else {
+            panel->draw(display);
+        }
+    }
+
+    /**
+     * Percentage of panel draws served from the cache since the last call
+     * (NAN if there were none), and start counting again.
+     */
+    float takeHitRate() {
+        const uint32_t hitCount = hits.exchange(0);
+        const uint32_t draws = hitCount + misses.exchange(0);
+        return draws == 0 ? NAN : 100.0f * hitCount / draws;
+    }
+
+    private:
+    // Ordered by offset, the bitmaps packed from the start of buffer.
+    std::vector<panel_bitmap_t> entries;
+    std::vector<uint8_t> buffer;
+    PanelBitmapCapture capturer;
+    uint32_t tick = 0;
+
+    panel_bitmap_t* find(uint32_t hash, int w, int h) {
+        for (panel_bitmap_t &entry : entries) {
+            if (entry.hash == hash && entry.w == w && entry.h == h) {
+                return &entry;
+            }
+        }
+        return NULL;
+    }
+
+    // Render panel into a new entry.
+    panel_bitmap_t* capture(esphome::display::Display &display, DisplayPanel* panel, uint32_t hash) {
+        uint32_t size = ((panel->w + 7) / 8) * panel->h;
+        const bool fits = size <= PANEL_BITMAP_CACHE_BYTES;
+        if (!fits) {
+            // Never fits. Remember to draw it directly.
+            size = 0;
+        }
+        if (buffer.empty()) {
+            buffer.assign(PANEL_BITMAP_CACHE_BYTES, 0);
+            entries.reserve(PANEL_BITMAP_CACHE_ENTRIES);
+        }
+        while ((bytesUsed + size > PANEL_BITMAP_CACHE_BYTES || entries.size() >= PANEL_BITMAP_CACHE_ENTRIES)
+                && evictLeastRecentlyUsed()) {
+        }
+
+        entries.push_back(panel_bitmap_t{hash, (int) panel->w, (int) panel->h, panel->textColor, panel->color, fits, tick, bytesUsed, 0});
+        panel_bitmap_t &entry = entries.back();
+        if (!fits) {
+            return &entry;
+        }
+        memset(buffer.data() + bytesUsed, 0, size);
+        capturer.target = &entry;
+        capturer.bits = buffer.data() + bytesUsed;
+        capturer.originX = panel->x;
+        capturer.originY = panel->y;
+        capturer.width = display.get_width();
+        capturer.height = display.get_height();
+        panel->draw(capturer);
+        capturer.target = NULL;
+        capturer.bits = NULL;
+
+        if (entry.cacheable) {
+            entry.size = size;
+            bytesUsed += size;
+        }
+        return &entry;
+    }
+
+    // Returns false if there was nothing to evict.
+    bool evictLeastRecentlyUsed() {
+        int oldest = -1;
+        for (int i = 0; i < (int) entries.size(); i++) {
+            if (oldest < 0 || entries[i].lastUsed < entries[oldest].lastUsed) {
+                oldest = i;
+            }
+        }
+        if (oldest < 0) {
+            return false;
+        }
+        // Close the gap, keeping the bitmaps packed.
+        const uint32_t offset = entries[oldest].offset;
+        const uint32_t size = entries[oldest].size;
+        memmove(buffer.data() + offset, buffer.data() + offset + size, bytesUsed - offset - size);
+        bytesUsed -= size;
+        entries.erase(entries.begin() + oldest);
+        for (int i = oldest; i < (int) entries.size(); i++) {
+            entries[i].offset -= size;
+        }
+        evictions++;
+        return true;
+    }
+};
+
+#endif  // PANEL_BITMAP_CACHE_H
@@ -0,0 +1,128 @@
+#ifndef PANEL_BLIT_H
+#define PANEL_BLIT_H
+
+// Batched pixel writes to a Display.
+//
+// Display::filled_rectangle() and the font renderer write one pixel at a
+// time, each a separate draw_pixel_at() call. PanelBlitter hands a whole
+// rectangle to Display::draw_pixels_at() as RGB565 instead, in blocks of
+// up to PANEL_BLIT_ROWS rows, so a rectangle costs one call per block
+// rather than one per pixel.
+//
+// What a call costs depends on the display:
+//
+// * tft-office.yaml and tft-back-door.yaml use ESPHome's ili9xxx with a
+//   buffer and rotation: 270. There draw_pixels_at() falls back to
+//   Display's draw_pixel_at() per pixel, into the buffer, and nothing
+//   reaches the bus until update() sends the window around what was
+//   written. Batching saves nothing on the bus; what saves there is
+//   writing fewer pixels (panel-damage.h, panel-bitmap-cache.h), which
+//   shrinks the window.
+// * The band path (panel-band.h, ili9341-spi.h) writes the ili9341
+//   directly, so there each block is an address window and one SPI
+//   transfer.
+//
+// panel-host/measure-panels.cpp measures both (-DHOST_DISPLAY_BUFFERED
+// and -DPANEL_BAND_RENDERING).
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include <display-panel.h>
+
+// Rows per draw_pixels_at() call. The block buffer is 2 bytes per pixel,
+// so a full-width block is 320 * 2 * PANEL_BLIT_ROWS bytes.
+#ifndef PANEL_BLIT_ROWS
+#define PANEL_BLIT_ROWS (8)
+#endif
+
+class PanelBlitter {
+    public:
+    // Diagnostics. draw_pixels_at() calls made and pixels written.
+    uint32_t calls = 0;
+    uint32_t pixels = 0;
+
+    /**
+     * Fill a rectangle with one colour.
+     */
+    void fill(esphome::display::Display &display, int x, int y, int w, int h, Color color) {
+        if (!clip(display, x, y, w, h, NULL, NULL)) {
+            return;
+        }
+        const int rows = std::min(h, PANEL_BLIT_ROWS);
+        const uint16_t pixel = toRgb565(color);
+        block.resize(w * rows * 2);
+        for (int i = 0; i < w * rows; i++) {
+            block[i * 2] = pixel >> 8;
+            block[i * 2 + 1] = pixel & 0xFF;
+        }
+        for (int r = 0; r < h; r += rows) {
+            write(display, x, y + r, w, std::min(rows, h - r));
+        }
+    }
+
+    /**
+     * Draw a 1bpp bitmap (rows padded to rowBytes, MSB first) with set bits
+     * in foreground and clear bits in background.
+     */
+    void blitBits(esphome::display::Display &display, int x, int y, int w, int h,
+            const uint8_t* bits, int rowBytes, Color foreground, Color background) {
+        int skipX = 0;
+        int skipY = 0;
+        if (!clip(display, x, y, w, h, &skipX, &skipY)) {
+            return;
+        }
+        const uint16_t set = toRgb565(foreground);
+        const uint16_t clear = toRgb565(background);
+        const int rows = std::min(h, PANEL_BLIT_ROWS);
+        block.resize(w * rows * 2);
+        for (int r = 0; r < h; r += rows) {
+            const int blockRows = std::min(rows, h - r);
+            uint8_t* out = block.data();
+            for (int br = 0; br < blockRows; br++) {
+                const uint8_t* row = bits + (skipY + r + br) * rowBytes;
+                for (int c = skipX; c < skipX + w; c++) {
+                    const uint16_t pixel = (row[c / 8] & (0x80 >> (c % 8))) ? set : clear;
+                    *out++ = pixel >> 8;
+                    *out++ = pixel & 0xFF;
+                }
+            }
+            write(display, x, y + r, w, blockRows);
+        }
+    }
+
+    static uint16_t toRgb565(Color color) {
+        return ((color.r & 0xF8) << 8) | ((color.g & 0xFC) << 3) | (color.b >> 3);
+    }
+
+    private:
+    // PANEL_BLIT_ROWS rows of big-endian RGB565.
+    std::vector<uint8_t> block;
+
+    void write(esphome::display::Display &display, int x, int y, int w, int h) {
+        display.draw_pixels_at(x, y, w, h, block.data(),
+            esphome::display::COLOR_ORDER_RGB, esphome::display::COLOR_BITNESS_565, true, 0, 0, 0);
+        calls++;
+        pixels += w * h;
+    }
+
+    // Clip the rectangle to the display. skipX/skipY (if given) are set to
+    // how many source columns/rows were clipped off the left/top.
+    static bool clip(esphome::display::Display &display, int &x, int &y, int &w, int &h, int* skipX, int* skipY) {
+        const int left = std::max(x, 0);
+        const int top = std::max(y, 0);
+        const int right = std::min(x + w, display.get_width());
+        const int bottom = std::min(y + h, display.get_height());
+        if (skipX != NULL) {
+            *skipX = left - x;
+            *skipY = top - y;
+        }
+        x = left;
+        y = top;
+        w = right - left;
+        h = bottom - top;
+        return w > 0 && h > 0;
+    }
+};
+
+#endif  // PANEL_BLIT_H
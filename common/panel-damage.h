@@ -0,0 +1,280 @@
+#ifndef PANEL_DAMAGE_H
+#define PANEL_DAMAGE_H
+
+// Damage tracking for a list of DisplayPanels.
+//
+// Drawing every panel every frame rewrites the whole 320x240 RGB565 frame
+// (153,600 bytes over SPI) ten times a second, although the content only
+// changes about once a minute. PanelDamage remembers what each panel
+// looked like when it was last drawn (a hash of its text, colours, font,
+// image and outline, plus its geometry and whether it is enabled) and
+// each frame redraws only:
+//
+// * panels that changed,
+// * panels under an area a panel no longer covers (it moved, shrank or
+//   was disabled). The uncovered area is cleared to the background first.
+// * panels later in the list (drawn on top) that overlap a redrawn panel,
+//   such as a flash message.
+//
+// The display must run with auto_clear_enabled: False so the panels that
+// are not redrawn keep their pixels.
+//
+// Define PANEL_DAMAGE_FULL_REDRAW to redraw every panel every frame (the
+// old behaviour) to compare the frame bytes reported.
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <display-panel.h>
+#include "panel-bitmap-cache.h"
+#include "panel-timing.h"
+
+struct panel_rect_t {
+    int x, y, w, h;
+};
+
+struct panel_snapshot_t {
+    bool drawn;         // False until the panel has been drawn once.
+    bool visible;       // Enabled and non-zero size.
+    panel_rect_t rect;
+    uint32_t hash;      // Everything else that affects the panel's pixels.
+};
+
+class PanelDamage {
+    public:
+    // Colour used for areas no panel covers any more.
+    Color background = Color::BLACK;
+
+    // Estimated bytes sent to the display by the last frame. The ili9xxx
+    // component sends the bounding box of the pixels drawn since the last
+    // update, 2 bytes per pixel.
+    uint32_t lastFrameBytes = 0;
+    // Panels redrawn by the last frame.
+    int lastFramePanels = 0;
+
+    // If set, panels are drawn through this cache of rendered panels.
+    PanelBitmapCache* bitmapCache = NULL;
+
+    // Clears uncovered areas and draws cached panels in bulk.
+    PanelBlitter blitter;
+
+    /**
+     * Draw the panels that need it, in list order (later panels over-draw
+     * earlier ones). Call instead of DisplayPanel::drawAllPanels().
+     */
+    void draw(esphome::display::Display &display, std::vector<DisplayPanel*> &panels) {
+        plan(panels);
+
+        PANEL_TIMING_START(clearStart);
+        for (const panel_rect_t &area : exposed) {
+            blitter.fill(display, area.x, area.y, area.w, area.h, background);
+        }
+        PANEL_TIMING_PHASE(PANEL_PHASE_CLEAR, clearStart);
+
+        PANEL_TIMING_START(drawStart);
+        for (int i = 0; i < (int) panels.size(); i++) {
+            if (dirty[i] && isVisible(panels[i])) {
+                drawPanel(display, panels, i);
+            }
+        }
+        PANEL_TIMING_PHASE(PANEL_PHASE_DRAW, drawStart);
+
+        commit(panels);
+    }
+
+    /**
+     * Work out which panels need drawing this frame, and the bounding box
+     * of the area that changes (damagedBounds()). Returns false if nothing
+     * changed. Follow with commit() once the panels have been drawn.
+     * draw() does all of this; this is for drawing some other way (see
+     * panel-band.h).
+     */
+    bool plan(std::vector<DisplayPanel*> &panels) {
+        const int count = panels.size();
+        if ((int) snapshots.size() != count) {
+            // First frame (or the list changed). Everything is dirty.
+            snapshots.assign(count, panel_snapshot_t{});
+            // At most one area per panel, so frames don't allocate.
+            exposed.reserve(count);
+        }
+        dirty.assign(count, false);
+        exposed.clear();
+
+        for (int i = 0; i < count; i++) {
+            const panel_snapshot_t current = snapshotOf(panels[i]);
+            const panel_snapshot_t &last = snapshots[i];
+            const bool moved = !sameRect(current.rect, last.rect);
+            if (!last.drawn || moved || current.visible != last.visible || current.hash != last.hash) {
+                dirty[i] = true;
+                if (last.drawn && last.visible && (moved || !current.visible)) {
+                    exposed.push_back(last.rect);
+                }
+            }
+#ifdef PANEL_DAMAGE_FULL_REDRAW
+            dirty[i] = true;
+#endif
+        }
+
+        // Clearing an uncovered area wipes whatever was drawn under it.
+        for (const panel_rect_t &area : exposed) {
+            for (int i = 0; i < count; i++) {
+                if (!dirty[i] && isVisible(panels[i]) && intersects(area, rectOf(panels[i]))) {
+                    dirty[i] = true;
+                }
+            }
+        }
+
+        // Redrawing a panel over-draws the panels on top of it.
+        for (int i = 0; i < count; i++) {
+            if (!dirty[i] || !isVisible(panels[i])) {
+                continue;
+            }
+            for (int j = i + 1; j < count; j++) {
+                if (!dirty[j] && isVisible(panels[j]) && intersects(rectOf(panels[i]), rectOf(panels[j]))) {
+                    dirty[j] = true;
+                }
+            }
+        }
+
+        frameBounds = panel_rect_t{0, 0, 0, 0};
+        lastFramePanels = 0;
+        for (const panel_rect_t &area : exposed) {
+            addToFrameBounds(area);
+        }
+        for (int i = 0; i < count; i++) {
+            if (dirty[i] && isVisible(panels[i])) {
+                addToFrameBounds(rectOf(panels[i]));
+                lastFramePanels++;
+            }
+        }
+        return frameBounds.w > 0 && frameBounds.h > 0;
+    }
+
+    /**
+     * The area plan() found will change this frame.
+     */
+    const panel_rect_t &damagedBounds() const {
+        return frameBounds;
+    }
+
+    /**
+     * Draw panels[index], through the bitmap cache if there is one.
+     */
+    void drawPanel(esphome::display::Display &display, std::vector<DisplayPanel*> &panels, int index) {
+        DisplayPanel* panel = panels[index];
+        PANEL_TIMING_START(panelStart);
+        if (bitmapCache != NULL) {
+            bitmapCache->draw(display, blitter, panel, snapshotOf(panel).hash);
+        }
+        else {
+            panel->draw(display);
+        }
+        PANEL_TIMING_PANEL(index, panel->name.c_str(), panelStart);
+    }
+
+    /**
+     * Remember the panels drawn this frame as they are now.
+     */
+    void commit(std::vector<DisplayPanel*> &panels) {
+        for (int i = 0; i < (int) panels.size(); i++) {
+            if (dirty[i]) {
+                snapshots[i] = snapshotOf(panels[i]);
+                snapshots[i].drawn = true;
+            }
+        }
+
+        lastFrameBytes = frameBounds.w * frameBounds.h * 2;
+        totalFrameBytes.fetch_add(lastFrameBytes, std::memory_order_relaxed);
+        totalFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static panel_rect_t rectOf(DisplayPanel* panel) {
+        return panel_rect_t{(int) panel->x, (int) panel->y, (int) panel->w, (int) panel->h};
+    }
+
+    static bool isVisible(DisplayPanel* panel) {
+        return panel->enabled && panel->w > 0 && panel->h > 0;
+    }
+
+    static bool intersects(const panel_rect_t &a, const panel_rect_t &b) {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    /**
+     * Forget what was drawn so the next frame redraws every panel.
+     * Use after something else has drawn over the display.
+     */
+    void invalidateAll() {
+        snapshots.clear();
+    }
+
+    /**
+     * Average bytes per frame since the last call. Safe to call from
+     * another task than the one drawing (see panel-render-task.h).
+     */
+    float takeAverageFrameBytes() {
+        const uint32_t frames = totalFrames.exchange(0);
+        const uint32_t bytes = totalFrameBytes.exchange(0);
+        return frames == 0 ? 0 : (float) bytes / frames;
+    }
+
+    private:
+    std::vector<panel_snapshot_t> snapshots;
+    std::vector<bool> dirty;
+    std::vector<panel_rect_t> exposed;
+    panel_rect_t frameBounds;
+    // Since takeAverageFrameBytes(). At most a full frame (153,600 bytes) a
+    // frame, so 32 bits last for over 27,000 frames between reports.
+    std::atomic<uint32_t> totalFrameBytes{0};
+    std::atomic<uint32_t> totalFrames{0};
+
+    static bool sameRect(const panel_rect_t &a, const panel_rect_t &b) {
+        return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+    }
+
+    void addToFrameBounds(const panel_rect_t &area) {
+        if (frameBounds.w == 0 || frameBounds.h == 0) {
+            frameBounds = area;
+            return;
+        }
+        const int right = std::max(frameBounds.x + frameBounds.w, area.x + area.w);
+        const int bottom = std::max(frameBounds.y + frameBounds.h, area.y + area.h);
+        frameBounds.x = std::min(frameBounds.x, area.x);
+        frameBounds.y = std::min(frameBounds.y, area.y);
+        frameBounds.w = right - frameBounds.x;
+        frameBounds.h = bottom - frameBounds.y;
+    }
+
+    // FNV-1a.
+    static uint32_t hashBytes(uint32_t hash, const void* data, size_t length) {
+        const uint8_t* bytes = (const uint8_t*) data;
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    static uint32_t hashValue(uint32_t hash, const T &value) {
+        return hashBytes(hash, &value, sizeof(value));
+    }
+
+    static panel_snapshot_t snapshotOf(DisplayPanel* panel) {
+        uint32_t hash = 2166136261u;
+        for (const std::string &line : panel->text) {
+            hash = hashBytes(hash, line.c_str(), line.size() + 1);
+        }
+        hash = hashValue(hash, panel->text.size());
+        hash = hashValue(hash, panel->color.raw_32);
+        hash = hashValue(hash, panel->textColor.raw_32);
+        hash = hashValue(hash, (uintptr_t) panel->font);
+        hash = hashValue(hash, (uintptr_t) panel->image);
+        hash = hashValue(hash, panel->fontVertOffset);
+        hash = hashValue(hash, panel->fontHeightOffset);
+        hash = hashValue(hash, panel->drawPanelOutline);
+        return panel_snapshot_t{false, isVisible(panel), rectOf(panel), hash};
+    }
+};
+
+#endif  // PANEL_DAMAGE_H
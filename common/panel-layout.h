@@ -0,0 +1,127 @@
+#ifndef PANEL_LAYOUT_H
+#define PANEL_LAYOUT_H
+
+// Panel layouts resolved at compile time.
+//
+// A layout is a table with the rectangle of each of an app's panels,
+// indexed by the app's panel enum. Rectangles are given in percentages of
+// the screen (layoutCell()) and resolved to pixels with integer maths, so
+// the whole table is a constant. Each edge is rounded down on its own, so
+// panels that meet in percentages meet in pixels, with no gap.
+//
+// An app with more than one arrangement (such as "time only" and "time and
+// temperatures") declares one layout per variant and switches between them
+// with switchLayout(), which only places the panels when the variant
+// changes. A panel with no width or height is disabled.
+// layoutChanges() and layoutChangedBounds() tell which panels, and which
+// area of the screen, differ between two variants: the only part of the
+// screen a switch needs to repaint. Being constexpr, they can check a
+// pair of layouts with static_assert.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <array>
+#include <display-panel.h>
+
+struct layout_rect_t {
+    int x;
+    int y;
+    int w;
+    int h;
+};  // A panel's rectangle, in pixels
+
+template <size_t N>
+using panel_layout_t = std::array<layout_rect_t, N>;
+
+// A hidden panel.
+constexpr layout_rect_t LAYOUT_HIDDEN = {0, 0, 0, 0};
+
+// percent (0-100) of length, rounded down.
+constexpr int layoutPercent(int length, int percent) {
+    return length * percent / 100;
+}
+
+// The rectangle at (xPercent, yPercent), wPercent wide and hPercent high,
+// of a width x height screen.
+constexpr layout_rect_t layoutCell(int width, int height, int xPercent, int yPercent, int wPercent, int hPercent) {
+    return layout_rect_t{
+        layoutPercent(width, xPercent),
+        layoutPercent(height, yPercent),
+        layoutPercent(width, xPercent + wPercent) - layoutPercent(width, xPercent),
+        layoutPercent(height, yPercent + hPercent) - layoutPercent(height, yPercent),
+    };
+}
+
+constexpr bool layoutSame(const layout_rect_t &a, const layout_rect_t &b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+// The panels (a bit per index) whose rectangles differ between a and b.
+template <size_t N>
+constexpr uint32_t layoutChanges(const panel_layout_t<N> &a, const panel_layout_t<N> &b) {
+    static_assert(N <= 32, "layoutChanges() handles up to 32 panels");
+    uint32_t changes = 0;
+    for (size_t i = 0; i < N; i++) {
+        if (!layoutSame(a[i], b[i])) {
+            changes |= 1u << i;
+        }
+    }
+    return changes;
+}
+
+// The smallest rectangle holding a and b. Empty rectangles (no width or
+// height) add nothing.
+constexpr layout_rect_t layoutUnion(const layout_rect_t &a, const layout_rect_t &b) {
+    return a.w <= 0 || a.h <= 0 ? b :
+        b.w <= 0 || b.h <= 0 ? a :
+        layout_rect_t{
+            a.x < b.x ? a.x : b.x,
+            a.y < b.y ? a.y : b.y,
+            (a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w) - (a.x < b.x ? a.x : b.x),
+            (a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h) - (a.y < b.y ? a.y : b.y),
+        };
+}
+
+// The area covered, in either layout, by the panels that differ between a
+// and b. Empty if nothing differs.
+template <size_t N>
+constexpr layout_rect_t layoutChangedBounds(const panel_layout_t<N> &a, const panel_layout_t<N> &b) {
+    layout_rect_t bounds = LAYOUT_HIDDEN;
+    for (size_t i = 0; i < N; i++) {
+        if (!layoutSame(a[i], b[i])) {
+            bounds = layoutUnion(layoutUnion(bounds, a[i]), b[i]);
+        }
+    }
+    return bounds;
+}
+
+// Give each panel its rectangle from layout. panels is in the layout's
+// order. Panels the layout hides are disabled, the others enabled.
+template <size_t N>
+void applyLayout(const std::array<DisplayPanel*, N> &panels, const panel_layout_t<N> &layout) {
+    for (size_t i = 0; i < N; i++) {
+        const layout_rect_t &rect = layout[i];
+        panels[i]->x = rect.x;
+        panels[i]->y = rect.y;
+        panels[i]->w = rect.w;
+        panels[i]->h = rect.h;
+        panels[i]->enabled = rect.w > 0 && rect.h > 0;
+    }
+}
+
+// Place panels by layout, if shown (the layout they were last placed by,
+// or NULL) isn't layout already. Returns the panels that moved, a bit per
+// index (see layoutChanges()); all of them the first time.
+template <size_t N>
+uint32_t switchLayout(const std::array<DisplayPanel*, N> &panels, const panel_layout_t<N>* &shown,
+        const panel_layout_t<N> &layout) {
+    if (shown == &layout) {
+        return 0;
+    }
+    const uint32_t changes = shown == NULL ? (uint32_t) ((1ull << N) - 1) : layoutChanges(*shown, layout);
+    applyLayout(panels, layout);
+    shown = &layout;
+    return changes;
+}
+
+#endif  // PANEL_LAYOUT_H
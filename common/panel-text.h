@@ -0,0 +1,162 @@
+#ifndef PANEL_TEXT_H
+#define PANEL_TEXT_H
+
+// Fixed-capacity panel text, formatted without touching the heap.
+//
+// A PanelText holds up to PANEL_TEXT_LINES lines of PANEL_TEXT_LINE_CHARS
+// characters inline, so it can live on the stack. Lines are formatted with
+// snprintf and truncated (never overrun) when too long. applyTo() copies
+// the lines into the std::vector<std::string> text of a DisplayPanel,
+// reusing the strings already there, so once a panel has held lines as
+// long, setting its text doesn't allocate. reserve() makes room for the
+// lines up front.
+//
+//     PanelText text;
+//     text.addf("%d:%02d", hour, minute);
+//     text.applyTo(timePanel);
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <display-panel.h>
+
+#ifndef PANEL_TEXT_LINES
+#define PANEL_TEXT_LINES (4)
+#endif
+#ifndef PANEL_TEXT_LINE_CHARS
+#define PANEL_TEXT_LINE_CHARS (40)
+#endif
+
+class PanelText {
+    public:
+    // Set when a line was cut short or didn't fit.
+    bool truncated = false;
+
+    void clear() {
+        count = 0;
+        truncated = false;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    const char* line(int index) const {
+        return lines[index];
+    }
+
+    // Add a line.
+    PanelText &add(const char* text) {
+        return addf("%s", text);
+    }
+
+    // Add a line, formatted like printf.
+    __attribute__((format(printf, 2, 3)))
+    PanelText &addf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        vaddf(format, args);
+        va_end(args);
+        return *this;
+    }
+
+    PanelText &vaddf(const char* format, va_list args) {
+        if (count == PANEL_TEXT_LINES) {
+            truncated = true;
+            return *this;
+        }
+        lengths[count] = 0;
+        lines[count][0] = '\0';
+        count++;
+        return vappendf(format, args);
+    }
+
+    // Append to the last line, formatted like printf.
+    __attribute__((format(printf, 2, 3)))
+    PanelText &appendf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        vappendf(format, args);
+        va_end(args);
+        return *this;
+    }
+
+    PanelText &vappendf(const char* format, va_list args) {
+        if (count == 0) {
+            return vaddf(format, args);
+        }
+        const int last = count - 1;
+        const int room = sizeof(lines[last]) - lengths[last];
+        const int length = vsnprintf(lines[last] + lengths[last], room, format, args);
+        if (length < 0 || length >= room) {
+            truncated = true;
+            lengths[last] = sizeof(lines[last]) - 1;
+        }
+        else {
+            lengths[last] += length;
+        }
+        return *this;
+    }
+
+    // Add a line with a time, formatted like strftime.
+    PanelText &addTime(esphome::ESPTime &time, const char* format) {
+        if (count == PANEL_TEXT_LINES) {
+            truncated = true;
+            return *this;
+        }
+        // strftime returns 0 (and leaves the line undefined) if it doesn't fit.
+        lengths[count] = time.strftime(lines[count], sizeof(lines[count]), format);
+        if (lengths[count] == 0) {
+            lines[count][0] = '\0';
+            truncated = truncated || format[0] != '\0';
+        }
+        count++;
+        return *this;
+    }
+
+    // Copy lines, such as a panel's text, truncating any too long.
+    PanelText &assign(const std::vector<std::string> &text) {
+        clear();
+        for (const std::string &line : text) {
+            if (count == PANEL_TEXT_LINES) {
+                truncated = true;
+                break;
+            }
+            const size_t length = line.size() < PANEL_TEXT_LINE_CHARS ? line.size() : PANEL_TEXT_LINE_CHARS;
+            truncated = truncated || length < line.size();
+            memcpy(lines[count], line.data(), length);
+            lines[count][length] = '\0';
+            lengths[count] = length;
+            count++;
+        }
+        return *this;
+    }
+
+    // Set the panel's text to these lines.
+    void applyTo(DisplayPanel &panel) const {
+        panel.text.resize(count);
+        for (int i = 0; i < count; i++) {
+            panel.text[i].assign(lines[i], lengths[i]);
+        }
+    }
+
+    /**
+     * Make room for PANEL_TEXT_LINES lines in the text of each panel, so
+     * changing the number of lines doesn't allocate. Call once, from
+     * initializePanels().
+     */
+    static void reserve(std::vector<DisplayPanel*> &panels) {
+        for (DisplayPanel* panel : panels) {
+            panel->text.reserve(PANEL_TEXT_LINES);
+        }
+    }
+
+    private:
+    char lines[PANEL_TEXT_LINES][PANEL_TEXT_LINE_CHARS + 1];
+    uint8_t lengths[PANEL_TEXT_LINES];
+    uint8_t count = 0;
+};
+
+#endif  // PANEL_TEXT_H
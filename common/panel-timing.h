@@ -0,0 +1,213 @@
+#ifndef PANEL_TIMING_H
+#define PANEL_TIMING_H
+
+// Render timing for the panels, to see whether a frame fits the display's
+// update_interval and which panel is slow.
+//
+// Each frame (updatePanelStates() then drawPanels()) is timed with the CPU
+// cycle counter, split into phases (update, clear, draw) and per panel.
+// Frame times go into a fixed histogram (PANEL_TIMING_BUCKETS buckets of
+// 1ms) from which the p50/p99 are read. A frame is due one
+// PANEL_FRAME_BUDGET_US after the last one started (or when expectFrameAt()
+// says, with frame-scheduler.h); one that starts more than a budget after
+// it was due counts the frames it missed as dropped.
+//
+// Define PANEL_TIMING_ENABLED to build it in (add -DPANEL_TIMING_ENABLED
+// to esphome: platformio_options: build_flags). Otherwise the PANEL_TIMING
+// macros compile to nothing and panelTiming only has empty report fields
+// and a takeReport() that does nothing, so the YAML's timing sensors and
+// report interval build either way (and report unknown).
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+#ifdef PANEL_TIMING_ENABLED
+
+#ifndef PANEL_FRAME_BUDGET_US
+#define PANEL_FRAME_BUDGET_US (100000)
+#endif
+#define PANEL_TIMING_BUCKETS (128)
+#define PANEL_TIMING_MAX_PANELS (16)
+
+enum panel_timing_phase_t {
+    PANEL_PHASE_UPDATE,
+    PANEL_PHASE_CLEAR,
+    PANEL_PHASE_DRAW,
+    PANEL_PHASE_COUNT,
+};
+
+#ifdef ARDUINO
+inline uint32_t panel_timing_cycles() {
+    return ESP.getCycleCount();
+}
+
+inline uint32_t panel_timing_cycles_per_us() {
+    return ESP.getCpuFreqMHz();
+}
+#else
+inline uint32_t panel_timing_cycles() {
+    return micros();
+}
+
+inline uint32_t panel_timing_cycles_per_us() {
+    return 1;
+}
+#endif
+
+class PanelTiming {
+    public:
+    // Since the last takeReport().
+    uint16_t frameHistogram[PANEL_TIMING_BUCKETS] = {};
+    uint32_t frames = 0;
+    uint32_t droppedFrames = 0;
+    uint32_t phaseCycles[PANEL_PHASE_COUNT] = {};
+    uint32_t panelMaxCycles[PANEL_TIMING_MAX_PANELS] = {};
+    const char* panelNames[PANEL_TIMING_MAX_PANELS] = {};
+
+    void frameBegin() {
+        frameStartCycles = panel_timing_cycles();
+        const uint32_t nowUs = micros();
+        if (started) {
+            const uint32_t lateUs = nowUs - nextFrameDueUs;
+            if ((int32_t) lateUs > PANEL_FRAME_BUDGET_US) {
+                droppedFrames += lateUs / PANEL_FRAME_BUDGET_US;
+            }
+        }
+        started = true;
+        nextFrameDueUs = nowUs + PANEL_FRAME_BUDGET_US;
+    }
+
+    // The next frame is due at dueUs (micros()) rather than one budget
+    // after the last one.
+    void expectFrameAt(uint32_t dueUs) {
+        nextFrameDueUs = dueUs;
+    }
+
+    void frameEnd() {
+        const uint32_t frameMs = (panel_timing_cycles() - frameStartCycles) / panel_timing_cycles_per_us() / 1000;
+        const int bucket = frameMs < PANEL_TIMING_BUCKETS ? frameMs : PANEL_TIMING_BUCKETS - 1;
+        if (frameHistogram[bucket] == UINT16_MAX) {
+            return;
+        }
+        frameHistogram[bucket]++;
+        frames++;
+    }
+
+    void addPhase(panel_timing_phase_t phase, uint32_t startCycles) {
+        phaseCycles[phase] += panel_timing_cycles() - startCycles;
+    }
+
+    void addPanel(int index, const char* name, uint32_t startCycles) {
+        if (index >= PANEL_TIMING_MAX_PANELS) {
+            return;
+        }
+        const uint32_t cycles = panel_timing_cycles() - startCycles;
+        if (cycles > panelMaxCycles[index]) {
+            panelMaxCycles[index] = cycles;
+            panelNames[index] = name;
+        }
+    }
+
+    // The last report, from takeReport().
+    float reportP50Ms = NAN;
+    float reportP99Ms = NAN;
+    uint32_t reportDroppedFrames = 0;
+    char reportSlowestPanel[40] = "";
+
+    /**
+     * Frame time in ms at the given percentile (0-100), to the 1ms bucket,
+     * or NAN if there were no frames.
+     */
+    float percentileMs(int percentile) {
+        if (frames == 0) {
+            return NAN;
+        }
+        const uint32_t rank = (frames * percentile + 99) / 100;
+        uint32_t seen = 0;
+        for (int b = 0; b < PANEL_TIMING_BUCKETS; b++) {
+            seen += frameHistogram[b];
+            if (seen >= rank && seen > 0) {
+                return b + 1;
+            }
+        }
+        return PANEL_TIMING_BUCKETS;
+    }
+
+    /**
+     * Summarize the frames since the last report into the report fields,
+     * log it, and start a new reporting period.
+     */
+    void takeReport() {
+        reportP50Ms = percentileMs(50);
+        reportP99Ms = percentileMs(99);
+        reportDroppedFrames = droppedFrames;
+        formatSlowestPanel(reportSlowestPanel, sizeof(reportSlowestPanel));
+        ESP_LOGI("panel_timing", "%u frames, p50 %.0fms, p99 %.0fms, %u dropped, slowest %s, update %uus, clear %uus, draw %uus",
+            frames, reportP50Ms, reportP99Ms, droppedFrames, reportSlowestPanel,
+            phaseCycles[PANEL_PHASE_UPDATE] / panel_timing_cycles_per_us(),
+            phaseCycles[PANEL_PHASE_CLEAR] / panel_timing_cycles_per_us(),
+            phaseCycles[PANEL_PHASE_DRAW] / panel_timing_cycles_per_us());
+        memset(frameHistogram, 0, sizeof(frameHistogram));
+        memset(phaseCycles, 0, sizeof(phaseCycles));
+        memset(panelMaxCycles, 0, sizeof(panelMaxCycles));
+        frames = 0;
+        droppedFrames = 0;
+    }
+
+    private:
+    uint32_t frameStartCycles = 0;
+    bool started = false;
+    uint32_t nextFrameDueUs = 0;
+
+    // The panel that took longest to draw, e.g. "timePanel 12.3ms".
+    void formatSlowestPanel(char* text, size_t size) {
+        int slowest = 0;
+        for (int i = 1; i < PANEL_TIMING_MAX_PANELS; i++) {
+            if (panelMaxCycles[i] > panelMaxCycles[slowest]) {
+                slowest = i;
+            }
+        }
+        const float ms = (float) panelMaxCycles[slowest] / panel_timing_cycles_per_us() / 1000;
+        if (panelNames[slowest] != NULL && panelNames[slowest][0] != '\0') {
+            snprintf(text, size, "%s %.1fms", panelNames[slowest], ms);
+        }
+        else {
+            snprintf(text, size, "panel %d %.1fms", slowest, ms);
+        }
+    }
+};
+
+PanelTiming panelTiming;
+
+#define PANEL_TIMING_FRAME_BEGIN() panelTiming.frameBegin()
+#define PANEL_TIMING_FRAME_END() panelTiming.frameEnd()
+#define PANEL_TIMING_START(start) const uint32_t start = panel_timing_cycles()
+#define PANEL_TIMING_PHASE(phase, start) panelTiming.addPhase(phase, start)
+#define PANEL_TIMING_PANEL(index, name, start) panelTiming.addPanel(index, name, start)
+
+#else
+
+class PanelTiming {
+    public:
+    float reportP50Ms = NAN;
+    float reportP99Ms = NAN;
+    uint32_t reportDroppedFrames = 0;
+    char reportSlowestPanel[40] = "";
+
+    void takeReport() {
+    }
+};
+
+PanelTiming panelTiming;
+
+#define PANEL_TIMING_FRAME_BEGIN()
+#define PANEL_TIMING_FRAME_END()
+#define PANEL_TIMING_START(start)
+#define PANEL_TIMING_PHASE(phase, start)
+#define PANEL_TIMING_PANEL(index, name, start)
+
+#endif  // PANEL_TIMING_ENABLED
+
+#endif  // PANEL_TIMING_H
@@ -0,0 +1,116 @@
+#ifndef TIME_SNAPSHOT_H
+#define TIME_SNAPSHOT_H
+
+// The wall clock, sampled once per frame and formatted once per change.
+//
+// Calling now() several times in a frame costs the calendar math each
+// time, and the calls can straddle a second (or minute) boundary: read
+// the hour at 10:59:59 and the minute at 11:00:00 and the clock shows
+// 10:00. Formatting the same minute with strftime or printf every frame
+// repeats work whose result only changes once a minute.
+//
+// A TimeSnapshot is ticked at the start of a frame with one now() and the
+// frame reads everything from it. The second fields are only recomputed
+// when the second changes; the minute fields (hour, minute, the 12 hour
+// clock text and the day, month and date names) only when the minute
+// does, which includes the clock being set.
+//
+//     if (timeSnapshot.tick(esptime->now())) {
+//         timeText.add(timeSnapshot.hourMinute);
+//     }
+
+#include <stdint.h>
+#include <stdio.h>
+
+class TimeSnapshot {
+    public:
+    // The time sampled by the last tick().
+    esphome::ESPTime now;
+    // Set by the last tick(): the second, or the minute, differs from the
+    // tick before it. The first tick sets both.
+    bool secondChanged = false;
+    bool minuteChanged = false;
+
+    // Updated when the minute changes.
+    int hour = 0;                   // 0..23
+    int hour12 = 12;                // 1..12
+    bool pm = false;
+    int minute = 0;
+    uint8_t hourBcd = 0x12;         // hour12, tens in the high nibble
+    uint8_t minuteBcd = 0;
+    char hourMinute[8] = "";        // "7:05"
+    char hourDotMinute[8] = "";     // "07.05", like strftime("%I.%M")
+    char dayName[4] = "";           // "Mon"
+    char dayNameLong[10] = "";      // "Monday"
+    char monthName[4] = "";         // "Jan"
+    char dayOfMonth[3] = "";        // "9"
+
+    // Updated when the second changes.
+    int second = 0;
+    uint8_t secondBcd = 0;
+
+    // Diagnostics. Ticks, and the times they recomputed the minute fields.
+    uint32_t ticks = 0;
+    uint32_t minuteRecomputes = 0;
+
+    /**
+     * Take a new sample of the clock (one now()). Returns minuteChanged:
+     * whether text built from the minute fields needs rebuilding.
+     */
+    bool tick(const esphome::ESPTime &time) {
+        const bool first = ticks == 0;
+        ticks++;
+        now = time;
+        secondChanged = first || time.timestamp != lastTimestamp;
+        minuteChanged = first || time.timestamp / 60 != lastTimestamp / 60;
+        lastTimestamp = time.timestamp;
+        if (secondChanged) {
+            second = time.second;
+            secondBcd = toBcd(second);
+        }
+        if (minuteChanged) {
+            updateMinute();
+            minuteRecomputes++;
+        }
+        return minuteChanged;
+    }
+
+    // The seconds until the minute rolls over, from the last sample.
+    int secondsToNextMinute() const {
+        return 60 - second;
+    }
+
+    // Two digit BCD: tens in the high nibble, ones in the low.
+    static uint8_t toBcd(int value) {
+        return ((value / 10) << 4) | (value % 10);
+    }
+
+    private:
+    time_t lastTimestamp = 0;
+
+    void updateMinute() {
+        hour = now.hour;
+        pm = hour >= 12;
+        hour12 = hour == 0 ? 12 :
+            hour > 12 ? hour - 12 : hour;
+        minute = now.minute;
+        hourBcd = toBcd(hour12);
+        minuteBcd = toBcd(minute);
+        snprintf(hourMinute, sizeof(hourMinute), "%d:%02d", hour12 % 100, minute % 60);
+        snprintf(hourDotMinute, sizeof(hourDotMinute), "%02d.%02d", hour12 % 100, minute % 60);
+        // The names depend on the date, so only change with the minute.
+        // strftime returns 0 (and leaves the text undefined) if it doesn't fit.
+        if (now.strftime(dayName, sizeof(dayName), "%a") == 0) {
+            dayName[0] = '\0';
+        }
+        if (now.strftime(dayNameLong, sizeof(dayNameLong), "%A") == 0) {
+            dayNameLong[0] = '\0';
+        }
+        if (now.strftime(monthName, sizeof(monthName), "%b") == 0) {
+            monthName[0] = '\0';
+        }
+        snprintf(dayOfMonth, sizeof(dayOfMonth), "%d", now.day_of_month % 100);
+    }
+};
+
+#endif  // TIME_SNAPSHOT_H
@@ -1,11 +1,16 @@
-#include <sstream>
 #include <display-panel.h>
+#include "panel-text.h"
+#include "panel-layout.h"
+#include "frame-scheduler.h"
+#include "time-snapshot.h"
 
 // The display/lcd we are working with. Defined in initializePanels().
 esphome::display::Display* lcd = NULL;
 
-// For sprintf calls.
-char buffer[25];
+// Renders a frame only when the screen can change. See frame-scheduler.h.
+FrameScheduler frameScheduler;
+// The clock, sampled once per frame. See time-snapshot.h.
+TimeSnapshot timeSnapshot;
 
 #define TIME_WIDTH 92
 #define TIME_HEIGHT 37
@@ -21,15 +26,62 @@ char buffer[25];
 #define DATE_HEIGHT 14
 #define TOTAL_WIDTH (TIME_WIDTH + TEMP_WIDTH)
 
-// The Panels used by this app
-DisplayPanel timePanel(0, 0, TIME_WIDTH, TIME_HEIGHT);
-DisplayPanel alarmPanel(0, TIME_HEIGHT, ALARM_WIDTH, ALARM_HEIGHT);
-DisplayPanel datePanel(0, TIME_HEIGHT + ALARM_HEIGHT, DATE_WIDTH, DATE_HEIGHT);
+// The panels placed by the layouts below, in their order.
+enum layout_panel_t {
+    TIME_PANEL,
+    ALARM_PANEL,
+    DATE_PANEL,
+    INSIDE_LABEL_PANEL,
+    INSIDE_TEMP_PANEL,
+    OUTDOOR_LABEL_PANEL,
+    OUTDOOR_TEMP_PANEL,
+    LAYOUT_PANELS,
+};
 
-DisplayPanel insideLabelPanel(TIME_WIDTH, 0, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT);
-DisplayPanel insideTempPanel(TIME_WIDTH, TEMP_LABEL_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT);
-DisplayPanel outdoorLabelPanel(TIME_WIDTH, TEMP_LABEL_HEIGHT + TEMP_HEIGHT, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT);
-DisplayPanel outdoorTempPanel(TIME_WIDTH, (TEMP_LABEL_HEIGHT * 2) + TEMP_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT);
+// Where the panels go. See panel-layout.h. X, Y, W, H
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_TEMPS = {{
+    {0, 0, TIME_WIDTH, TIME_HEIGHT},
+    {0, TIME_HEIGHT, ALARM_WIDTH, ALARM_HEIGHT},
+    {0, TIME_HEIGHT + ALARM_HEIGHT, DATE_WIDTH, DATE_HEIGHT},
+    {TIME_WIDTH, 0, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT},
+    {TIME_WIDTH, TEMP_LABEL_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT},
+    {TIME_WIDTH, TEMP_LABEL_HEIGHT + TEMP_HEIGHT, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT},
+    {TIME_WIDTH, (TEMP_LABEL_HEIGHT * 2) + TEMP_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT},
+}};
+
+// If we don't have a temperature state, just show time.
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_ONLY = {{
+    {0, 0, TOTAL_WIDTH, TIME_HEIGHT},
+    {0, TIME_HEIGHT, TOTAL_WIDTH, ALARM_HEIGHT},
+    {0, TIME_HEIGHT + ALARM_HEIGHT, TOTAL_WIDTH, DATE_HEIGHT},
+    LAYOUT_HIDDEN,
+    LAYOUT_HIDDEN,
+    LAYOUT_HIDDEN,
+    LAYOUT_HIDDEN,
+}};
+
+// Switching between the layouts moves every panel, and the area to
+// repaint is the whole 128x64 screen: drawPanels() draws every panel each
+// frame anyway (the ssd1306 clears its buffer), so a switch costs nothing
+// extra.
+static_assert(layoutChanges(LAYOUT_TIME_ONLY, LAYOUT_TIME_TEMPS) == (1u << LAYOUT_PANELS) - 1,
+    "a layout switch moves every panel");
+static_assert(layoutSame(layoutChangedBounds(LAYOUT_TIME_ONLY, LAYOUT_TIME_TEMPS),
+    layout_rect_t{0, 0, TOTAL_WIDTH, TIME_HEIGHT + ALARM_HEIGHT + DATE_HEIGHT}),
+    "a layout switch repaints the whole screen");
+
+// The layout the panels are in. See switchLayout().
+const panel_layout_t<LAYOUT_PANELS>* shownLayout = NULL;
+
+// The Panels used by this app, placed by switchLayout()
+DisplayPanel timePanel(0, 0, 0, 0);
+DisplayPanel alarmPanel(0, 0, 0, 0);
+DisplayPanel datePanel(0, 0, 0, 0);
+
+DisplayPanel insideLabelPanel(0, 0, 0, 0);
+DisplayPanel insideTempPanel(0, 0, 0, 0);
+DisplayPanel outdoorLabelPanel(0, 0, 0, 0);
+DisplayPanel outdoorTempPanel(0, 0, 0, 0);
 
 std::vector<DisplayPanel*> panels = {
     &timePanel,
@@ -41,12 +93,35 @@ std::vector<DisplayPanel*> panels = {
     &outdoorTempPanel
 };
 
+// The panels the layouts place, in layout_panel_t order.
+std::array<DisplayPanel*, LAYOUT_PANELS> layoutPanels = {{
+    &timePanel,
+    &alarmPanel,
+    &datePanel,
+    &insideLabelPanel,
+    &insideTempPanel,
+    &outdoorLabelPanel,
+    &outdoorTempPanel,
+}};
+
 std::vector<std::string> insideLabelText = {"room"};
 std::vector<std::string> outdoorLabelText = {"outside"};
 std::vector<std::string> blankText = {};
 
+// Render a frame when an input of the panels changes.
+void watchPanelInputs() {
+    next_alarm->add_on_state_callback([](std::string) { frameScheduler.requestFrame(); });
+    wind_speed->add_on_state_callback([](float) { frameScheduler.requestFrame(); });
+    wind_gust_speed->add_on_state_callback([](float) { frameScheduler.requestFrame(); });
+    wind_direction->add_on_state_callback([](std::string) { frameScheduler.requestFrame(); });
+    inside_temperature->add_on_state_callback([](float) { frameScheduler.requestFrame(); });
+    back_yard_temperature->add_on_state_callback([](float) { frameScheduler.requestFrame(); });
+}
+
 void initializePanels(esphome::display::Display &display) {
     lcd = &display;
+    PanelText::reserve(panels);
+    switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_ONLY);
 
     timePanel.font = font_time;
     timePanel.color = Color::BLACK;
@@ -77,82 +152,69 @@ void initializePanels(esphome::display::Display &display) {
     outdoorTempPanel.font = font_temp;
     outdoorTempPanel.color = Color::BLACK;
     outdoorTempPanel.textColor = Color::WHITE;
+
+    watchPanelInputs();
 }
 
 void updatePanelStates() {
-    // Time      
-    auto now = esptime->now();
-    int hour = now.hour;
-    int minute = now.minute;
-    bool is_pm = hour >= 12;
-    hour = hour == 0 ? 12 : 
-        hour > 12 ? hour - 12 : hour;
-    sprintf(buffer, "%d:%02d", hour, minute);
-    std::vector<std::string> timeText = { buffer };
-    timePanel.text = timeText;
+    // Time and date, when the minute rolls over (or the clock is set)
+    if (timeSnapshot.tick(esptime->now())) {
+        PanelText timeText;
+        timeText.add(timeSnapshot.hourMinute).applyTo(timePanel);
+
+        PanelText dateText;
+        dateText.addf("%s/%s %s", timeSnapshot.dayName, timeSnapshot.monthName, timeSnapshot.dayOfMonth)
+            .applyTo(datePanel);
+    }
 
     // Next alarm in room
     if (next_alarm->has_state() && next_alarm->state != "unavailable") {
-        sprintf(buffer, "%s", next_alarm->state.c_str());
-        std::vector<std::string> alarmText = { buffer };
-        alarmPanel.text = alarmText;
+        PanelText alarmText;
+        alarmText.add(next_alarm->state.c_str()).applyTo(alarmPanel);
     }
     else {
         if (wind_speed->has_state() && wind_speed->state < 200) {
-            std::stringstream ss;
-            ss << "Wind " << value_accuracy_to_string(wind_speed->state, 0);
+            PanelText windText;
+            windText.addf("Wind %.0f", wind_speed->state);
             if (wind_gust_speed->has_state()) {
-                ss << "-" << value_accuracy_to_string(wind_gust_speed->state, 0);
+                windText.appendf("-%.0f", wind_gust_speed->state);
             }
             if (wind_direction->has_state()) {
-                ss << " " << wind_direction->state.c_str();
+                windText.appendf(" %s", wind_direction->state.c_str());
             }
-            alarmPanel.text = { ss.str() };
+            windText.applyTo(alarmPanel);
         }
         else {
-            alarmPanel.text = { "" };
+            PanelText emptyText;
+            emptyText.add("").applyTo(alarmPanel);
         }
     }
-    // Date
-    std::string monthName = now.strftime("%a/%b");
-    sprintf(buffer, "%s %d", monthName.c_str(), now.day_of_month);
-    std::vector<std::string> dateText = { buffer };
-    datePanel.text = dateText;
-
     if (back_yard_temperature->has_state() || inside_temperature->has_state()) {
-        timePanel.w = TIME_WIDTH;
-        datePanel.w = DATE_WIDTH;
-        alarmPanel.w = ALARM_WIDTH;
-        insideTempPanel.enabled = true;
-        outdoorTempPanel.enabled = true;
-        insideLabelPanel.enabled = true;
-        outdoorLabelPanel.enabled = true;
+        switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_TEMPS);
         if (inside_temperature->has_state()) {
             // Temperature
-            sprintf(buffer, "%.0f°", inside_temperature->state);
-            std::vector<std::string> tempText = { buffer };
-            insideTempPanel.text = tempText;
+            PanelText tempText;
+            tempText.addf("%.0f°", inside_temperature->state).applyTo(insideTempPanel);
         }
         if (back_yard_temperature->has_state()) {
             // Temperature
-            sprintf(buffer, "%.0f°", back_yard_temperature->state);
-            std::vector<std::string> tempText = { buffer };
-            outdoorTempPanel.text = tempText;
+            PanelText tempText;
+            tempText.addf("%.0f°", back_yard_temperature->state).applyTo(outdoorTempPanel);
         }
     }
     else {
-        // If we don't have a temperature state, just show time.
-        timePanel.w = TOTAL_WIDTH;
-        datePanel.w = TOTAL_WIDTH;
-        alarmPanel.w = TOTAL_WIDTH;
-        insideTempPanel.enabled = false;
-        outdoorTempPanel.enabled = false;
-        insideLabelPanel.enabled = false;
-        outdoorLabelPanel.enabled = false;
+        switchLayout(layoutPanels, shownLayout, LAYOUT_TIME_ONLY);
     }
 }
 
+// Ask for the next frame when the minute (and so maybe the date) rolls
+// over, the only change to the screen that no input announces.
+void scheduleNextFrame() {
+    frameScheduler.frameIn(timeSnapshot.secondsToNextMinute() * 1000);
+}
+
 // Draw all of the panels
 void drawPanels() {
     DisplayPanel::drawAllPanels(*lcd, panels);
+    scheduleNextFrame();
 }
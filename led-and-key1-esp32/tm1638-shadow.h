@@ -0,0 +1,349 @@
+#ifndef TM1638_SHADOW_H
+#define TM1638_SHADOW_H
+
+// Drives the TM1638 LED&KEY board, sending only what changed.
+//
+// ESPHome's tm1638 component rewrites all 8 digits and the intensity on
+// every display update (each digit its own 3 byte transaction), and
+// reads the buttons on every loop, all bit-banged over DIO/CLK/STB.
+//
+// Tm1638Shadow keeps a shadow of the chip's 16 display registers (the
+// digits at even addresses, the LEDs at odd) and the intensity. print(),
+// setLed() and setIntensity() only change the shadow. tick() does one
+// pass over the bus: the changed registers, in as few auto-incrementing
+// writes as it can, the intensity if it changed, then the button read.
+// Call it every TM1638_SHADOW_TICK_MS.
+//
+// On the host (no ARDUINO) Tm1638Bus emulates the chip instead of
+// driving pins, and counts the same clock cycles.
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef TM1638_SHADOW_TICK_MS
+#define TM1638_SHADOW_TICK_MS (30)
+#endif
+
+#define TM1638_DATA_WRITE (0x40)
+#define TM1638_DATA_READ_KEYS (0x42)
+#define TM1638_DATA_FIXED (0x44)
+#define TM1638_DISPLAY_OFF (0x80)
+#define TM1638_DISPLAY_ON (0x88)
+#define TM1638_ADDRESS (0xC0)
+#define TM1638_REGISTERS (16)
+#define TM1638_DIGITS (8)
+#define TM1638_DOT (0x80)
+
+// Segments (a = bit 0 .. g = bit 6) for ASCII 0x20 to 0x7F.
+static const uint8_t TM1638_FONT[96] = {
+    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x52,  //  !"#$%&'()*+,-./
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x48, 0x00, 0x53,  // 0123456789:;<=>?
+    0x00, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x3D, 0x76, 0x30, 0x1E, 0x76, 0x38, 0x37, 0x37, 0x3F,  // @ABCDEFGHIJKLMNO
+    0x73, 0x67, 0x50, 0x6D, 0x78, 0x3E, 0x3E, 0x3E, 0x76, 0x6E, 0x5B, 0x39, 0x64, 0x0F, 0x23, 0x08,  // PQRSTUVWXYZ[\]^_
+    0x20, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71, 0x6F, 0x74, 0x10, 0x0E, 0x76, 0x30, 0x54, 0x54, 0x5C,  // `abcdefghijklmno
+    0x73, 0x67, 0x50, 0x6D, 0x78, 0x1C, 0x1C, 0x1C, 0x76, 0x6E, 0x5B, 0x39, 0x30, 0x0F, 0x01, 0x00,  // pqrstuvwxyz{|}~
+};
+
+// The DIO/CLK/STB bus: bytes LSB first, a transaction per STB low.
+class Tm1638Bus {
+    public:
+    // Diagnostics. CLK cycles (8 per byte) and transactions.
+    uint32_t clockCycles = 0;
+    uint32_t transactions = 0;
+
+    Tm1638Bus(int stbPin_, int clkPin_, int dioPin_) : stbPin(stbPin_), clkPin(clkPin_), dioPin(dioPin_) {}
+
+    void setup() {
+#ifdef ARDUINO
+        pinMode(stbPin, OUTPUT);
+        pinMode(clkPin, OUTPUT);
+        pinMode(dioPin, OUTPUT);
+        digitalWrite(stbPin, HIGH);
+        digitalWrite(clkPin, HIGH);
+#endif
+    }
+
+    void start() {
+        transactions++;
+#ifdef ARDUINO
+        digitalWrite(stbPin, LOW);
+        delayMicroseconds(1);
+#else
+        hostFirstByte = true;
+#endif
+    }
+
+    void stop() {
+#ifdef ARDUINO
+        digitalWrite(stbPin, HIGH);
+        delayMicroseconds(1);
+#endif
+    }
+
+    void write(uint8_t value) {
+        clockCycles += 8;
+#ifdef ARDUINO
+        for (int bit = 0; bit < 8; bit++) {
+            digitalWrite(clkPin, LOW);
+            digitalWrite(dioPin, (value >> bit) & 1);
+            delayMicroseconds(1);
+            digitalWrite(clkPin, HIGH);
+            delayMicroseconds(1);
+        }
+#else
+        hostWrite(value);
+#endif
+    }
+
+    // Read a byte of a key scan, after writing TM1638_DATA_READ_KEYS.
+    uint8_t read() {
+        clockCycles += 8;
+#ifdef ARDUINO
+        uint8_t value = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            digitalWrite(clkPin, LOW);
+            delayMicroseconds(1);
+            value |= digitalRead(dioPin) << bit;
+            digitalWrite(clkPin, HIGH);
+            delayMicroseconds(1);
+        }
+        return value;
+#else
+        // Key i in bit 0 of byte i, key i + 4 in bit 4.
+        const int index = hostReadIndex++;
+        return ((hostKeys >> index) & 1) | (((hostKeys >> (index + 4)) & 1) << 4);
+#endif
+    }
+
+    // Hand DIO to the chip for reading, and take it back.
+    void beginRead() {
+#ifdef ARDUINO
+        pinMode(dioPin, INPUT_PULLUP);
+        delayMicroseconds(2);
+#else
+        hostReadIndex = 0;
+#endif
+    }
+
+    void endRead() {
+#ifdef ARDUINO
+        pinMode(dioPin, OUTPUT);
+#endif
+    }
+
+    // A transaction of one command byte.
+    void command(uint8_t value) {
+        start();
+        write(value);
+        stop();
+    }
+
+#ifndef ARDUINO
+    // The emulated chip: its registers, its display control byte (-1
+    // until set) and the keys held down (bit i is key i).
+    uint8_t hostRegisters[TM1638_REGISTERS] = {};
+    int hostDisplayControl = -1;
+    uint8_t hostKeys = 0;
+#endif
+
+    private:
+    int stbPin;
+    int clkPin;
+    int dioPin;
+#ifndef ARDUINO
+    bool hostFirstByte = false;
+    bool hostFixed = false;
+    int hostAddress = 0;
+    int hostReadIndex = 0;
+
+    void hostWrite(uint8_t value) {
+        if (!hostFirstByte) {
+            hostRegisters[hostAddress % TM1638_REGISTERS] = value;
+            hostAddress += hostFixed ? 0 : 1;
+            return;
+        }
+        hostFirstByte = false;
+        if ((value & 0xC0) == TM1638_DATA_WRITE) {
+            hostFixed = value & 0x04;
+        }
+        else if ((value & 0xC0) == TM1638_DISPLAY_OFF) {
+            hostDisplayControl = value;
+        }
+        else if ((value & 0xC0) == TM1638_ADDRESS) {
+            hostAddress = value & 0x0F;
+        }
+    }
+#endif
+};
+
+class Tm1638Shadow {
+    public:
+    Tm1638Bus bus;
+    // Diagnostics. Bus clock cycles per second, from takeReport().
+    float reportClockCyclesPerSecond = 0;
+
+    Tm1638Shadow(int stbPin, int clkPin, int dioPin) : bus(stbPin, clkPin, dioPin) {}
+
+    // Set up the pins. The first tick() writes every register.
+    void setup() {
+        bus.setup();
+        reportStartMs = millis();
+    }
+
+    /**
+     * Show text on the digits from the left, blanking the rest, as the
+     * tm1638 component prints: a '.' lights the decimal point of the
+     * digit before it.
+     */
+    void print(const char* text) {
+        encode(text, wanted);
+    }
+
+    __attribute__((format(printf, 2, 3)))
+    void printf(const char* format, ...) {
+        char text[TM1638_DIGITS * 2 + 1];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(text, sizeof(text), format, args);
+        va_end(args);
+        print(text);
+    }
+
+    void setLed(int led, bool on) {
+        wanted[led * 2 + 1] = on ? 1 : 0;
+    }
+
+    // 1..7, or 0 to turn the display off (as the tm1638 component does).
+    void setIntensity(int level) {
+        wantedIntensity = level;
+    }
+
+    // Key i is held down, as of the last tick().
+    bool key(int index) const {
+        return (keys >> index) & 1;
+    }
+
+    // Changes not sent yet.
+    bool pending() const {
+        return !chipKnown || wantedIntensity != shownIntensity || memcmp(wanted, shown, sizeof(wanted)) != 0;
+    }
+
+    // One pass over the bus: send the changes, then read the keys.
+    void tick() {
+        flush();
+        scanKeys();
+    }
+
+    /**
+     * Turn the bus clock cycles since the last report into
+     * reportClockCyclesPerSecond, and start counting again.
+     */
+    void takeReport() {
+        const uint32_t now = millis();
+        const float seconds = (now - reportStartMs) / 1000.0f;
+        reportClockCyclesPerSecond = seconds > 0 ? bus.clockCycles / seconds : 0;
+        bus.clockCycles = 0;
+        reportStartMs = now;
+    }
+
+    /**
+     * Encode text into the display registers (digits at the even
+     * addresses) of registers. The LEDs are left alone.
+     */
+    static void encode(const char* text, uint8_t* registers) {
+        int digit = 0;
+        bool dotted = false;
+        for (const char* c = text; *c != '\0'; c++) {
+            if (*c == '.' && digit > 0 && !dotted) {
+                registers[(digit - 1) * 2] |= TM1638_DOT;
+                dotted = true;
+                continue;
+            }
+            if (digit == TM1638_DIGITS) {
+                break;
+            }
+            const uint8_t ascii = (uint8_t) *c;
+            registers[digit * 2] = *c == '.' ? TM1638_DOT :
+                ascii >= 0x20 && ascii < 0x80 ? TM1638_FONT[ascii - 0x20] : 0;
+            dotted = *c == '.';
+            digit++;
+        }
+        for (; digit < TM1638_DIGITS; digit++) {
+            registers[digit * 2] = 0;
+        }
+    }
+
+    private:
+    uint8_t wanted[TM1638_REGISTERS] = {};
+    // What the chip holds, once chipKnown.
+    uint8_t shown[TM1638_REGISTERS] = {};
+    bool chipKnown = false;
+    int wantedIntensity = 1;
+    int shownIntensity = -1;
+    uint8_t keys = 0;
+    uint32_t reportStartMs = 0;
+
+    bool changed(int address) const {
+        return !chipKnown || wanted[address] != shown[address];
+    }
+
+    void flush() {
+        bool dataCommandSent = false;
+        int address = 0;
+        while (address < TM1638_REGISTERS) {
+            if (!changed(address)) {
+                address++;
+                continue;
+            }
+            // A run of changed registers, bridging single unchanged ones:
+            // resending one costs a byte, as a new address would, but
+            // saves a transaction.
+            int end = address + 1;
+            while (end < TM1638_REGISTERS) {
+                if (changed(end)) {
+                    end++;
+                }
+                else if (end + 1 < TM1638_REGISTERS && changed(end + 1)) {
+                    end += 2;
+                }
+                else {
+                    break;
+                }
+            }
+            if (!dataCommandSent) {
+                // The key scan leaves the chip in read mode.
+                bus.command(TM1638_DATA_WRITE);
+                dataCommandSent = true;
+            }
+            bus.start();
+            bus.write(TM1638_ADDRESS | address);
+            for (; address < end; address++) {
+                bus.write(wanted[address]);
+                shown[address] = wanted[address];
+            }
+            bus.stop();
+        }
+        chipKnown = true;
+        if (wantedIntensity != shownIntensity) {
+            bus.command(wantedIntensity > 0 ? TM1638_DISPLAY_ON | (wantedIntensity & 7) : TM1638_DISPLAY_OFF);
+            shownIntensity = wantedIntensity;
+        }
+    }
+
+    void scanKeys() {
+        bus.start();
+        bus.write(TM1638_DATA_READ_KEYS);
+        bus.beginRead();
+        uint8_t scanned = 0;
+        for (int i = 0; i < 4; i++) {
+            scanned |= bus.read() << i;
+        }
+        bus.endRead();
+        bus.stop();
+        keys = scanned;
+    }
+};
+
+#endif  // TM1638_SHADOW_H
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+##
+## Decode the output of the dump_person_sensor_trace service.
+##
+## Usage: decode-trace.py < log.txt
+##
+## Reads the ESPHome log (as text), finds the "trace now=..." and
+## "record <hex>" lines written by PersonSensorTrace::dump() and prints
+## one line per record. See person_sensor/person_sensor_trace.h for the
+## record layout.
+##
+
+import re
+import sys
+
+TIME_SIZE = 4
+HEADER_SIZE = TIME_SIZE + 1
+FACE_SIZE = 3
+
+
+def nibble_to_coord(nibble):
+    # Boxes are stored on a 0-15 scale. Use the middle of the bucket.
+    return nibble * 16 + 8
+
+
+def decode(lines):
+    now_ms = None
+    records = []
+    for line in lines:
+        match = re.search(r"trace now=(\d+) records=\d+", line)
+        if match:
+            now_ms = int(match.group(1))
+            records = []
+            continue
+        match = re.search(r"record ([0-9a-f]+)", line)
+        if match:
+            records.append(bytes.fromhex(match.group(1)))
+
+    if now_ms is None:
+        sys.exit("No 'trace now=' line found.")
+
+    # Record times are millis(), which wraps after ~49.7 days. Work
+    # backwards from the newest record to unwrap them relative to now;
+    # records from before the last wrap come out negative.
+    later_ms = now_ms
+    times = []
+    for record in reversed(records):
+        record_ms = int.from_bytes(record[:TIME_SIZE], "little")
+        later_ms -= (later_ms - record_ms) & 0xFFFFFFFF
+        times.append(later_ms)
+    times.reverse()
+
+    for time_ms, record in zip(times, records):
+        num_faces = record[TIME_SIZE] & 0x07
+        present = bool(record[TIME_SIZE] & 0x08)
+        faces = []
+        for i in range(num_faces):
+            face = record[HEADER_SIZE + i * FACE_SIZE:HEADER_SIZE + (i + 1) * FACE_SIZE]
+            faces.append("conf=%d (l=%d, t=%d, r=%d, b=%d) %s" % (
+                (face[2] & 0x7F) * 2,
+                nibble_to_coord(face[0] >> 4), nibble_to_coord(face[0] & 0x0F),
+                nibble_to_coord(face[1] >> 4), nibble_to_coord(face[1] & 0x0F),
+                "facing" if face[2] & 0x80 else "not facing"))
+        print("t=%9.1fs %s faces=%d %s" % (
+            time_ms / 1000.0, "PRESENT" if present else "empty  ", num_faces, "; ".join(faces)))
+
+
+if __name__ == "__main__":
+    decode(sys.stdin)
@@ -0,0 +1,238 @@
+// Checks person_sensor_validate() (person_sensor.h) and measures what it
+// costs, on Linux.
+//
+// It checks person_sensor_crc16() against the CRC-16/CCITT-FALSE check value and a
+// bit-at-a-time CRC, and person_sensor_validate() against packets built
+// here: good ones, and ones with each field the validation covers broken.
+//
+// Given a log with dump_person_sensor_frames output, it also counts how
+// many of the recorded packets pass. That shows whether the sensor sends
+// this CRC, over these bytes: the device rejects every packet that
+// doesn't (unless built with PERSON_SENSOR_SKIP_CHECKSUM). It fails if
+// more than CAPTURE_MAX_BAD_PCT of the otherwise good packets have a bad
+// checksum, and then counts which of a few other CRC16 variants they
+// match, as a lead.
+//
+// Then it times person_sensor_crc16() and person_sensor_validate() per
+// packet. See README.md to build.
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "person_sensor.h"
+#include "recorded-frames.h"
+
+#define BENCHMARK_PACKETS (1000000)
+// More bad checksums than this (as a percentage) in a capture means the
+// CRC doesn't match the sensor's, rather than a few corrupted reads.
+#define CAPTURE_MAX_BAD_PCT (10)
+
+// CRC-16/CCITT-FALSE a bit at a time, to check the table against.
+uint16_t crc16Bitwise(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// A well formed packet with faces faces, checksummed.
+person_sensor_results_t buildPacket(int faces) {
+    person_sensor_results_t results = {};
+    results.header.data_size = PERSON_SENSOR_MAX_DATA_SIZE;
+    results.num_faces = faces;
+    for (int i = 0; i < faces; i++) {
+        person_sensor_face_t &face = results.faces[i];
+        face.box_confidence = 90 - i * 10;
+        face.box_left = 40 + i * 50;
+        face.box_top = 60;
+        face.box_right = 80 + i * 50;
+        face.box_bottom = 120;
+        face.id_confidence = 0;
+        face.id = -1;
+        face.is_facing = i == 0;
+    }
+    results.checksum = person_sensor_crc16((const uint8_t*) &results, offsetof(person_sensor_results_t, checksum));
+    return results;
+}
+
+struct packet_vector_t {
+    const char* name;
+    person_sensor_results_t results;
+    person_sensor_validation_t expected;
+};  // A packet and what person_sensor_validate() should say
+
+std::vector<packet_vector_t> buildVectors() {
+    std::vector<packet_vector_t> vectors;
+    for (int faces = 0; faces <= PERSON_SENSOR_MAX_FACES_COUNT; faces++) {
+        vectors.push_back({"good", buildPacket(faces), PERSON_SENSOR_VALID});
+    }
+    packet_vector_t broken = {"data_size 0", buildPacket(1), PERSON_SENSOR_BAD_DATA_SIZE};
+    broken.results.header.data_size = 0;
+    vectors.push_back(broken);
+    broken = {"data_size 41", buildPacket(1), PERSON_SENSOR_BAD_DATA_SIZE};
+    broken.results.header.data_size = PERSON_SENSOR_MAX_DATA_SIZE + 1;
+    vectors.push_back(broken);
+    broken = {"num_faces -1", buildPacket(0), PERSON_SENSOR_BAD_NUM_FACES};
+    broken.results.num_faces = -1;
+    vectors.push_back(broken);
+    broken = {"num_faces 5", buildPacket(4), PERSON_SENSOR_BAD_NUM_FACES};
+    broken.results.num_faces = PERSON_SENSOR_MAX_FACES_COUNT + 1;
+    vectors.push_back(broken);
+    // Every single bit flip must be caught by the checksum, except in
+    // data_size and num_faces, which are checked first.
+    for (size_t bit = 0; bit < sizeof(person_sensor_results_t) * 8; bit++) {
+        const size_t byte = bit / 8;
+        if (byte >= offsetof(person_sensor_results_t, header.data_size) &&
+                byte < offsetof(person_sensor_results_t, faces)) {
+            continue;
+        }
+        broken = {"bit flip", buildPacket(2), PERSON_SENSOR_BAD_CHECKSUM};
+        ((uint8_t*) &broken.results)[byte] ^= 1 << (bit % 8);
+        vectors.push_back(broken);
+    }
+    return vectors;
+}
+
+// Returns the number of failures.
+int checkVectors() {
+    int failures = 0;
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    if (person_sensor_crc16(check, sizeof(check)) != 0x29B1) {
+        printf("person_sensor_crc16(\"123456789\") is 0x%04X, not 0x29B1\n", person_sensor_crc16(check, sizeof(check)));
+        failures++;
+    }
+    for (int value = 0; value < 256; value++) {
+        const uint8_t data[2] = {(uint8_t) value, (uint8_t) (255 - value)};
+        if (person_sensor_crc16(data, sizeof(data)) != crc16Bitwise(data, sizeof(data))) {
+            printf("person_sensor_crc16() differs from the bitwise CRC at 0x%02X\n", value);
+            failures++;
+        }
+    }
+    const std::vector<packet_vector_t> vectors = buildVectors();
+    for (const packet_vector_t &vector : vectors) {
+        const person_sensor_validation_t validation = person_sensor_validate(&vector.results);
+        if (validation != vector.expected) {
+            printf("%s: reason=%d, expected %d\n", vector.name, validation, vector.expected);
+            failures++;
+        }
+    }
+    printf("Checked the CRC and %u packets: %d failures.\n", (unsigned int) vectors.size(), failures);
+    return failures;
+}
+
+struct crc_variant_t {
+    const char* name;
+    uint16_t init;
+    size_t first;
+    bool swapped;
+};  // Another CRC16 the sensor might send
+
+static const crc_variant_t CRC_VARIANTS[] = {
+    {"CCITT-FALSE, checksum big endian", 0xFFFF, 0, true},
+    {"XMODEM (init 0)", 0x0000, 0, false},
+    {"CCITT-FALSE from byte 2", 0xFFFF, 2, false},
+    {"CCITT-FALSE from byte 4", 0xFFFF, 4, false},
+};
+
+uint16_t crc16Variant(const crc_variant_t &variant, const uint8_t* data, size_t length) {
+    uint16_t crc = variant.init;
+    for (size_t i = variant.first; i < length; i++) {
+        crc = (crc << 8) ^ person_sensor_crc16_table[(crc >> 8) ^ data[i]];
+    }
+    return crc;
+}
+
+// Returns false if the capture's checksums don't fit the CRC.
+bool checkCapture(const char* path) {
+    std::vector<recorded_frame_t> frames;
+    if (!readFrames(path, frames)) {
+        return false;
+    }
+    int counts[PERSON_SENSOR_BAD_CHECKSUM + 1] = {};
+    int shown = 0;
+    for (const recorded_frame_t &frame : frames) {
+        const person_sensor_results_t* results = (const person_sensor_results_t*) frame.bytes;
+        const person_sensor_validation_t validation = person_sensor_validate(results);
+        counts[validation]++;
+        if (validation == PERSON_SENSOR_BAD_CHECKSUM && shown++ < 3) {
+            printf("t=%u: checksum 0x%04X, CRC 0x%04X\n", frame.ms, results->checksum,
+                person_sensor_crc16(frame.bytes, offsetof(person_sensor_results_t, checksum)));
+        }
+    }
+    printf("%s: %u packets, %d pass, %d bad data_size, %d bad num_faces, %d bad checksum.\n", path,
+        (unsigned int) frames.size(), counts[PERSON_SENSOR_VALID], counts[PERSON_SENSOR_BAD_DATA_SIZE],
+        counts[PERSON_SENSOR_BAD_NUM_FACES], counts[PERSON_SENSOR_BAD_CHECKSUM]);
+    const int checked = counts[PERSON_SENSOR_VALID] + counts[PERSON_SENSOR_BAD_CHECKSUM];
+    if (checked == 0 || counts[PERSON_SENSOR_BAD_CHECKSUM] * 100 <= checked * CAPTURE_MAX_BAD_PCT) {
+        return checked > 0;
+    }
+    for (const crc_variant_t &variant : CRC_VARIANTS) {
+        int matches = 0;
+        for (const recorded_frame_t &frame : frames) {
+            const person_sensor_results_t* results = (const person_sensor_results_t*) frame.bytes;
+            uint16_t crc = crc16Variant(variant, frame.bytes, offsetof(person_sensor_results_t, checksum));
+            if (variant.swapped) {
+                crc = (crc >> 8) | (crc << 8);
+            }
+            matches += crc == results->checksum;
+        }
+        printf("  %-34s matches %u of %u\n", variant.name, matches, (unsigned int) frames.size());
+    }
+    return false;
+}
+
+void benchmark() {
+    std::vector<person_sensor_results_t> packets;
+    for (int faces = 0; faces <= PERSON_SENSOR_MAX_FACES_COUNT; faces++) {
+        packets.push_back(buildPacket(faces));
+    }
+    const size_t length = offsetof(person_sensor_results_t, checksum);
+
+    // Summed so the calls aren't optimized away.
+    uint32_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_PACKETS; i++) {
+        sum += person_sensor_crc16((const uint8_t*) &packets[i % packets.size()], length);
+    }
+    const double tableNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_PACKETS; i++) {
+        sum += crc16Bitwise((const uint8_t*) &packets[i % packets.size()], length);
+    }
+    const double bitwiseNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_PACKETS; i++) {
+        sum += person_sensor_validate(&packets[i % packets.size()]);
+    }
+    const double validateNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-24s %12s %12s\n", "per packet, on the host", "ns", "MB/s");
+    printf("%-24s %12.1f %12.1f\n", "person_sensor_crc16()", tableNs / BENCHMARK_PACKETS,
+        length * BENCHMARK_PACKETS / tableNs * 1000);
+    printf("%-24s %12.1f %12.1f\n", "bitwise CRC", bitwiseNs / BENCHMARK_PACKETS,
+        length * BENCHMARK_PACKETS / bitwiseNs * 1000);
+    printf("%-24s %12.1f\n", "person_sensor_validate()", validateNs / BENCHMARK_PACKETS);
+    printf("(checksum sum %u)\n", sum);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [log with dump_person_sensor_frames output]\n", argv[0]);
+        return 1;
+    }
+    int failures = checkVectors();
+    if (argc == 2 && !checkCapture(argv[1])) {
+        failures++;
+    }
+    benchmark();
+    if (failures > 0) {
+        printf("FAIL\n");
+        return 1;
+    }
+    return 0;
+}
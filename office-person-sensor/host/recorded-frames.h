@@ -0,0 +1,58 @@
+#ifndef INCLUDE_RECORDED_FRAMES_H
+#define INCLUDE_RECORDED_FRAMES_H
+
+// Reads the packets the dump_person_sensor_frames service logs
+// (PersonSensorFrameRecorder::dump()) back out of a saved log, for the
+// host programs.
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "person_sensor.h"
+
+#define FRAME_SIZE (sizeof(person_sensor_results_t))
+
+struct recorded_frame_t {
+    uint32_t ms;
+    uint8_t bytes[FRAME_SIZE];
+};  // A packet from dump_person_sensor_frames
+
+// Parse "frame <n> t=<ms> <hex>" out of a log line. false if it isn't one.
+inline bool parseFrame(const char* line, recorded_frame_t &frame) {
+    const char* start = strstr(line, "frame ");
+    unsigned int number = 0;
+    unsigned int ms = 0;
+    int consumed = 0;
+    if (start == NULL || sscanf(start, "frame %u t=%u %n", &number, &ms, &consumed) != 2) {
+        return false;
+    }
+    const char* hex = start + consumed;
+    for (size_t i = 0; i < FRAME_SIZE; i++) {
+        unsigned int value = 0;
+        if (sscanf(hex + i * 2, "%2x", &value) != 1) {
+            return false;
+        }
+        frame.bytes[i] = (uint8_t) value;
+    }
+    frame.ms = ms;
+    return true;
+}
+
+inline bool readFrames(const char* path, std::vector<recorded_frame_t> &frames) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return false;
+    }
+    char line[512];
+    recorded_frame_t frame;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (parseFrame(line, frame)) {
+            frames.push_back(frame);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+#endif  // INCLUDE_RECORDED_FRAMES_H
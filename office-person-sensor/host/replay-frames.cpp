@@ -0,0 +1,125 @@
+// Replays Person Sensor packets recorded on the device through the same
+// code the device runs on them, on Linux.
+//
+// The input is a log with the lines the dump_person_sensor_frames service
+// writes (PersonSensorFrameRecorder::dump()): "frame <n> t=<ms> <hex>".
+// Other lines are ignored, so a whole ESPHome log can be given. The
+// packets are served by ReplayPersonSensorTransport to a
+// PersonSensorReader, and each packet it accepts goes through
+// personTracker, personPolling and personSensorStats as in the YAML's
+// person_sensor_loop.
+//
+// The host clock (person_sensor_host.h) follows the recorded times. While
+// the reader waits (its read interval, or a single shot) the clock moves
+// on POLL_MS at a time, as the YAML polls, but not past the next packet's
+// recorded time, and stands still while it reads. The device recorded
+// each packet when it finished reading it, so with the device's settings
+// the replay reads each packet at its recorded time, and the tracker and
+// the polling controller see the timing the device saw. Packets read more
+// than POLL_MS from their recorded time are counted: the replay's polling
+// has drifted from the device's (different settings, or a gap in the
+// capture).
+//
+// Prints each presence change, with how long the person was seen for,
+// and a summary. To measure flapping, the summary compares the tracker's
+// presence changes with those of the single-frame rule it replaced (any
+// face at OLD_RULE_CONFIDENCE or more). See README.md to build.
+
+#include <stdio.h>
+#include <vector>
+#include "person_sensor.h"
+#include "person_tracker.h"
+#include "person_polling.h"
+#include "person_sensor_stats.h"
+#include "recorded-frames.h"
+
+// The YAML's person_sensor_loop update_interval.
+#define POLL_MS (20)
+// The box_confidence the rule before person_tracker.h needed.
+#define OLD_RULE_CONFIDENCE (85)
+
+// Presence by the rule before person_tracker.h: the most confident face
+// in this frame alone.
+bool oldRulePresent(const person_sensor_results_t &results) {
+    for (int i = 0; i < results.num_faces; i++) {
+        if (results.faces[i].box_confidence >= OLD_RULE_CONFIDENCE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <log with dump_person_sensor_frames output>\n", argv[0]);
+        return 1;
+    }
+    std::vector<recorded_frame_t> frames;
+    if (!readFrames(argv[1], frames)) {
+        return 1;
+    }
+    if (frames.empty()) {
+        fprintf(stderr, "No frames in %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<uint8_t> stream;
+    for (const recorded_frame_t &frame : frames) {
+        stream.insert(stream.end(), frame.bytes, frame.bytes + FRAME_SIZE);
+    }
+    ReplayPersonSensorTransport transport(stream.data(), stream.size());
+    PersonSensorReader reader(&transport);
+
+    uint32_t accepted = 0;
+    uint32_t offFrames = 0;
+    bool oldPresent = false;
+    uint32_t oldPresenceChanges = 0;
+    person_sensor_results_t results = {};
+    for (size_t i = 0; i < frames.size(); i++) {
+        const size_t end = (i + 1) * FRAME_SIZE;
+        while (transport.position < end) {
+            if (reader.poll(&results)) {
+                accepted++;
+                const uint32_t drift = millis() > frames[i].ms ? millis() - frames[i].ms : frames[i].ms - millis();
+                offFrames += drift > POLL_MS;
+                // The tracks are gone once presence ends.
+                const uint32_t dwellMs = personTracker.longestDwellMs();
+                const bool presenceChanged = personTracker.update(&results, millis());
+                personPolling.observeFrame(reader, &results, presenceChanged, personTracker.present, millis());
+                personSensorStats.observe(personTracker, millis());
+                if (presenceChanged && personTracker.present) {
+                    printf("%10u ms  present\n", millis());
+                }
+                else if (presenceChanged) {
+                    printf("%10u ms  absent, seen for %.1f s\n", millis(), dwellMs / 1000.0);
+                }
+                if (oldRulePresent(results) != oldPresent) {
+                    oldPresent = !oldPresent;
+                    oldPresenceChanges++;
+                }
+            }
+            else if (reader.state != PersonSensorReader::READING) {
+                if (millis() + POLL_MS <= frames[i].ms) {
+                    hostAdvance(POLL_MS);
+                }
+                else if (millis() < frames[i].ms) {
+                    hostSetMillis(frames[i].ms);
+                }
+                else {
+                    // Still waiting at the recorded time.
+                    hostAdvance(POLL_MS);
+                }
+            }
+        }
+    }
+
+    printf("Replayed %u frames over %.1f s: %u accepted, %u rejected.\n", (unsigned int) frames.size(),
+        (frames.back().ms - frames.front().ms) / 1000.0, accepted, reader.rejectedFrames);
+    printf("Presence changed %u times, and %u times by the single-frame rule.\n",
+        personTracker.presenceChanges, oldPresenceChanges);
+    printf("%u frames were read more than %d ms from their recorded time.\n", offFrames, POLL_MS);
+    char summary[128];
+    personSensorStats.formatSummary(summary, sizeof(summary));
+    printf("Stats: %s\n", summary);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#ifndef INCLUDE_PERSON_POLLING_H
+#define INCLUDE_PERSON_POLLING_H
+
+// Adaptive polling of the Person Sensor.
+//
+// Reading the sensor at a fixed 1s is too slow to catch someone walking
+// in and wasteful when the office has been empty for hours. Instead:
+//
+// * Around a change (presence changes, or faces appear/disappear) the
+//   sensor is read every PERSON_POLLING_FAST_MS in continuous mode, for
+//   at least PERSON_POLLING_FAST_HOLD_MS.
+// * After that, while nothing changes, the interval doubles on every
+//   frame up to PERSON_POLLING_SLOW_MS.
+// * Once the interval reaches PERSON_POLLING_SINGLE_SHOT_MS the sensor is
+//   put in standby mode and each read triggers a single-shot inference,
+//   so the sensor isn't running inference between our slow reads.
+//
+// Define PERSON_SENSOR_FIXED_POLLING to keep the previous behaviour (fixed
+// PERSON_SENSOR_READ_INTERVAL_MS, continuous mode) for comparison.
+
+#include <stdint.h>
+#include "person_sensor.h"
+
+#define PERSON_POLLING_FAST_MS (200)
+#define PERSON_POLLING_FAST_HOLD_MS (10000)
+#define PERSON_POLLING_SLOW_MS (5000)
+#define PERSON_POLLING_SINGLE_SHOT_MS (2000)
+
+class PersonPollingController {
+    public:
+    uint32_t intervalMs = PERSON_POLLING_FAST_MS;
+    bool singleShot = false;
+
+    // Diagnostics.
+    // Upper bound of the most recent detection latency: ms from the last
+    // frame without a face to the frame where presence became true.
+    uint32_t lastDetectLatencyMs = 0;
+
+    /**
+     * Observe a decoded frame and adjust how (and how often) the reader
+     * polls the sensor.
+     */
+    void observeFrame(PersonSensorReader &reader, const person_sensor_results_t* results,
+            bool presenceChanged, bool present, uint32_t nowMs) {
+        const bool anyFace = results->num_faces > 0;
+        if (!anyFace) {
+            lastEmptyFrameMs = nowMs;
+        }
+        if (presenceChanged && present) {
+            lastDetectLatencyMs = nowMs - lastEmptyFrameMs;
+        }
+
+#ifndef PERSON_SENSOR_FIXED_POLLING
+        if (presenceChanged || anyFace != lastAnyFace) {
+            // Something is happening. Poll quickly for a while.
+            fastUntilMs = nowMs + PERSON_POLLING_FAST_HOLD_MS;
+            intervalMs = PERSON_POLLING_FAST_MS;
+        }
+        else if ((int32_t) (nowMs - fastUntilMs) >= 0) {
+            // Nothing has changed for a while. Back off.
+            intervalMs = intervalMs * 2 > PERSON_POLLING_SLOW_MS ? PERSON_POLLING_SLOW_MS : intervalMs * 2;
+        }
+        reader.readIntervalMs = intervalMs;
+        setSingleShot(reader, intervalMs >= PERSON_POLLING_SINGLE_SHOT_MS);
+#endif
+        lastAnyFace = anyFace;
+    }
+
+    private:
+    bool lastAnyFace = false;
+    uint32_t fastUntilMs = 0;
+    uint32_t lastEmptyFrameMs = 0;
+
+    // Configure the sensor's mode register to match how we are polling it.
+    void setSingleShot(PersonSensorReader &reader, bool newSingleShot) {
+        if (newSingleShot == singleShot) {
+            return;
+        }
+        singleShot = newSingleShot;
+        reader.writeReg(PERSON_SENSOR_REG_MODE,
+            singleShot ? PERSON_SENSOR_MODE_STANDBY : PERSON_SENSOR_MODE_CONTINUOUS);
+        reader.singleShot = singleShot;
+        ESP_LOGD("person_polling.h", "Polling every %dms in %s mode", intervalMs, singleShot ? "single-shot" : "continuous");
+    }
+};
+
+PersonPollingController personPolling;
+
+#endif  // INCLUDE_PERSON_POLLING_H
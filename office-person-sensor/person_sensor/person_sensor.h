@@ -7,7 +7,12 @@
 // to the main system.
 // See the full developer guide at https://usfl.ink/ps_dev for more information.
 
+#ifdef ARDUINO
 #include <Wire.h>
+#else
+#include "person_sensor_host.h"
+#endif
+#include <stddef.h>
 #include <stdint.h>
 
 // The I2C address of the person sensor board.
@@ -69,6 +74,8 @@ typedef struct __attribute__ ((__packed__)) {
 // sensor when we do an I2C read from the peripheral address.
 // The checksum should be the CRC16 of bytes 0 to 38. You shouldn't need to
 // verify this in practice, but we found it useful during our own debugging.
+// PersonSensorReader can check it (see person_sensor_validate()) because
+// a corrupted read can otherwise report a phantom face.
 typedef struct __attribute__ ((__packed__)) {
     person_sensor_results_header_t header;                     // Bytes 0-4.
     int8_t num_faces;                                          // Byte 5.
@@ -76,44 +83,296 @@ typedef struct __attribute__ ((__packed__)) {
     uint16_t checksum;                                         // Bytes 38-39.
 } person_sensor_results_t;
 
-// Fetch the latest results from the sensor. Returns false if the read didn't
-// succeed.
-inline bool person_sensor_read(person_sensor_results_t* results) {
-    // For an explanation of why we're doing the read in chunks see 
-    // https://www.arduino.cc/reference/en/language/functions/communication/wire/
-    // In particular: "The Wire library implementation uses a 32 byte buffer, 
-    // therefore any communication should be within this limit. Exceeding 
-    // bytes in a single transmission will just be dropped."
-    // I missed this warning in my initial implementatiom, which caused 
-    // https://github.com/usefulsensors/person_sensor_arduino/issues/2 on
-    // older boards like the Uno.
-    const int maxBytesPerChunk = 32;
-    const int totalBytes = sizeof(person_sensor_results_t);
-    int8_t* results_bytes = (int8_t*)(results);
+// The largest header.data_size the sensor reports (see
+// person_sensor_results_header_t).
+#define PERSON_SENSOR_MAX_DATA_SIZE (40)
+
+// Lookup table for person_sensor_crc16(), CRC-16/CCITT-FALSE (polynomial
+// 0x1021), one entry per value of the next byte. Kept in flash.
+static const uint16_t person_sensor_crc16_table[256] PROGMEM = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+// CRC16 of the given bytes, one table lookup per byte.
+inline uint16_t person_sensor_crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; ++i) {
+        const uint8_t tableIndex = (crc >> 8) ^ data[i];
+        crc = (crc << 8) ^ pgm_read_word(&person_sensor_crc16_table[tableIndex]);
+    }
+    return crc;
+}
+
+// Why a packet was rejected by person_sensor_validate().
+typedef enum {
+    PERSON_SENSOR_VALID = 0,
+    PERSON_SENSOR_BAD_DATA_SIZE,
+    PERSON_SENSOR_BAD_NUM_FACES,
+    PERSON_SENSOR_BAD_CHECKSUM,
+} person_sensor_validation_t;
+
+// Check a packet before any of it is decoded. A corrupted read could
+// otherwise report a phantom face with a high box_confidence.
+//
+// The checksum is CRC-16/CCITT-FALSE over the bytes before it (the packet
+// is 39 bytes, the checksum bytes 37-38). host/check-packets checks a
+// dump_person_sensor_frames capture against it. Define
+// PERSON_SENSOR_SKIP_CHECKSUM to leave the checksum unchecked.
+inline person_sensor_validation_t person_sensor_validate(const person_sensor_results_t* results) {
+    if (results->header.data_size == 0 || results->header.data_size > PERSON_SENSOR_MAX_DATA_SIZE) {
+        return PERSON_SENSOR_BAD_DATA_SIZE;
+    }
+    if (results->num_faces < 0 || results->num_faces > PERSON_SENSOR_MAX_FACES_COUNT) {
+        return PERSON_SENSOR_BAD_NUM_FACES;
+    }
+#ifndef PERSON_SENSOR_SKIP_CHECKSUM
+    // The checksum covers every byte before it.
+    const uint16_t crc = person_sensor_crc16((const uint8_t*)(results), offsetof(person_sensor_results_t, checksum));
+    if (crc != results->checksum) {
+        return PERSON_SENSOR_BAD_CHECKSUM;
+    }
+#endif
+    return PERSON_SENSOR_VALID;
+}
+
+#include "person_sensor_transport.h"
+
+typedef PersonSensorFrameRecorder<sizeof(person_sensor_results_t)> person_sensor_frame_recorder_t;
+
+// Milliseconds between the start of each read of the sensor results.
+#define PERSON_SENSOR_READ_INTERVAL_MS (1000)
+
+// Abandon a partially read packet if it hasn't completed after this long.
+#define PERSON_SENSOR_READ_TIMEOUT_MS (250)
+
+// How many times a failed packet is restarted before waiting for the
+// next read interval.
+#define PERSON_SENSOR_READ_RETRIES (2)
+
+// Values for PERSON_SENSOR_REG_MODE.
+#define PERSON_SENSOR_MODE_STANDBY    (0x00)
+#define PERSON_SENSOR_MODE_CONTINUOUS (0x01)
+
+// In standby mode, how long to wait after triggering a single-shot
+// inference (PERSON_SENSOR_REG_SINGLE_SHOT) before reading the results.
+#define PERSON_SENSOR_SINGLE_SHOT_WAIT_MS (200)
+
+// Reads the sensor results without blocking.
+//
+// Reading every chunk of a packet back-to-back blocks the main loop (and
+// WiFi/API) for the whole packet. This reader instead moves at most one
+// chunk forward on each call to poll(), so it can be called frequently
+// (every loop or from a short interval) and only hands over a complete
+// person_sensor_results_t once all of the bytes of the packet have
+// arrived and it has passed person_sensor_validate().
+//
+// The bus is accessed through a PersonSensorTransport. If a recorder is
+// given, every complete packet is recorded as received.
+//
+//   IDLE     Waiting for readIntervalMs to pass since the last packet started.
+//   WAITING_FOR_SHOT
+//            Only when singleShot is set (the sensor is in standby mode).
+//            A single inference has been triggered; waiting
+//            PERSON_SENSOR_SINGLE_SHOT_WAIT_MS for it to complete.
+//   READING  Reading the packet one chunk per poll(). If a chunk comes back
+//            short the packet is restarted (the sensor can't resume a
+//            partial packet), up to PERSON_SENSOR_READ_RETRIES times. If
+//            the packet takes longer than PERSON_SENSOR_READ_TIMEOUT_MS it
+//            is abandoned.
+//
+// Define PERSON_SENSOR_BLOCKING_READ to read the whole packet in a single
+// poll(), back-to-back, to compare maxPollMicros.
+class PersonSensorReader {
+    public:
+    enum State { IDLE, WAITING_FOR_SHOT, READING };
+
+    State state = IDLE;
+    uint32_t readIntervalMs = PERSON_SENSOR_READ_INTERVAL_MS;
+    // Set when the sensor is in standby mode and each packet must be
+    // preceded by a single-shot trigger.
+    bool singleShot = false;
+
+    // Diagnostics.
+    // The longest a single poll() has taken (the worst-case time we block
+    // the loop). Reset this after reporting it.
+    uint32_t maxPollMicros = 0;
+    // Number of packets that were abandoned.
+    uint32_t failedReads = 0;
+    // Number of complete packets rejected by person_sensor_validate().
+    uint32_t rejectedFrames = 0;
+    // Number of I2C transactions (reads and register writes) performed.
+    uint32_t i2cTransactions = 0;
+
+    PersonSensorReader(PersonSensorTransport* transport_, person_sensor_frame_recorder_t* recorder_ = NULL) {
+        transport = transport_;
+        recorder = recorder_;
+    }
+
+    // Advance the read by at most one chunk. Returns true and fills in
+    // results when a complete packet has been read.
+    bool poll(person_sensor_results_t* results) {
+        const uint32_t start = micros();
+        const bool complete = step(results);
+        const uint32_t elapsed = micros() - start;
+        if (elapsed > maxPollMicros) {
+            maxPollMicros = elapsed;
+        }
+        return complete;
+    }
+
+    // Write a sensor register.
+    void writeReg(uint8_t reg, uint8_t value) {
+        i2cTransactions++;
+        transport->writeReg(reg, value);
+    }
+
+    private:
+    // The Wire library has a 32 byte buffer: "any communication should be
+    // within this limit. Exceeding bytes in a single transmission will
+    // just be dropped." See
+    // https://github.com/usefulsensors/person_sensor_arduino/issues/2
+    static const int maxBytesPerChunk = 32;
+    static const int totalBytes = sizeof(person_sensor_results_t);
+
+    PersonSensorTransport* transport;
+    person_sensor_frame_recorder_t* recorder;
+
+    person_sensor_results_t pending;
+    uint32_t packetStartMs = 0;
+    uint32_t readStartMs = 0;
     int index = 0;
-    while (index < totalBytes) {
-        const int bytesRemaining = totalBytes - index;
-        const int bytesThisChunk = min(bytesRemaining, maxBytesPerChunk);
-        const int endIndex = index + bytesThisChunk;
-        const bool isLastChunk = (bytesRemaining <= maxBytesPerChunk);
-        Wire.requestFrom(PERSON_SENSOR_I2C_ADDRESS, bytesThisChunk, isLastChunk);
-        for (; index < endIndex; ++index) {
-            if (Wire.available() < 1) {
-                ESP_LOGE("person_sensor.h", "Only %d bytes available on I2C, but we need %d", index, bytesThisChunk);
+    int restarts = 0;
+    bool everStarted = false;
+
+    bool step(person_sensor_results_t* results) {
+        const uint32_t now = millis();
+        if (state == IDLE) {
+            if (everStarted && (now - packetStartMs) < readIntervalMs) {
+                return false;
+            }
+            everStarted = true;
+            packetStartMs = now;
+            if (singleShot) {
+                writeReg(PERSON_SENSOR_REG_SINGLE_SHOT, 0x00);
+                state = WAITING_FOR_SHOT;
                 return false;
             }
-            results_bytes[index] = Wire.read();
+            startReading(now);
         }
+
+        if (state == WAITING_FOR_SHOT) {
+            if ((now - packetStartMs) < PERSON_SENSOR_SINGLE_SHOT_WAIT_MS) {
+                return false;
+            }
+            startReading(now);
+        }
+
+        if ((now - readStartMs) > PERSON_SENSOR_READ_TIMEOUT_MS) {
+            ESP_LOGE("person_sensor.h", "Timed out reading results after %d of %d bytes", index, totalBytes);
+            abandon();
+            return false;
+        }
+
+#ifdef PERSON_SENSOR_BLOCKING_READ
+        const bool readAllChunks = true;
+#else
+        const bool readAllChunks = false;
+#endif
+        do {
+            if (!readChunk()) {
+                if (++restarts > PERSON_SENSOR_READ_RETRIES) {
+                    ESP_LOGE("person_sensor.h", "No person sensor results found on the i2c bus");
+                    abandon();
+                }
+                else {
+                    // The sensor can't resume part way through a packet.
+                    index = 0;
+                }
+                return false;
+            }
+        } while (readAllChunks && index < totalBytes);
+
+        if (index < totalBytes) {
+            // More chunks to read on later polls.
+            return false;
+        }
+        state = IDLE;
+        if (recorder != NULL) {
+            recorder->record(&pending, now);
+        }
+        const person_sensor_validation_t validation = person_sensor_validate(&pending);
+        if (validation != PERSON_SENSOR_VALID) {
+            rejectedFrames++;
+            ESP_LOGW("person_sensor.h", "Rejected corrupt packet (reason=%d, data_size=%d, num_faces=%d)",
+                validation, pending.header.data_size, pending.num_faces);
+            return false;
+        }
+        *results = pending;
+        return true;
     }
-    return true;
-}
 
-// Writes the value to the sensor register over the I2C bus.
-inline void person_sensor_write_reg(uint8_t reg, uint8_t value) {
-    Wire.beginTransmission(PERSON_SENSOR_I2C_ADDRESS);
-    Wire.write(reg);
-    Wire.write(value);
-    Wire.endTransmission();
-}
+    void startReading(uint32_t now) {
+        readStartMs = now;
+        index = 0;
+        restarts = 0;
+        state = READING;
+    }
+
+    // Read the next chunk of the packet.
+    bool readChunk() {
+        uint8_t* pending_bytes = (uint8_t*)(&pending);
+        const int bytesRemaining = totalBytes - index;
+        const int bytesThisChunk = bytesRemaining < maxBytesPerChunk ? bytesRemaining : maxBytesPerChunk;
+        const bool isLastChunk = (bytesRemaining <= maxBytesPerChunk);
+        i2cTransactions++;
+        if (!transport->read(pending_bytes + index, bytesThisChunk, isLastChunk)) {
+            return false;
+        }
+        index += bytesThisChunk;
+        return true;
+    }
+
+    void abandon() {
+        failedReads++;
+        state = IDLE;
+    }
+};
+
+#ifdef ARDUINO
+WirePersonSensorTransport personSensorWire;
+person_sensor_frame_recorder_t personSensorRecorder;
+PersonSensorReader personSensorReader(&personSensorWire, &personSensorRecorder);
+#endif
 
 #endif  // INCLUDE_PERSON_SENSOR_H
@@ -0,0 +1,55 @@
+#ifndef INCLUDE_PERSON_SENSOR_HOST_H
+#define INCLUDE_PERSON_SENSOR_HOST_H
+
+// The few Arduino/ESPHome definitions the person sensor code uses, for
+// building it off-device (e.g. to replay recorded sessions on Linux with
+// ReplayPersonSensorTransport). Only included when ARDUINO isn't defined.
+//
+// Time is simulated: it only moves when the host program moves it, with
+// hostSetMillis() (for example to each recorded frame's time) or
+// hostAdvance(), so a replay sees the recorded timing however fast the
+// host runs it.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+
+#define PERSON_SENSOR_HOST_LOG(level, tag, ...) \
+    do { printf("[%s][%s] ", level, tag); printf(__VA_ARGS__); printf("\n"); } while (0)
+#define ESP_LOGE(tag, ...) PERSON_SENSOR_HOST_LOG("E", tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) PERSON_SENSOR_HOST_LOG("W", tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) PERSON_SENSOR_HOST_LOG("I", tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) PERSON_SENSOR_HOST_LOG("D", tag, __VA_ARGS__)
+
+// Microseconds since the simulated boot.
+inline uint64_t &person_sensor_host_now_us() {
+    static uint64_t now = 0;
+    return now;
+}
+
+// Move the clock to ms, unless it is already past it. Returns false if it
+// was.
+inline bool hostSetMillis(uint32_t ms) {
+    if ((uint64_t) ms * 1000 < person_sensor_host_now_us()) {
+        return false;
+    }
+    person_sensor_host_now_us() = (uint64_t) ms * 1000;
+    return true;
+}
+
+inline void hostAdvance(uint32_t ms) {
+    person_sensor_host_now_us() += (uint64_t) ms * 1000;
+}
+
+// Both wrap as they do on the device.
+inline uint32_t micros() {
+    return (uint32_t) person_sensor_host_now_us();
+}
+
+inline uint32_t millis() {
+    return (uint32_t) (person_sensor_host_now_us() / 1000);
+}
+
+#endif  // INCLUDE_PERSON_SENSOR_HOST_H
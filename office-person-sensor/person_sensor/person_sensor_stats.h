@@ -0,0 +1,174 @@
+#ifndef INCLUDE_PERSON_SENSOR_STATS_H
+#define INCLUDE_PERSON_SENSOR_STATS_H
+
+// Occupancy statistics accumulated on the device from the face boxes, so
+// where and how long people sit can be learned without streaming every
+// frame to Home Assistant:
+//
+// * A coarse heatmap (PERSON_SENSOR_HEATMAP_SIZE square over the 0-255
+//   viewport) of how long a face centre was seen in each cell.
+// * A histogram of how long each tracked face stayed (from PersonTracker),
+//   in power-of-two second bins.
+// * How much of that time faces were facing the sensor.
+//
+// Only faces PersonTracker counts as a person are included, so a stray
+// detection that never confirmed adds nothing. Each frame is weighted by
+// the time since the previous one: the polling rate changes (fast while
+// someone is there, slow otherwise), and counting frames would weigh the
+// fast periods several times over.
+//
+// Each frame costs O(tracks) and nothing is allocated. The summary and
+// heatmap are formatted as short strings to publish at a low rate.
+
+#include <stdint.h>
+#include <stdio.h>
+#include "person_sensor.h"
+#include "person_tracker.h"
+
+#define PERSON_SENSOR_HEATMAP_SIZE (16)
+
+// Heatmap cells count this many ms.
+#define PERSON_SENSOR_HEATMAP_UNIT_MS (100)
+
+// A frame weighs at most this many ms, the slowest poll interval
+// (PERSON_POLLING_SLOW_MS), so a gap in the frames isn't counted as time
+// someone was seen.
+#define PERSON_SENSOR_STATS_MAX_FRAME_MS (5000)
+
+// Dwell bins: [0,2s), [2s,4s), [4s,8s) ... and a last bin for anything longer.
+#define PERSON_SENSOR_DWELL_BINS (12)
+
+class PersonSensorStats {
+    public:
+    uint16_t heatmap[PERSON_SENSOR_HEATMAP_SIZE][PERSON_SENSOR_HEATMAP_SIZE] = {};
+    uint16_t heatmapMax = 0;
+    uint32_t dwellHistogram[PERSON_SENSOR_DWELL_BINS] = {};
+    // ms faces were seen for, and of those, facing the sensor.
+    uint32_t faceMs = 0;
+    uint32_t facingMs = 0;
+
+    /**
+     * Accumulate one frame. Call after personTracker.update() for the frame.
+     */
+    void observe(const PersonTracker &tracker, uint32_t nowMs) {
+        uint32_t frameMs = observedAny ? nowMs - lastFrameMs : 0;
+        if (frameMs > PERSON_SENSOR_STATS_MAX_FRAME_MS) {
+            frameMs = PERSON_SENSOR_STATS_MAX_FRAME_MS;
+        }
+        observedAny = true;
+        lastFrameMs = nowMs;
+
+        for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+            const person_track_t &track = tracker.tracks[t];
+            // A track that ended (or was replaced by a new one) since the
+            // last frame contributes its dwell time, if it ever confirmed.
+            if (wasActive[t] && (!track.active || track.startedMs != startedMs[t])) {
+                if (wasConfirmed[t]) {
+                    observeDwell(dwellMs[t]);
+                }
+                wasConfirmed[t] = false;
+            }
+            wasActive[t] = track.active;
+            if (!track.active) {
+                continue;
+            }
+            startedMs[t] = track.startedMs;
+            dwellMs[t] = PersonTracker::dwellMs(track);
+            wasConfirmed[t] |= track.confirmed;
+            // Only the faces seen this frame, of tracks counted as a person.
+            if (track.confirmed && track.seen) {
+                observeFace(track, frameMs);
+            }
+        }
+    }
+
+    /**
+     * Short summary: seconds faces were seen, % of them facing, the hottest
+     * heatmap cell and the dwell histogram counts,
+     * e.g. "seen=812s facing=64% peak=7,5 dwell=3,1,0,...".
+     */
+    void formatSummary(char* buffer, size_t size) {
+        int peakRow = 0;
+        int peakColumn = 0;
+        for (int r = 0; r < PERSON_SENSOR_HEATMAP_SIZE; r++) {
+            for (int c = 0; c < PERSON_SENSOR_HEATMAP_SIZE; c++) {
+                if (heatmap[r][c] > heatmap[peakRow][peakColumn]) {
+                    peakRow = r;
+                    peakColumn = c;
+                }
+            }
+        }
+        int length = snprintf(buffer, size, "seen=%us facing=%u%% peak=%d,%d dwell=",
+            faceMs / 1000, faceMs == 0 ? 0 : (unsigned) ((uint64_t) facingMs * 100 / faceMs),
+            peakColumn, peakRow);
+        for (int b = 0; b < PERSON_SENSOR_DWELL_BINS && length > 0 && (size_t) length < size; b++) {
+            length += snprintf(buffer + length, size - length, b == 0 ? "%u" : ",%u", dwellHistogram[b]);
+        }
+    }
+
+    /**
+     * Half of the heatmap (firstRow and the rows after it, numRows rows) as
+     * one hex digit per cell, scaled so the hottest cell is f.
+     */
+    void formatHeatmapRows(char* buffer, size_t size, int firstRow, int numRows) {
+        size_t length = 0;
+        for (int r = firstRow; r < firstRow + numRows && r < PERSON_SENSOR_HEATMAP_SIZE; r++) {
+            for (int c = 0; c < PERSON_SENSOR_HEATMAP_SIZE && length + 1 < size; c++) {
+                const int level = heatmapMax == 0 ? 0 : (int) ((uint32_t) heatmap[r][c] * 15 / heatmapMax);
+                buffer[length++] = "0123456789abcdef"[level];
+            }
+        }
+        buffer[length] = '\0';
+    }
+
+    private:
+    bool observedAny = false;
+    uint32_t lastFrameMs = 0;
+    // Each track as of the last frame, and whether it ever confirmed.
+    bool wasActive[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+    bool wasConfirmed[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+    uint32_t startedMs[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+    uint32_t dwellMs[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+
+    void observeFace(const person_track_t &track, uint32_t frameMs) {
+        const int column = ((track.box_left + track.box_right) / 2) * PERSON_SENSOR_HEATMAP_SIZE / 256;
+        const int row = ((track.box_top + track.box_bottom) / 2) * PERSON_SENSOR_HEATMAP_SIZE / 256;
+        const uint16_t units = (frameMs + PERSON_SENSOR_HEATMAP_UNIT_MS / 2) / PERSON_SENSOR_HEATMAP_UNIT_MS;
+        if (heatmap[row][column] > UINT16_MAX - units) {
+            halveHeatmap();
+        }
+        uint16_t &cell = heatmap[row][column];
+        cell += units;
+        if (cell > heatmapMax) {
+            heatmapMax = cell;
+        }
+        faceMs += frameMs;
+        if (track.isFacing) {
+            facingMs += frameMs;
+        }
+    }
+
+    void observeDwell(uint32_t dwellMs) {
+        uint32_t seconds = dwellMs / 1000;
+        int bin = 0;
+        while (seconds >= 2 && bin < PERSON_SENSOR_DWELL_BINS - 1) {
+            seconds >>= 1;
+            bin++;
+        }
+        dwellHistogram[bin]++;
+    }
+
+    // Keep the relative shape of the heatmap when a cell would overflow.
+    void halveHeatmap() {
+        for (int r = 0; r < PERSON_SENSOR_HEATMAP_SIZE; r++) {
+            for (int c = 0; c < PERSON_SENSOR_HEATMAP_SIZE; c++) {
+                heatmap[r][c] >>= 1;
+            }
+        }
+        heatmapMax >>= 1;
+    }
+};
+
+PersonSensorStats personSensorStats;
+
+#endif  // INCLUDE_PERSON_SENSOR_STATS_H
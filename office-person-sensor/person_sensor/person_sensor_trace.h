@@ -0,0 +1,112 @@
+#ifndef INCLUDE_PERSON_SENSOR_TRACE_H
+#define INCLUDE_PERSON_SENSOR_TRACE_H
+
+// Compact binary trace of what the Person Sensor saw.
+//
+// Logging every frame as text (a separator, a face count and a formatted
+// line per face) costs a vsnprintf per line and log transport all day on
+// a device with very little RAM. Instead each frame that differs from the
+// previous one is stored as a fixed PERSON_SENSOR_TRACE_RECORD_SIZE byte
+// record in a ring buffer, which can be dumped on demand (see the
+// dump_person_sensor_trace service) and decoded on the host with
+// decode-trace.py.
+//
+// Record layout:
+//   Bytes 0-3  millis(), little endian. Unchanged frames aren't recorded,
+//              so records can be hours apart; this only wraps when
+//              millis() does (~49.7 days).
+//   Byte 4     Bits 0-2 num_faces, bit 3 presence decision.
+//   Then 3 bytes per face (only num_faces are meaningful):
+//     Byte 0   box_left (high nibble), box_top (low nibble), 0-15 scale.
+//     Byte 1   box_right (high nibble), box_bottom (low nibble), 0-15 scale.
+//     Byte 2   Bits 0-6 box_confidence / 2, bit 7 is_facing.
+//
+// Define PERSON_SENSOR_TEXT_LOG (with the logger at DEBUG) to also log
+// every frame as text, as before.
+
+#include <stdint.h>
+#include <string.h>
+#include "person_sensor.h"
+
+#define PERSON_SENSOR_TRACE_RECORDS (64)
+#define PERSON_SENSOR_TRACE_TIME_SIZE (4)
+#define PERSON_SENSOR_TRACE_HEADER_SIZE (PERSON_SENSOR_TRACE_TIME_SIZE + 1)
+#define PERSON_SENSOR_TRACE_FACE_SIZE (3)
+#define PERSON_SENSOR_TRACE_RECORD_SIZE \
+    (PERSON_SENSOR_TRACE_HEADER_SIZE + PERSON_SENSOR_TRACE_FACE_SIZE * PERSON_SENSOR_MAX_FACES_COUNT)
+
+class PersonSensorTrace {
+    public:
+    uint8_t records[PERSON_SENSOR_TRACE_RECORDS][PERSON_SENSOR_TRACE_RECORD_SIZE];
+    // Total records ever written. The newest is at (count - 1) % RECORDS.
+    uint32_t count = 0;
+
+    /**
+     * Record a decoded frame and the presence decision made from it.
+     * Frames identical to the previous one (apart from the time) are skipped.
+     */
+    void record(const person_sensor_results_t* results, bool present, uint32_t nowMs) {
+        uint8_t record[PERSON_SENSOR_TRACE_RECORD_SIZE] = {};
+        record[0] = nowMs & 0xFF;
+        record[1] = (nowMs >> 8) & 0xFF;
+        record[2] = (nowMs >> 16) & 0xFF;
+        record[3] = nowMs >> 24;
+        record[4] = (results->num_faces & 0x07) | (present ? 0x08 : 0x00);
+        for (int i = 0; i < results->num_faces; ++i) {
+            const person_sensor_face_t* face = &results->faces[i];
+            uint8_t* packed = record + PERSON_SENSOR_TRACE_HEADER_SIZE + (i * PERSON_SENSOR_TRACE_FACE_SIZE);
+            packed[0] = (face->box_left & 0xF0) | (face->box_top >> 4);
+            packed[1] = (face->box_right & 0xF0) | (face->box_bottom >> 4);
+            packed[2] = (face->box_confidence >> 1) | (face->is_facing ? 0x80 : 0x00);
+        }
+
+        if (count > 0) {
+            const uint8_t* last = records[(count - 1) % PERSON_SENSOR_TRACE_RECORDS];
+            if (memcmp(last + PERSON_SENSOR_TRACE_TIME_SIZE, record + PERSON_SENSOR_TRACE_TIME_SIZE,
+                    PERSON_SENSOR_TRACE_RECORD_SIZE - PERSON_SENSOR_TRACE_TIME_SIZE) == 0) {
+                return;
+            }
+        }
+        memcpy(records[count % PERSON_SENSOR_TRACE_RECORDS], record, PERSON_SENSOR_TRACE_RECORD_SIZE);
+        count++;
+    }
+
+    /**
+     * Log the trace, oldest record first, one hex line per record.
+     * The first line gives the current millis() so the host can anchor the
+     * record times.
+     */
+    void dump() {
+        const uint32_t available = count < PERSON_SENSOR_TRACE_RECORDS ? count : PERSON_SENSOR_TRACE_RECORDS;
+        ESP_LOGI("person_sensor_trace", "trace now=%u records=%u", millis(), available);
+        char hex[PERSON_SENSOR_TRACE_RECORD_SIZE * 2 + 1];
+        for (uint32_t i = count - available; i < count; i++) {
+            const uint8_t* record = records[i % PERSON_SENSOR_TRACE_RECORDS];
+            for (int b = 0; b < PERSON_SENSOR_TRACE_RECORD_SIZE; b++) {
+                snprintf(hex + (b * 2), 3, "%02x", record[b]);
+            }
+            ESP_LOGI("person_sensor_trace", "record %s", hex);
+        }
+    }
+};
+
+PersonSensorTrace personSensorTrace;
+
+// Log a frame as text. Compiled out unless PERSON_SENSOR_TEXT_LOG is defined.
+inline void person_sensor_log_results(const person_sensor_results_t* results) {
+#ifdef PERSON_SENSOR_TEXT_LOG
+    ESP_LOGD("person_sensor_loop", "********");
+    ESP_LOGD("person_sensor_loop", "%d faces found", results->num_faces);
+    for (int i = 0; i < results->num_faces; ++i) {
+        const person_sensor_face_t* face = &results->faces[i];
+        ESP_LOGD("person_sensor_loop", "Face # %d: %d confidence (l=%d, t=%d, r=%d, b=%d) %s",
+            i, face->box_confidence,
+            face->box_left, face->box_top, face->box_right, face->box_bottom,
+            face->is_facing ? "facing" : "not facing");
+    }
+#else
+    (void) results;
+#endif
+}
+
+#endif  // INCLUDE_PERSON_SENSOR_TRACE_H
@@ -0,0 +1,142 @@
+#ifndef INCLUDE_PERSON_SENSOR_TRANSPORT_H
+#define INCLUDE_PERSON_SENSOR_TRANSPORT_H
+
+// How PersonSensorReader talks to the sensor.
+//
+// PersonSensorReader only ever performs two operations on the bus: read a
+// chunk of a results packet and write a register. Putting those behind
+// PersonSensorTransport means the reader, and everything that decodes
+// and decides on its results (person_tracker.h, person_polling.h), can run
+// unchanged off-device:
+//
+// * WirePersonSensorTransport talks to the sensor with the Arduino Wire
+//   library, reading each chunk with a single bulk readBytes().
+// * ReplayPersonSensorTransport serves bytes recorded earlier (for example
+//   with PersonSensorFrameRecorder) so sessions can be replayed on Linux.
+//
+// PersonSensorFrameRecorder keeps the most recent raw packets in a ring
+// buffer on the device so they can be dumped to the log and replayed.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class PersonSensorTransport {
+    public:
+    virtual ~PersonSensorTransport() {}
+
+    /**
+     * Perform one I2C read of length bytes into buffer. sendStop is false
+     * when more chunks of the same packet follow.
+     * Returns false (and reads nothing) if the full length wasn't available.
+     */
+    virtual bool read(uint8_t* buffer, int length, bool sendStop) = 0;
+
+    /**
+     * Write a value to a sensor register.
+     */
+    virtual void writeReg(uint8_t reg, uint8_t value) = 0;
+};
+
+#ifdef ARDUINO
+class WirePersonSensorTransport : public PersonSensorTransport {
+    public:
+    bool read(uint8_t* buffer, int length, bool sendStop) override {
+        const int bytesReceived = Wire.requestFrom(PERSON_SENSOR_I2C_ADDRESS, length, sendStop);
+        if (bytesReceived < length || Wire.available() < length) {
+            ESP_LOGW("person_sensor_transport.h", "Only %d bytes available on I2C, but we need %d", Wire.available(), length);
+            while (Wire.available() > 0) {
+                Wire.read();
+            }
+            return false;
+        }
+        return Wire.readBytes(buffer, length) == (size_t) length;
+    }
+
+    void writeReg(uint8_t reg, uint8_t value) override {
+        Wire.beginTransmission(PERSON_SENSOR_I2C_ADDRESS);
+        Wire.write(reg);
+        Wire.write(value);
+        Wire.endTransmission();
+    }
+};
+#endif
+
+class ReplayPersonSensorTransport : public PersonSensorTransport {
+    public:
+    // The recorded byte stream (back-to-back packets) to replay.
+    const uint8_t* data = NULL;
+    size_t length = 0;
+    size_t position = 0;
+
+    // Register writes are counted but otherwise ignored.
+    uint32_t registerWrites = 0;
+
+    ReplayPersonSensorTransport(const uint8_t* data_, size_t length_) {
+        data = data_;
+        length = length_;
+    }
+
+    // True once every recorded byte has been read.
+    bool finished() {
+        return position >= length;
+    }
+
+    bool read(uint8_t* buffer, int readLength, bool) override {
+        if (position + readLength > length) {
+            position = length;
+            return false;
+        }
+        memcpy(buffer, data + position, readLength);
+        position += readLength;
+        return true;
+    }
+
+    void writeReg(uint8_t, uint8_t) override {
+        registerWrites++;
+    }
+};
+
+// Number of raw packets PersonSensorFrameRecorder keeps: a minute at the
+// fast poll interval (PERSON_POLLING_FAST_MS), enough of a session to
+// replay and measure flapping on. Each takes 43 bytes of RAM (about 13KB
+// in all); define it lower in the build flags if the device is short.
+#ifndef PERSON_SENSOR_RECORDER_FRAMES
+#define PERSON_SENSOR_RECORDER_FRAMES (300)
+#endif
+
+// Ring buffer of the most recent raw packets read from the sensor, as
+// received (before validation), with the millis() they arrived at.
+template <int FRAME_SIZE>
+class PersonSensorFrameRecorder {
+    public:
+    uint8_t frames[PERSON_SENSOR_RECORDER_FRAMES][FRAME_SIZE];
+    uint32_t frameMs[PERSON_SENSOR_RECORDER_FRAMES];
+    // Total frames ever recorded. The newest is at (count - 1) % FRAMES.
+    uint32_t count = 0;
+
+    void record(const void* frame, uint32_t nowMs) {
+        const int slot = count % PERSON_SENSOR_RECORDER_FRAMES;
+        memcpy(frames[slot], frame, FRAME_SIZE);
+        frameMs[slot] = nowMs;
+        count++;
+    }
+
+    /**
+     * Log the recorded frames, oldest first, one hex line per frame.
+     * The hex can be concatenated and fed to ReplayPersonSensorTransport.
+     */
+    void dump() {
+        const uint32_t available = count < PERSON_SENSOR_RECORDER_FRAMES ? count : PERSON_SENSOR_RECORDER_FRAMES;
+        char hex[FRAME_SIZE * 2 + 1];
+        for (uint32_t i = count - available; i < count; i++) {
+            const int slot = i % PERSON_SENSOR_RECORDER_FRAMES;
+            for (int b = 0; b < FRAME_SIZE; b++) {
+                snprintf(hex + (b * 2), 3, "%02x", frames[slot][b]);
+            }
+            ESP_LOGI("person_sensor_frames", "frame %u t=%u %s", i, frameMs[slot], hex);
+        }
+    }
+};
+
+#endif  // INCLUDE_PERSON_SENSOR_TRANSPORT_H
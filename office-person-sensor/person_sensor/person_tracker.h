@@ -0,0 +1,257 @@
+#ifndef INCLUDE_PERSON_TRACKER_H
+#define INCLUDE_PERSON_TRACKER_H
+
+// Multi-face tracker for the Person Sensor.
+//
+// Deciding presence from the single most confident face in each frame
+// means one noisy frame flips the binary sensor. Instead, faces are
+// matched to the faces of previous frames by how much their boxes overlap
+// (intersection over union), and each track keeps a smoothed confidence
+// score. A track only counts as a person once its score has stayed above
+// PERSON_TRACKER_ENTER_SCORE for PERSON_TRACKER_ENTER_MS, and stops
+// counting once its score falls below PERSON_TRACKER_EXIT_SCORE (the
+// score decays while the face isn't seen). Presence is true while any
+// track counts as a person.
+//
+// The hysteresis is timed in ms, not frames: personPolling changes the
+// frame interval from 200ms to several seconds, and a count of frames
+// would debounce for that much longer at the slow rate.
+//
+// At most PERSON_SENSOR_MAX_FACES_COUNT tracks are kept and nothing is
+// allocated. The tracker only depends on person_sensor_results_t so it
+// can be replayed against recorded frames off-device; presenceChanges
+// counts how often presence flaps. dwellMs() is how long a track has been
+// followed, and longestDwellMs() how long the current person has been.
+
+#include <stdint.h>
+#include "person_sensor.h"
+
+// Faces less confident than this never start a track.
+#define PERSON_TRACKER_MIN_CONFIDENCE (60)
+
+// Boxes must overlap by at least this much (IoU, as a percentage) to be
+// considered the same face.
+#define PERSON_TRACKER_MATCH_IOU_PCT (30)
+
+// A track becomes a person once its score has been at least ENTER_SCORE
+// for ENTER_MS (so over at least two frames), and stops being one when
+// its score drops below EXIT_SCORE.
+#define PERSON_TRACKER_ENTER_SCORE (85)
+#define PERSON_TRACKER_ENTER_MS (200)
+#define PERSON_TRACKER_EXIT_SCORE (50)
+
+// While its face isn't seen, a track's score drops by a quarter every
+// DECAY_STEP_MS.
+#define PERSON_TRACKER_DECAY_STEP_MS (200)
+
+// A track is dropped after this long without a matching face.
+#define PERSON_TRACKER_MISSED_MS (1000)
+
+// A face being followed across frames.
+typedef struct {
+    bool active;
+    // Box from the most recently matched face.
+    uint8_t box_left;
+    uint8_t box_top;
+    uint8_t box_right;
+    uint8_t box_bottom;
+    // Smoothed box_confidence, 0-255.
+    int score;
+    // Whether the score is at least ENTER_SCORE, and since when (ms).
+    bool aboveEnter;
+    uint32_t aboveEnterSinceMs;
+    // Whether a face matched it in the latest frame.
+    bool seen;
+    // Whether this track currently counts as a person.
+    bool confirmed;
+    // When the track started and when a face last matched it (ms), and
+    // whether the face is facing the sensor.
+    uint32_t startedMs;
+    uint32_t lastSeenMs;
+    bool isFacing;
+} person_track_t;
+
+class PersonTracker {
+    public:
+    person_track_t tracks[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+
+    // The current presence decision.
+    bool present = false;
+
+    // Number of times present has changed. Useful to measure flapping.
+    uint32_t presenceChanges = 0;
+
+    /**
+     * Intersection over union of a track and a face as a percentage (0-100).
+     */
+    static int iouPercent(const person_track_t &track, const person_sensor_face_t &face) {
+        const int left = track.box_left > face.box_left ? track.box_left : face.box_left;
+        const int top = track.box_top > face.box_top ? track.box_top : face.box_top;
+        const int right = track.box_right < face.box_right ? track.box_right : face.box_right;
+        const int bottom = track.box_bottom < face.box_bottom ? track.box_bottom : face.box_bottom;
+        if (right <= left || bottom <= top) {
+            return 0;
+        }
+        const int32_t intersection = (int32_t) (right - left) * (bottom - top);
+        const int32_t trackArea = (int32_t) (track.box_right - track.box_left) * (track.box_bottom - track.box_top);
+        const int32_t faceArea = (int32_t) (face.box_right - face.box_left) * (face.box_bottom - face.box_top);
+        const int32_t unionArea = trackArea + faceArea - intersection;
+        return unionArea <= 0 ? 0 : (int) ((intersection * 100) / unionArea);
+    }
+
+    /**
+     * How long a track has been followed: from its first face to its
+     * latest (ms).
+     */
+    static uint32_t dwellMs(const person_track_t &track) {
+        return track.lastSeenMs - track.startedMs;
+    }
+
+    /**
+     * The longest dwellMs() of the tracks that count as a person, or 0 if
+     * there are none.
+     */
+    uint32_t longestDwellMs() const {
+        uint32_t longest = 0;
+        for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+            if (tracks[t].active && tracks[t].confirmed && dwellMs(tracks[t]) > longest) {
+                longest = dwellMs(tracks[t]);
+            }
+        }
+        return longest;
+    }
+
+    /**
+     * Observe one (validated) frame from the sensor.
+     * Returns true if present changed.
+     */
+    bool update(const person_sensor_results_t* results, uint32_t nowMs) {
+        // Decay steps since the last frame, rounded, and at most enough
+        // to take any score to nearly 0.
+        uint32_t decaySteps = 0;
+        if (updatedOnce) {
+            decaySteps = (nowMs - lastUpdateMs + PERSON_TRACKER_DECAY_STEP_MS / 2) / PERSON_TRACKER_DECAY_STEP_MS;
+            decaySteps = decaySteps > 16 ? 16 : decaySteps;
+        }
+        updatedOnce = true;
+        lastUpdateMs = nowMs;
+
+        const int numFaces = results->num_faces;
+        bool faceMatched[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+        bool trackMatched[PERSON_SENSOR_MAX_FACES_COUNT] = {};
+
+        // Greedily pair the best overlapping (track, face) until nothing
+        // overlaps enough. At most 4x4 pairs so this is cheap.
+        while (true) {
+            int bestIou = PERSON_TRACKER_MATCH_IOU_PCT - 1;
+            int bestTrack = -1;
+            int bestFace = -1;
+            for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+                if (!tracks[t].active || trackMatched[t]) {
+                    continue;
+                }
+                for (int f = 0; f < numFaces; f++) {
+                    if (faceMatched[f]) {
+                        continue;
+                    }
+                    const int iou = iouPercent(tracks[t], results->faces[f]);
+                    if (iou > bestIou) {
+                        bestIou = iou;
+                        bestTrack = t;
+                        bestFace = f;
+                    }
+                }
+            }
+            if (bestTrack == -1) {
+                break;
+            }
+            trackMatched[bestTrack] = true;
+            faceMatched[bestFace] = true;
+            observeFace(tracks[bestTrack], results->faces[bestFace], nowMs);
+        }
+
+        // Tracks without a face this frame decay and eventually drop.
+        for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+            if (tracks[t].active && !trackMatched[t]) {
+                person_track_t &track = tracks[t];
+                for (uint32_t step = 0; step < decaySteps; step++) {
+                    track.score = (track.score * 3) / 4;
+                }
+                track.aboveEnter = false;
+                track.seen = false;
+                if (nowMs - track.lastSeenMs > PERSON_TRACKER_MISSED_MS) {
+                    track.active = false;
+                    track.confirmed = false;
+                }
+            }
+        }
+
+        // Faces without a track start one, if there is room.
+        for (int f = 0; f < numFaces; f++) {
+            const person_sensor_face_t &face = results->faces[f];
+            if (faceMatched[f] || face.box_confidence < PERSON_TRACKER_MIN_CONFIDENCE) {
+                continue;
+            }
+            for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+                if (!tracks[t].active) {
+                    person_track_t &track = tracks[t];
+                    track = {};
+                    track.active = true;
+                    track.startedMs = nowMs;
+                    track.score = face.box_confidence;
+                    observeFace(track, face, nowMs);
+                    break;
+                }
+            }
+        }
+
+        // Enter/exit hysteresis per track.
+        bool anyConfirmed = false;
+        for (int t = 0; t < PERSON_SENSOR_MAX_FACES_COUNT; t++) {
+            person_track_t &track = tracks[t];
+            if (!track.active) {
+                continue;
+            }
+            if (!track.confirmed && track.aboveEnter && nowMs - track.aboveEnterSinceMs >= PERSON_TRACKER_ENTER_MS) {
+                track.confirmed = true;
+            }
+            else if (track.confirmed && track.score < PERSON_TRACKER_EXIT_SCORE) {
+                track.confirmed = false;
+            }
+            anyConfirmed |= track.confirmed;
+        }
+
+        if (anyConfirmed != present) {
+            present = anyConfirmed;
+            presenceChanges++;
+            return true;
+        }
+        return false;
+    }
+
+    private:
+    bool updatedOnce = false;
+    uint32_t lastUpdateMs = 0;
+
+    void observeFace(person_track_t &track, const person_sensor_face_t &face, uint32_t nowMs) {
+        track.box_left = face.box_left;
+        track.box_top = face.box_top;
+        track.box_right = face.box_right;
+        track.box_bottom = face.box_bottom;
+        track.isFacing = face.is_facing != 0;
+        track.score = (track.score * 3 + face.box_confidence) / 4;
+        track.seen = true;
+        track.lastSeenMs = nowMs;
+        if (track.score < PERSON_TRACKER_ENTER_SCORE) {
+            track.aboveEnter = false;
+        }
+        else if (!track.aboveEnter) {
+            track.aboveEnter = true;
+            track.aboveEnterSinceMs = nowMs;
+        }
+    }
+};
+
+PersonTracker personTracker;
+
+#endif  // INCLUDE_PERSON_TRACKER_H
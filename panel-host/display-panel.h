@@ -0,0 +1,198 @@
+#ifndef DISPLAY_PANEL_HOST_H
+#define DISPLAY_PANEL_HOST_H
+
+// Host stand-in for DisplayPanel from esphome-display-panel
+// (https://github.com/kdorff/esphome-display-panel), with the same fields
+// and the same static helpers the display headers use.
+//
+// Drawing is an approximation: the panel colour fills the panel, an
+// optional outline is drawn in the text colour, and each line of text is
+// centred using a built in 3x5 font scaled to the font's size. Characters
+// the font doesn't have (such as icon glyphs) are drawn as solid blocks.
+// Like the font renderer on the device, text is drawn with draw_pixel_at().
+
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "esphome-host.h"
+
+struct display_panel_glyph_t {
+    uint32_t codepoint;
+    uint8_t rows[5];  // 3 bits per row, MSB on the left.
+};
+
+static const display_panel_glyph_t DISPLAY_PANEL_GLYPHS[] = {
+    {' ', {0b000, 0b000, 0b000, 0b000, 0b000}},
+    {'!', {0b010, 0b010, 0b010, 0b000, 0b010}},
+    {'%', {0b101, 0b001, 0b010, 0b100, 0b101}},
+    {'(', {0b001, 0b010, 0b010, 0b010, 0b001}},
+    {')', {0b100, 0b010, 0b010, 0b010, 0b100}},
+    {'+', {0b000, 0b010, 0b111, 0b010, 0b000}},
+    {',', {0b000, 0b000, 0b000, 0b010, 0b100}},
+    {'-', {0b000, 0b000, 0b111, 0b000, 0b000}},
+    {'.', {0b000, 0b000, 0b000, 0b000, 0b010}},
+    {'/', {0b001, 0b001, 0b010, 0b100, 0b100}},
+    {'0', {0b111, 0b101, 0b101, 0b101, 0b111}},
+    {'1', {0b010, 0b110, 0b010, 0b010, 0b111}},
+    {'2', {0b111, 0b001, 0b111, 0b100, 0b111}},
+    {'3', {0b111, 0b001, 0b111, 0b001, 0b111}},
+    {'4', {0b101, 0b101, 0b111, 0b001, 0b001}},
+    {'5', {0b111, 0b100, 0b111, 0b001, 0b111}},
+    {'6', {0b111, 0b100, 0b111, 0b101, 0b111}},
+    {'7', {0b111, 0b001, 0b001, 0b001, 0b001}},
+    {'8', {0b111, 0b101, 0b111, 0b101, 0b111}},
+    {'9', {0b111, 0b101, 0b111, 0b001, 0b111}},
+    {':', {0b000, 0b010, 0b000, 0b010, 0b000}},
+    {'?', {0b111, 0b001, 0b010, 0b000, 0b010}},
+    {'A', {0b010, 0b101, 0b111, 0b101, 0b101}},
+    {'B', {0b110, 0b101, 0b110, 0b101, 0b110}},
+    {'C', {0b011, 0b100, 0b100, 0b100, 0b011}},
+    {'D', {0b110, 0b101, 0b101, 0b101, 0b110}},
+    {'E', {0b111, 0b100, 0b110, 0b100, 0b111}},
+    {'F', {0b111, 0b100, 0b110, 0b100, 0b100}},
+    {'G', {0b011, 0b100, 0b101, 0b101, 0b011}},
+    {'H', {0b101, 0b101, 0b111, 0b101, 0b101}},
+    {'I', {0b111, 0b010, 0b010, 0b010, 0b111}},
+    {'J', {0b001, 0b001, 0b001, 0b101, 0b010}},
+    {'K', {0b101, 0b101, 0b110, 0b101, 0b101}},
+    {'L', {0b100, 0b100, 0b100, 0b100, 0b111}},
+    {'M', {0b101, 0b111, 0b111, 0b101, 0b101}},
+    {'N', {0b110, 0b101, 0b101, 0b101, 0b101}},
+    {'O', {0b010, 0b101, 0b101, 0b101, 0b010}},
+    {'P', {0b110, 0b101, 0b110, 0b100, 0b100}},
+    {'Q', {0b010, 0b101, 0b101, 0b110, 0b011}},
+    {'R', {0b110, 0b101, 0b110, 0b101, 0b101}},
+    {'S', {0b011, 0b100, 0b010, 0b001, 0b110}},
+    {'T', {0b111, 0b010, 0b010, 0b010, 0b010}},
+    {'U', {0b101, 0b101, 0b101, 0b101, 0b111}},
+    {'V', {0b101, 0b101, 0b101, 0b101, 0b010}},
+    {'W', {0b101, 0b101, 0b111, 0b111, 0b101}},
+    {'X', {0b101, 0b101, 0b010, 0b101, 0b101}},
+    {'Y', {0b101, 0b101, 0b010, 0b010, 0b010}},
+    {'Z', {0b111, 0b001, 0b010, 0b100, 0b111}},
+    {0xB0, {0b010, 0b101, 0b010, 0b000, 0b000}},  // Degree sign.
+};
+
+static const display_panel_glyph_t DISPLAY_PANEL_MISSING_GLYPH = {0, {0b111, 0b111, 0b111, 0b111, 0b111}};
+
+class DisplayPanel {
+    public:
+    int x;
+    int y;
+    int w;
+    int h;
+    std::string name;
+    std::string tag;
+    bool enabled = true;
+    bool touchable = true;
+    bool drawPanelOutline = false;
+    Color color = Color::BLACK;
+    Color textColor = Color::WHITE;
+    esphome::font::Font* font = NULL;
+    esphome::image::Image* image = NULL;
+    int fontVertOffset = 0;
+    int fontHeightOffset = 0;
+    std::vector<std::string> text;
+
+    DisplayPanel(int x_, int y_, int w_, int h_) : x(x_), y(y_), w(w_), h(h_) {}
+
+    void draw(esphome::display::Display &display) {
+        if (!enabled || w <= 0 || h <= 0) {
+            return;
+        }
+        display.filled_rectangle(x, y, w, h, color);
+        if (image != NULL) {
+            drawImage(display);
+        }
+        if (drawPanelOutline) {
+            display.rectangle(x, y, w, h, textColor);
+        }
+        drawText(display);
+    }
+
+    static void drawAllPanels(esphome::display::Display &display, std::vector<DisplayPanel*> &panels) {
+        for (DisplayPanel* panel : panels) {
+            if (panel->enabled) {
+                panel->draw(display);
+            }
+        }
+    }
+
+    static DisplayPanel* touchedPanel(std::vector<DisplayPanel*> &panels, int touchX, int touchY) {
+        for (DisplayPanel* panel : panels) {
+            if (panel->enabled && panel->touchable &&
+                    touchX >= panel->x && touchX < panel->x + panel->w &&
+                    touchY >= panel->y && touchY < panel->y + panel->h) {
+                return panel;
+            }
+        }
+        return NULL;
+    }
+
+    private:
+    // The image, centred, as Display::image() draws it.
+    void drawImage(esphome::display::Display &display) {
+        const int imageX = x + (w - image->get_width()) / 2;
+        const int imageY = y + (h - image->get_height()) / 2;
+        image->draw(imageX, imageY, &display, textColor, color);
+    }
+
+    void drawText(esphome::display::Display &display) {
+        if (text.empty()) {
+            return;
+        }
+        const int fontSize = font != NULL ? font->size : 12;
+        const int scale = std::max(1, fontSize / 7);
+        const int lineHeight = std::max(1, 6 * scale + fontHeightOffset);
+        int lineY = y + (h - lineHeight * (int) text.size()) / 2 + fontVertOffset;
+        for (const std::string &line : text) {
+            int characters = 0;
+            for (size_t i = 0; i < line.size();) {
+                decode(line, i);
+                characters++;
+            }
+            const int lineWidth = characters * 4 * scale - scale;
+            int glyphX = x + (w - lineWidth) / 2;
+            for (size_t i = 0; i < line.size();) {
+                const display_panel_glyph_t &glyph = glyphFor(decode(line, i));
+                for (int row = 0; row < 5 * scale; row++) {
+                    for (int column = 0; column < 3 * scale; column++) {
+                        if (glyph.rows[row / scale] & (0b100 >> (column / scale))) {
+                            display.draw_pixel_at(glyphX + column, lineY + row, textColor);
+                        }
+                    }
+                }
+                glyphX += 4 * scale;
+            }
+            lineY += lineHeight;
+        }
+    }
+
+    static const display_panel_glyph_t &glyphFor(uint32_t codepoint) {
+        if (codepoint >= 'a' && codepoint <= 'z') {
+            codepoint -= 'a' - 'A';
+        }
+        for (const display_panel_glyph_t &glyph : DISPLAY_PANEL_GLYPHS) {
+            if (glyph.codepoint == codepoint) {
+                return glyph;
+            }
+        }
+        return DISPLAY_PANEL_MISSING_GLYPH;
+    }
+
+    // The UTF-8 character at i, moving i past it. Like the font renderer,
+    // this doesn't allocate.
+    static uint32_t decode(const std::string &utf8, size_t &i) {
+        const uint8_t lead = utf8[i];
+        const int length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+        uint32_t codepoint = length == 1 ? lead : lead & (0x7F >> length);
+        for (int b = 1; b < length && i + b < utf8.size(); b++) {
+            codepoint = (codepoint << 6) | (utf8[i + b] & 0x3F);
+        }
+        i += length;
+        return codepoint;
+    }
+};
+
+#endif  // DISPLAY_PANEL_HOST_H
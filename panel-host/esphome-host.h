@@ -0,0 +1,457 @@
+#ifndef ESPHOME_HOST_H
+#define ESPHOME_HOST_H
+
+// The parts of ESPHome the display headers (tft-office, tft-back-door)
+// use, so they can be built and exercised on a Linux host. See README.md.
+//
+// Time is simulated: millis() and the clock only move when hostAdvance()
+// is called, so runs are repeatable.
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef bool boolean;
+
+#define ESPHOME_HOST_LOG(level, tag, ...) \
+    do { printf("[%s][%s] ", level, tag); printf(__VA_ARGS__); printf("\n"); } while (0)
+#define ESP_LOGE(tag, ...) ESPHOME_HOST_LOG("E", tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ESPHOME_HOST_LOG("W", tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ESPHOME_HOST_LOG("I", tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) do { } while (0)
+
+// Simulated time since boot, and the wall clock time at boot. Atomic, as
+// a render thread (panel-render-task.h) reads it too.
+std::atomic<uint64_t> hostMicros{0};
+time_t hostBootEpoch = 1700000000;
+
+inline uint32_t millis() {
+    return (uint32_t) (hostMicros / 1000);
+}
+
+inline uint32_t micros() {
+    return (uint32_t) hostMicros;
+}
+
+inline void hostAdvance(uint32_t ms) {
+    hostMicros += (uint64_t) ms * 1000;
+}
+
+namespace esphome {
+
+struct Color {
+    union {
+        struct {
+            uint8_t r, g, b, w;
+        };
+        uint32_t raw_32;
+    };
+
+    Color() : raw_32(0) {}
+    Color(uint8_t red, uint8_t green, uint8_t blue) : r(red), g(green), b(blue), w(0) {}
+
+    bool is_on() const { return raw_32 != 0; }
+    bool operator==(const Color &other) const { return raw_32 == other.raw_32; }
+    bool operator!=(const Color &other) const { return raw_32 != other.raw_32; }
+
+    static const Color BLACK;
+    static const Color WHITE;
+};
+
+inline const Color Color::BLACK = Color(0, 0, 0);
+inline const Color Color::WHITE = Color(255, 255, 255);
+
+inline std::string str_sprintf(const char* format, ...) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return text;
+}
+
+inline std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
+    return str_sprintf("%.*f", accuracy_decimals, value);
+}
+
+struct ESPTime {
+    uint8_t second = 0;
+    uint8_t minute = 0;
+    uint8_t hour = 0;
+    uint8_t day_of_week = 1;
+    uint8_t day_of_month = 1;
+    uint16_t day_of_year = 1;
+    uint8_t month = 1;
+    uint16_t year = 1970;
+    time_t timestamp = 0;
+
+    static ESPTime from_epoch_local(time_t epoch) {
+        struct tm parts;
+        gmtime_r(&epoch, &parts);
+        ESPTime time;
+        time.second = parts.tm_sec;
+        time.minute = parts.tm_min;
+        time.hour = parts.tm_hour;
+        time.day_of_week = parts.tm_wday + 1;
+        time.day_of_month = parts.tm_mday;
+        time.day_of_year = parts.tm_yday + 1;
+        time.month = parts.tm_mon + 1;
+        time.year = parts.tm_year + 1900;
+        time.timestamp = epoch;
+        return time;
+    }
+
+    size_t strftime(char* buffer, size_t size, const char* format) {
+        struct tm parts;
+        gmtime_r(&timestamp, &parts);
+        return ::strftime(buffer, size, format, &parts);
+    }
+
+    std::string strftime(const std::string &format) {
+        char text[128];
+        const size_t length = strftime(text, sizeof(text), format.c_str());
+        return std::string(text, length);
+    }
+
+    bool is_valid() const { return year >= 2019; }
+
+    void increment_second() {
+        *this = from_epoch_local(timestamp + 1);
+    }
+
+    bool operator<(const ESPTime &other) const { return timestamp < other.timestamp; }
+    bool operator>(const ESPTime &other) const { return timestamp > other.timestamp; }
+    bool operator==(const ESPTime &other) const { return timestamp == other.timestamp; }
+};
+
+class Component {
+    public:
+    virtual void setup() {}
+    virtual void loop() {}
+};
+
+class PollingComponent : public Component {
+    public:
+    virtual void update() = 0;
+};
+
+// Timeouts, run by call() (the host's main loop) once millis() reaches
+// them. Setting a timeout replaces one of the same component and name.
+class Scheduler {
+    public:
+    void set_timeout(Component* component, const std::string &name, uint32_t timeout, std::function<void()> func) {
+        cancel_timeout(component, name);
+        timeouts.push_back({component, name, millis() + timeout, func});
+    }
+
+    bool cancel_timeout(Component* component, const std::string &name) {
+        for (size_t i = 0; i < timeouts.size(); i++) {
+            if (timeouts[i].component == component && timeouts[i].name == name) {
+                timeouts.erase(timeouts.begin() + i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Run the timeouts that are due. Ones they set run on a later call.
+    void call() {
+        std::vector<std::function<void()>> due;
+        for (size_t i = 0; i < timeouts.size();) {
+            if ((int32_t) (millis() - timeouts[i].at) >= 0) {
+                due.push_back(timeouts[i].func);
+                timeouts.erase(timeouts.begin() + i);
+            }
+            else {
+                i++;
+            }
+        }
+        for (auto &func : due) {
+            func();
+        }
+    }
+
+    private:
+    struct timeout_t {
+        Component* component;
+        std::string name;
+        uint32_t at;
+        std::function<void()> func;
+    };
+    std::vector<timeout_t> timeouts;
+};
+
+class Application {
+    public:
+    Scheduler scheduler;
+};
+
+inline Application App;
+
+namespace time {
+class RealTimeClock : public PollingComponent {
+    public:
+    void update() override {}
+
+    ESPTime now() {
+        return ESPTime::from_epoch_local(hostBootEpoch + (time_t) (hostMicros / 1000000));
+    }
+};
+}  // namespace time
+
+namespace sensor {
+class Sensor {
+    public:
+    float state = 0;
+
+    bool has_state() const { return hasState; }
+
+    void add_on_state_callback(std::function<void(float)> callback) {
+        callbacks.push_back(callback);
+    }
+
+    void publish_state(float value) {
+        state = value;
+        hasState = true;
+        for (auto &callback : callbacks) {
+            callback(value);
+        }
+    }
+
+    private:
+    bool hasState = false;
+    std::vector<std::function<void(float)>> callbacks;
+};
+}  // namespace sensor
+
+namespace text_sensor {
+class TextSensor {
+    public:
+    std::string state;
+
+    bool has_state() const { return hasState; }
+
+    void add_on_state_callback(std::function<void(std::string)> callback) {
+        callbacks.push_back(callback);
+    }
+
+    void publish_state(const std::string &value) {
+        state = value;
+        hasState = true;
+        for (auto &callback : callbacks) {
+            callback(value);
+        }
+    }
+
+    private:
+    bool hasState = false;
+    std::vector<std::function<void(std::string)>> callbacks;
+};
+}  // namespace text_sensor
+
+namespace binary_sensor {
+class BinarySensor {
+    public:
+    bool state = false;
+
+    bool has_state() const { return hasState; }
+
+    void add_on_state_callback(std::function<void(bool)> callback) {
+        callbacks.push_back(callback);
+    }
+
+    void publish_state(bool value) {
+        state = value;
+        hasState = true;
+        for (auto &callback : callbacks) {
+            callback(value);
+        }
+    }
+
+    private:
+    bool hasState = false;
+    std::vector<std::function<void(bool)>> callbacks;
+};
+}  // namespace binary_sensor
+
+namespace output {
+class FloatOutput {
+    public:
+    float level = 0;
+
+    void set_level(float value) { level = value; }
+};
+}  // namespace output
+
+namespace i2c {
+enum ErrorCode {
+    ERROR_OK = 0,
+};
+
+// Counts what is written; there is nothing on the bus.
+class I2CBus {
+    public:
+    uint32_t writes = 0;
+    uint64_t bytesWritten = 0;
+
+    ErrorCode write(uint8_t address, const uint8_t* buffer, size_t len) {
+        writes++;
+        bytesWritten += len;
+        return ERROR_OK;
+    }
+};
+}  // namespace i2c
+
+namespace globals {
+template <typename T>
+class RestoringGlobalsComponent {
+    public:
+    explicit RestoringGlobalsComponent(T initial) : current(initial) {}
+
+    T &value() { return current; }
+
+    private:
+    T current;
+};
+}  // namespace globals
+
+namespace font {
+// Only the size is known on the host. See display-panel.h for how text
+// is drawn.
+class Font {
+    public:
+    explicit Font(int size_) : size(size_) {}
+
+    int size;
+};
+}  // namespace font
+
+namespace display {
+class Display;
+}  // namespace display
+
+namespace image {
+enum ImageType {
+    IMAGE_TYPE_BINARY = 0,
+    IMAGE_TYPE_GRAYSCALE = 1,
+    IMAGE_TYPE_RGB24 = 2,
+    IMAGE_TYPE_RGB565 = 3,
+    IMAGE_TYPE_RGBA = 4,
+};
+
+// There is no image data on the host; draw() draws a grey gradient the
+// size of the image.
+class Image {
+    public:
+    Image(int width_, int height_) : width(width_), height(height_) {}
+    Image(const uint8_t* data_start, int width_, int height_, ImageType type) : width(width_), height(height_) {}
+    virtual ~Image() = default;
+
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+
+    virtual void draw(int x, int y, display::Display* display, Color color_on, Color color_off);
+
+    private:
+    int width;
+    int height;
+};
+}  // namespace image
+
+namespace display {
+
+enum DisplayType {
+    DISPLAY_TYPE_BINARY = 1,
+    DISPLAY_TYPE_GRAYSCALE = 2,
+    DISPLAY_TYPE_COLOR = 3,
+};
+
+enum ColorOrder {
+    COLOR_ORDER_RGB = 0,
+    COLOR_ORDER_BGR = 1,
+    COLOR_ORDER_GRB = 2,
+};
+
+enum ColorBitness {
+    COLOR_BITNESS_888 = 0,
+    COLOR_BITNESS_565 = 1,
+    COLOR_BITNESS_332 = 2,
+};
+
+class Display : public PollingComponent {
+    public:
+    virtual void draw_pixel_at(int x, int y, Color color) = 0;
+    virtual int get_width() = 0;
+    virtual int get_height() = 0;
+    virtual DisplayType get_display_type() = 0;
+
+    virtual void fill(Color color) {
+        filled_rectangle(0, 0, get_width(), get_height(), color);
+    }
+
+    void filled_rectangle(int x1, int y1, int width, int height, Color color) {
+        for (int y = y1; y < y1 + height; y++) {
+            for (int x = x1; x < x1 + width; x++) {
+                draw_pixel_at(x, y, color);
+            }
+        }
+    }
+
+    void rectangle(int x1, int y1, int width, int height, Color color) {
+        for (int x = x1; x < x1 + width; x++) {
+            draw_pixel_at(x, y1, color);
+            draw_pixel_at(x, y1 + height - 1, color);
+        }
+        for (int y = y1; y < y1 + height; y++) {
+            draw_pixel_at(x1, y, color);
+            draw_pixel_at(x1 + width - 1, y, color);
+        }
+    }
+
+    // As in ESPHome, the default is a draw_pixel_at() per pixel. Only
+    // RGB565 is supported here.
+    virtual void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t* ptr,
+            ColorOrder order, ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
+        const int stride = x_offset + w + x_pad;
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                const uint8_t* pixel = ptr + ((y_offset + y) * stride + x_offset + x) * 2;
+                const uint16_t value = big_endian ? (pixel[0] << 8) | pixel[1] : (pixel[1] << 8) | pixel[0];
+                draw_pixel_at(x_start + x, y_start + y, from565(value));
+            }
+        }
+    }
+
+    static Color from565(uint16_t value) {
+        const uint8_t red = (value >> 11) & 0x1F;
+        const uint8_t green = (value >> 5) & 0x3F;
+        const uint8_t blue = value & 0x1F;
+        return Color((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2));
+    }
+};
+
+typedef Display DisplayBuffer;
+
+}  // namespace display
+
+namespace image {
+inline void Image::draw(int x, int y, display::Display* display, Color color_on, Color color_off) {
+    for (int row = 0; row < height; row++) {
+        for (int column = 0; column < width; column++) {
+            const uint8_t level = (uint8_t) ((row + column) * 255 / (width + height));
+            display->draw_pixel_at(x + column, y + row, Color(level, level, level));
+        }
+    }
+}
+}  // namespace image
+}  // namespace esphome
+
+using namespace esphome;
+
+#endif  // ESPHOME_HOST_H
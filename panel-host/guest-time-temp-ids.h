@@ -0,0 +1,25 @@
+#ifndef GUEST_TIME_TEMP_IDS_H
+#define GUEST_TIME_TEMP_IDS_H
+
+// The ids from guest-time-temp-esp32.yaml that room-time-temp-wind.h
+// uses, as the generated ESPHome code would declare them. Font sizes
+// match the YAML.
+
+#include "esphome-host.h"
+
+esphome::font::Font* font_time = new esphome::font::Font(34);
+esphome::font::Font* font_alarm = new esphome::font::Font(12);
+esphome::font::Font* font_date = new esphome::font::Font(15);
+esphome::font::Font* font_temp = new esphome::font::Font(22);
+esphome::font::Font* font_temp_label = new esphome::font::Font(10);
+
+esphome::time::RealTimeClock* esptime = new esphome::time::RealTimeClock();
+
+esphome::sensor::Sensor* back_yard_temperature = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* inside_temperature = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* wind_speed = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* wind_gust_speed = new esphome::sensor::Sensor();
+esphome::text_sensor::TextSensor* wind_direction = new esphome::text_sensor::TextSensor();
+esphome::text_sensor::TextSensor* next_alarm = new esphome::text_sensor::TextSensor();
+
+#endif  // GUEST_TIME_TEMP_IDS_H
@@ -0,0 +1,46 @@
+#ifndef HOST_ALLOC_H
+#define HOST_ALLOC_H
+
+// Counts heap allocations (every operator new) on the host, like
+// alloc-count.h in tft-office does on the device. Don't build with
+// -DALLOC_COUNT_ENABLED as well.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+// GCC can't tell that these operators pair malloc() with free().
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+uint64_t hostAllocations = 0;
+
+void* operator new(size_t size) {
+    hostAllocations++;
+    void* allocated = malloc(size == 0 ? 1 : size);
+    if (allocated == NULL) {
+        throw std::bad_alloc();
+    }
+    return allocated;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* allocated) noexcept {
+    free(allocated);
+}
+
+void operator delete[](void* allocated) noexcept {
+    free(allocated);
+}
+
+void operator delete(void* allocated, size_t size) noexcept {
+    free(allocated);
+}
+
+void operator delete[](void* allocated, size_t size) noexcept {
+    free(allocated);
+}
+
+#endif  // HOST_ALLOC_H
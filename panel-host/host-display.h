@@ -0,0 +1,177 @@
+#ifndef HOST_DISPLAY_H
+#define HOST_DISPLAY_H
+
+// An in-memory Display that counts how it is written to.
+//
+// Every draw_pixel_at() call and every draw_pixels_at() call counts as one
+// transaction: on an ili9341 driven directly over SPI each would need its
+// own address window (CASET, PASET and RAMWR: 3 command bytes and 8
+// parameter bytes) before the RGB565 pixel payload. spiBytes() estimates
+// the bus traffic that implies. writeCounts counts the writes to each
+// pixel, to show where a frame draws over itself.
+//
+// With buffered set, it models ESPHome's ili9xxx display with a buffer,
+// as tft-office.yaml and tft-back-door.yaml use it. With a rotation (they
+// use 270) ili9xxx hands draw_pixels_at() to Display's default, a
+// draw_pixel_at() per pixel, and every draw_pixel_at() only writes the
+// buffer. update() then sends the window around everything written
+// since the last update() as one transaction. transactions counts those,
+// and spiBytes() counts the whole window, written or not.
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include "esphome-host.h"
+
+#define HOST_DISPLAY_WINDOW_BYTES (11)
+
+class HostDisplay : public esphome::display::Display {
+    public:
+    int width;
+    int height;
+    // The current contents, one Color per pixel.
+    std::vector<Color> pixels;
+
+    uint64_t transactions = 0;
+    uint64_t pixelsWritten = 0;
+    // Writes to each pixel (saturating), like pixels.
+    std::vector<uint16_t> writeCounts;
+
+    bool buffered = false;
+    // Buffered: draw_pixel_at() calls, and the pixels update() sent.
+    uint64_t bufferWrites = 0;
+    uint64_t windowPixels = 0;
+
+    HostDisplay(int width_, int height_)
+        : width(width_), height(height_), pixels(width_ * height_), writeCounts(width_ * height_) {}
+
+    void draw_pixel_at(int x, int y, Color color) override {
+        if (buffered) {
+            bufferWrites++;
+            addToWindow(x, y, 1, 1);
+        }
+        else {
+            transactions++;
+        }
+        set(x, y, color);
+    }
+
+    // One windowed bulk transfer, rather than a draw_pixel_at() per pixel.
+    void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t* ptr,
+            esphome::display::ColorOrder order, esphome::display::ColorBitness bitness,
+            bool big_endian, int x_offset, int y_offset, int x_pad) override {
+        if (buffered) {
+            esphome::display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian,
+                x_offset, y_offset, x_pad);
+            return;
+        }
+        transactions++;
+        const int stride = x_offset + w + x_pad;
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                const uint8_t* pixel = ptr + ((y_offset + y) * stride + x_offset + x) * 2;
+                const uint16_t value = big_endian ? (pixel[0] << 8) | pixel[1] : (pixel[1] << 8) | pixel[0];
+                set(x_start + x, y_start + y, from565(value));
+            }
+        }
+    }
+
+    void fill(Color color) override {
+        // Like the ili9xxx buffer clear: one transfer of the whole frame.
+        if (buffered) {
+            addToWindow(0, 0, width, height);
+        }
+        else {
+            transactions++;
+        }
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                set(x, y, color);
+            }
+        }
+    }
+
+    int get_width() override {
+        return width;
+    }
+
+    int get_height() override {
+        return height;
+    }
+
+    esphome::display::DisplayType get_display_type() override {
+        return esphome::display::DISPLAY_TYPE_COLOR;
+    }
+
+    void update() override {
+        if (!buffered || windowW == 0) {
+            return;
+        }
+        transactions++;
+        windowPixels += (uint64_t) windowW * windowH;
+        windowW = 0;
+        windowH = 0;
+    }
+
+    Color get(int x, int y) const {
+        return pixels[y * width + x];
+    }
+
+    // Estimated SPI bytes for everything written (or, buffered, sent) so
+    // far.
+    uint64_t spiBytes() const {
+        return transactions * HOST_DISPLAY_WINDOW_BYTES + (buffered ? windowPixels : pixelsWritten) * 2;
+    }
+
+    void resetCounts() {
+        transactions = 0;
+        pixelsWritten = 0;
+        bufferWrites = 0;
+        windowPixels = 0;
+        std::fill(writeCounts.begin(), writeCounts.end(), 0);
+    }
+
+    private:
+    // Buffered: the area written since the last update().
+    int windowX = 0;
+    int windowY = 0;
+    int windowW = 0;
+    int windowH = 0;
+
+    void addToWindow(int x, int y, int w, int h) {
+        const int left = std::max(x, 0);
+        const int top = std::max(y, 0);
+        const int right = std::min(x + w, width);
+        const int bottom = std::min(y + h, height);
+        if (left >= right || top >= bottom) {
+            return;
+        }
+        if (windowW == 0) {
+            windowX = left;
+            windowY = top;
+            windowW = right - left;
+            windowH = bottom - top;
+            return;
+        }
+        const int windowRight = std::max(windowX + windowW, right);
+        const int windowBottom = std::max(windowY + windowH, bottom);
+        windowX = std::min(windowX, left);
+        windowY = std::min(windowY, top);
+        windowW = windowRight - windowX;
+        windowH = windowBottom - windowY;
+    }
+
+    void set(int x, int y, Color color) {
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            return;
+        }
+        pixelsWritten++;
+        uint16_t &writes = writeCounts[y * width + x];
+        writes += writes < UINT16_MAX;
+        // Stored as the display would show it, quantized to RGB565.
+        const uint16_t value = ((color.r & 0xF8) << 8) | ((color.g & 0xFC) << 3) | (color.b >> 3);
+        pixels[y * width + x] = from565(value);
+    }
+};
+
+#endif  // HOST_DISPLAY_H
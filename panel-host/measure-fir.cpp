@@ -0,0 +1,193 @@
+// Measures MultiChannelFIR (data-smoothing.h) on the host, against the
+// single-channel observeSample() and recentMinForSample() it would
+// replace.
+//
+// For 1, 4, 16 and 64 channels it smooths the same readings twice, each
+// through the FIR and then the recentMin smoothing:
+//
+// * observeSample() then recentMinForSample(), a call each per channel.
+//   Their state is global, one channel's worth, so for more than one
+//   channel each channel's taps, position and recentMin are swapped in
+//   before its calls and out after, as N channels of the existing code
+//   would need.
+// * One MultiChannelFIR<N>: observeSamples() then recentMinForSamples()
+//   once a round, the taps of every channel side by side.
+//
+// Their outputs are checked a stage at a time. observeSample() sums its
+// taps in double, so where the average is a whole number it can come out
+// 1 lower than MultiChannelFIR's exact one; it fails if the averages ever
+// differ by more. recentMinForSamples() must then match
+// recentMinForSample() exactly on the same averages. It prints the
+// channel samples per microsecond of each, the speedup and how many
+// averages were 1 lower. See README.md to build.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "esphome-host.h"
+
+// recentMinForSample() logs every sample. Printing those would time the
+// terminal, not the filters.
+#undef ESP_LOGI
+#define ESP_LOGI(tag, ...) do { } while (0)
+
+#include "data-smoothing.h"
+
+// Channel samples smoothed per run, whatever the channel count.
+#define CHANNEL_SAMPLES (1 << 22)
+// Readings, made up front and used over and over, a round at a time.
+#define READINGS (1 << 16)
+
+struct fir_result_t {
+    double samplesPerUs;
+    std::vector<int> averages;
+    std::vector<int> outputs;
+};  // One run's throughput, and its averages and outputs for the first READINGS samples
+
+// data-smoothing.h's globals, for one channel.
+struct channel_state_t {
+    int taps[NUM_FIR_TAPS];
+    int tapPosition;
+    long numSamplesObserved;
+    int recentMin;
+};  // A channel of the single-channel filter, while swapped out
+
+static std::vector<int> readings(READINGS);
+
+// The readings of a round. READINGS is a multiple of every channel count.
+const int* roundReadings(int round, int channels) {
+    return &readings[(round * channels) & (READINGS - 1)];
+}
+
+void swapIn(const channel_state_t &state) {
+    memcpy(taps, state.taps, sizeof(taps));
+    tapPosition = state.tapPosition;
+    numSamplesObserved = state.numSamplesObserved;
+    recentMin = state.recentMin;
+}
+
+void swapOut(channel_state_t &state) {
+    memcpy(state.taps, taps, sizeof(taps));
+    state.tapPosition = tapPosition;
+    state.numSamplesObserved = numSamplesObserved;
+    state.recentMin = recentMin;
+}
+
+template <int N>
+fir_result_t runSingleChannel() {
+    static channel_state_t channels[N];
+    initFIR();
+    recentMin = -1;
+    for (int c = 0; c < N; c++) {
+        swapOut(channels[c]);
+    }
+    fir_result_t result;
+    result.averages.reserve(READINGS);
+    result.outputs.reserve(READINGS);
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < CHANNEL_SAMPLES / N; round++) {
+        const int* in = roundReadings(round, N);
+        for (int c = 0; c < N; c++) {
+            if (N > 1) {
+                swapIn(channels[c]);
+            }
+            const int averaged = observeSample(in[c]);
+            const int smoothed = recentMinForSample(averaged);
+            if (N > 1) {
+                swapOut(channels[c]);
+            }
+            if (result.outputs.size() < READINGS) {
+                result.averages.push_back(averaged);
+                result.outputs.push_back(smoothed);
+            }
+        }
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    result.samplesPerUs = CHANNEL_SAMPLES / us;
+    return result;
+}
+
+template <int N>
+fir_result_t runMultiChannel() {
+    static MultiChannelFIR<N> fir;
+    int averaged[N];
+    int smoothed[N];
+    fir_result_t result;
+    result.averages.reserve(READINGS);
+    result.outputs.reserve(READINGS);
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < CHANNEL_SAMPLES / N; round++) {
+        fir.observeSamples(roundReadings(round, N), averaged);
+        fir.recentMinForSamples(averaged, smoothed);
+        if (result.outputs.size() < READINGS) {
+            result.averages.insert(result.averages.end(), averaged, averaged + N);
+            result.outputs.insert(result.outputs.end(), smoothed, smoothed + N);
+        }
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    result.samplesPerUs = CHANNEL_SAMPLES / us;
+    return result;
+}
+
+// recentMinForSample() over multi's averages, a channel at a time. true
+// if it gives multi's outputs.
+template <int N>
+bool recentMinsMatch(const fir_result_t &multi) {
+    for (int c = 0; c < N; c++) {
+        recentMin = -1;
+        for (size_t i = c; i < multi.outputs.size(); i += N) {
+            if (recentMinForSample(multi.averages[i]) != multi.outputs[i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Prints a row. Returns false if the outputs differ beyond the rounding.
+template <int N>
+bool measure() {
+    const fir_result_t single = runSingleChannel<N>();
+    const fir_result_t multi = runMultiChannel<N>();
+    int lower = 0;
+    bool same = single.averages.size() == multi.averages.size();
+    for (size_t i = 0; same && i < single.averages.size(); i++) {
+        const int difference = multi.averages[i] - single.averages[i];
+        lower += difference == 1;
+        same = difference == 0 || difference == 1;
+    }
+    printf("%8d %16.1f %18.1f %8.2fx %10d\n", N, single.samplesPerUs, multi.samplesPerUs,
+        multi.samplesPerUs / single.samplesPerUs, lower);
+    if (!same) {
+        fprintf(stderr, "%d channels: the averages differ\n", N);
+        return false;
+    }
+    if (!recentMinsMatch<N>(multi)) {
+        fprintf(stderr, "%d channels: recentMinForSamples() differs from recentMinForSample()\n", N);
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    // Noisy readings around a water level percentage.
+    uint32_t seed = 1;
+    for (int &reading : readings) {
+        seed = seed * 1664525u + 1013904223u;
+        reading = 50 + (int) ((seed >> 16) % 7);
+    }
+    printf("Channel samples per us, %d per run\n", CHANNEL_SAMPLES);
+    printf("%8s %16s %18s %9s %10s\n", "channels", "observeSample()", "MultiChannelFIR", "speedup", "1 lower");
+    bool same = true;
+    same &= measure<1>();
+    same &= measure<4>();
+    same &= measure<16>();
+    same &= measure<64>();
+    if (!same) {
+        printf("FAIL\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,170 @@
+// Measures drawing the compressed butterfly image (panel-qoi-image.h) on
+// the host, against drawing it raw the way an ESPHome RGB565 image is: a
+// draw_pixel_at() per pixel.
+//
+// Both draw into an RGB565 frame buffer, which must match the checksum the
+// converter (tft-office/images/png-to-qoi565.py) wrote into
+// butterfly-qoi.h. Prints the flash each takes, the decode throughput in
+// pixels/ms and the display calls per draw. It then draws both partly off
+// each edge of the frame buffer: the compressed image must match the raw
+// one and never be asked to draw outside. See README.md to build.
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "esphome-host.h"
+#include "display-panel.h"
+#include "panel-qoi-image.h"
+#include "butterfly-qoi.h"
+
+#define DRAWS (200)
+
+// An RGB565 frame buffer the size of the image. Counts its calls.
+class FrameBuffer : public esphome::display::Display {
+    public:
+    int width;
+    int height;
+    std::vector<uint16_t> pixels;
+    uint64_t calls = 0;
+    // Pixels given to draw_pixels_at() that fall outside.
+    uint64_t outside = 0;
+
+    FrameBuffer(int width_, int height_) : width(width_), height(height_), pixels(width_ * height_) {}
+
+    void draw_pixel_at(int x, int y, Color color) override {
+        calls++;
+        if (x >= 0 && x < width && y >= 0 && y < height) {
+            pixels[y * width + x] = ((color.r & 0xF8) << 8) | ((color.g & 0xFC) << 3) | (color.b >> 3);
+        }
+    }
+
+    void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t* ptr,
+            esphome::display::ColorOrder order, esphome::display::ColorBitness bitness,
+            bool big_endian, int x_offset, int y_offset, int x_pad) override {
+        calls++;
+        const int stride = x_offset + w + x_pad;
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                const uint8_t* pixel = ptr + ((y_offset + y) * stride + x_offset + x) * 2;
+                if (x_start + x >= 0 && x_start + x < width && y_start + y >= 0 && y_start + y < height) {
+                    pixels[(y_start + y) * width + x_start + x] = (pixel[0] << 8) | pixel[1];
+                }
+                else {
+                    outside++;
+                }
+            }
+        }
+    }
+
+    int get_width() override {
+        return width;
+    }
+
+    int get_height() override {
+        return height;
+    }
+
+    esphome::display::DisplayType get_display_type() override {
+        return esphome::display::DISPLAY_TYPE_COLOR;
+    }
+
+    void update() override {
+    }
+
+    // FNV-1a of the big-endian pixels, as png-to-qoi565.py computes it.
+    uint32_t checksum() const {
+        uint32_t hash = 2166136261u;
+        for (uint16_t pixel : pixels) {
+            hash = (hash ^ (pixel >> 8)) * 16777619u;
+            hash = (hash ^ (pixel & 0xFF)) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+// The image stored raw, drawn as ESPHome draws an RGB565 image: each pixel
+// read from flash, made a Color and drawn with draw_pixel_at().
+class RawImage : public esphome::image::Image {
+    public:
+    std::vector<uint8_t> data;
+
+    RawImage(std::vector<uint8_t> data_, int width, int height)
+        : esphome::image::Image(NULL, width, height, esphome::image::IMAGE_TYPE_RGB565), data(data_) {}
+
+    void draw(int x, int y, esphome::display::Display* display, Color colorOn, Color colorOff) override {
+        for (int row = 0; row < get_height(); row++) {
+            for (int column = 0; column < get_width(); column++) {
+                const uint8_t* pixel = &data[(row * get_width() + column) * 2];
+                display->draw_pixel_at(x + column, y + row, esphome::display::Display::from565((pixel[0] << 8) | pixel[1]));
+            }
+        }
+    }
+};
+
+struct image_result_t {
+    double pixelsPerMs;
+    uint64_t callsPerDraw;
+    bool matches;
+};  // Throughput, display calls and whether the pixels were right
+
+image_result_t measure(esphome::image::Image &image) {
+    FrameBuffer frame(image.get_width(), image.get_height());
+    image.draw(0, 0, &frame, Color::WHITE, Color::BLACK);
+    const uint64_t callsPerDraw = frame.calls;
+    const bool matches = frame.checksum() == BUTTERFLY_QOI_CHECKSUM;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < DRAWS; i++) {
+        image.draw(0, 0, &frame, Color::WHITE, Color::BLACK);
+    }
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const double pixels = (double) DRAWS * image.get_width() * image.get_height();
+    return image_result_t{pixels / ms, callsPerDraw, matches};
+}
+
+// Draw both images at (x, y). true if they drew the same pixels and the
+// compressed one stayed on the frame buffer.
+bool clipsLikeRaw(esphome::image::Image &raw, esphome::image::Image &qoi, int x, int y) {
+    FrameBuffer rawFrame(raw.get_width(), raw.get_height());
+    FrameBuffer qoiFrame(qoi.get_width(), qoi.get_height());
+    raw.draw(x, y, &rawFrame, Color::WHITE, Color::BLACK);
+    qoi.draw(x, y, &qoiFrame, Color::WHITE, Color::BLACK);
+    if (qoiFrame.outside > 0 || qoiFrame.pixels != rawFrame.pixels) {
+        printf("FAIL: drawn at (%d, %d), %llu pixels outside\n", x, y, (unsigned long long) qoiFrame.outside);
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    PanelQoiImage qoi(BUTTERFLY_QOI, sizeof(BUTTERFLY_QOI), BUTTERFLY_QOI_WIDTH, BUTTERFLY_QOI_HEIGHT);
+
+    // The raw pixels, decoded once.
+    std::vector<uint8_t> raw(BUTTERFLY_QOI_WIDTH * BUTTERFLY_QOI_HEIGHT * 2);
+    PanelQoiDecoder decoder(BUTTERFLY_QOI, sizeof(BUTTERFLY_QOI));
+    for (int row = 0; row < BUTTERFLY_QOI_HEIGHT; row++) {
+        decoder.decodeLine(&raw[row * BUTTERFLY_QOI_WIDTH * 2], BUTTERFLY_QOI_WIDTH);
+    }
+    RawImage rawImage(raw, BUTTERFLY_QOI_WIDTH, BUTTERFLY_QOI_HEIGHT);
+
+    const image_result_t rawResult = measure(rawImage);
+    const image_result_t qoiResult = measure(qoi);
+
+    printf("butterfly, %dx%d, drawn %d times\n", BUTTERFLY_QOI_WIDTH, BUTTERFLY_QOI_HEIGHT, DRAWS);
+    printf("%-8s %12s %12s %14s %14s\n", "", "flash bytes", "RAM bytes", "pixels/ms", "calls/draw");
+    printf("%-8s %12zu %12d %14.0f %14llu\n", "raw", raw.size(), 0,
+        rawResult.pixelsPerMs, (unsigned long long) rawResult.callsPerDraw);
+    printf("%-8s %12zu %12d %14.0f %14llu\n", "qoi", sizeof(BUTTERFLY_QOI), BUTTERFLY_QOI_WIDTH * 2,
+        qoiResult.pixelsPerMs, (unsigned long long) qoiResult.callsPerDraw);
+    if (!rawResult.matches || !qoiResult.matches) {
+        printf("FAIL: the drawn pixels don't match the converter's checksum\n");
+        return 1;
+    }
+    const int offsets[][2] = {{-37, 0}, {0, -11}, {53, 0}, {0, 71}, {-37, -11}, {53, 71}, {-300, 0}, {300, 0}};
+    for (const auto &offset : offsets) {
+        if (!clipsLikeRaw(rawImage, qoi, offset[0], offset[1])) {
+            return 1;
+        }
+    }
+    return 0;
+}
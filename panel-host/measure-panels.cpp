@@ -0,0 +1,173 @@
+// Measures how a TFT layout writes to the display, on the host.
+//
+// Runs a simulated minute of frames (one every 100ms, as on the device)
+// and draws each frame twice, with the panels in the same state:
+//
+// * "full redraw": the old drawPanels(). Clear the screen (tft-office ran
+//   with auto_clear_enabled) and draw every panel.
+// * "drawPanels()": the current drawPanels() (damage tracking, bitmap
+//   cache and batched writes).
+//
+// Both displays are compared after every frame, so a difference in what
+// ends up on screen is reported as an error. Heap allocations made by
+// updatePanelStates() and drawPanels() are counted too. See README.md to
+// build.
+//
+// With -DPANEL_BAND_RENDERING (tft-office only) drawPanels() draws band by
+// band (panel-band.h) and the bands are written to the display.
+//
+// With -DHOST_DISPLAY_BUFFERED both displays model the buffered ili9xxx
+// the YAMLs configure (see host-display.h): "transactions" are then
+// update()s, "pixels" are writes into the buffer and the SPI bytes are
+// the windows update() sends.
+
+#include <stdio.h>
+#include "host-alloc.h"
+#include "host-display.h"
+
+#if defined(TFT_OFFICE)
+#include "tft-office-ids.h"
+#include "tft-room-time-temp-wind.h"
+#elif defined(TFT_BACK_DOOR)
+#include "tft-back-door-ids.h"
+#include "tft-door-monitor.h"
+#else
+#error "Define TFT_OFFICE or TFT_BACK_DOOR"
+#endif
+
+#ifdef PANEL_BAND_RENDERING
+// Writes the bands to a HostDisplay, one transaction per band.
+class HostBandOutput : public PanelBandOutput {
+    public:
+    HostDisplay &display;
+
+    HostBandOutput(HostDisplay &display_) : display(display_) {}
+
+    void write(int x, int y, int w, int h, const uint8_t* pixels, int stride) override {
+        display.draw_pixels_at(x, y, w, h, pixels, esphome::display::COLOR_ORDER_RGB, esphome::display::COLOR_BITNESS_565,
+            true, 0, 0, stride / 2 - w);
+    }
+};
+#endif
+
+#if defined(HOST_DISPLAY_BUFFERED) && defined(PANEL_BAND_RENDERING)
+#error "The bands are written to the ili9341 directly, not through a buffer"
+#endif
+
+#define FRAMES (600)
+#define FRAME_MS (100)
+
+#if defined(TFT_OFFICE)
+static const char* LAYOUT = "tft-office";
+
+void drawFullFrame(HostDisplay &display) {
+    display.fill(Color::BLACK);
+    DisplayPanel::drawAllPanels(display, pages[pageNumber]);
+    flashPanel.draw(display);
+}
+
+// Sensor updates and a brightness touch during the minute.
+void simulate(int frame) {
+    if (frame == 0) {
+        inside_temperature->publish_state(21.4);
+        back_yard_temperature->publish_state(8.2);
+        wind_speed->publish_state(12);
+        wind_direction->publish_state("NW");
+    }
+    if (frame == 200) {
+        enableFlash("Brightness", "Increased to %.0f%%", 51.0f);
+    }
+    if (frame == 350) {
+        wind_gust_speed->publish_state(20);
+    }
+    if (frame == 500) {
+        back_yard_temperature->publish_state(7.9);
+    }
+}
+#else
+static const char* LAYOUT = "tft-back-door";
+
+void drawFullFrame(HostDisplay &display) {
+    DisplayPanel::drawAllPanels(display, panels);
+}
+
+// Doors opening and closing, and the temperature arriving late (which
+// changes the width of timePanel).
+void simulate(int frame) {
+    if (frame == 0) {
+        back_door_autolock->publish_state(true);
+        front_door_autolock->publish_state(false);
+    }
+    if (frame == 150) {
+        back_door_sensor->publish_state(true);
+    }
+    if (frame == 300) {
+        back_yard_temperature->publish_state(8.2);
+    }
+    if (frame == 450) {
+        back_door_sensor->publish_state(false);
+    }
+}
+#endif
+
+int main() {
+    HostDisplay full(WIDTH, HEIGHT);
+    HostDisplay damaged(WIDTH, HEIGHT);
+#ifdef HOST_DISPLAY_BUFFERED
+    full.buffered = true;
+    damaged.buffered = true;
+#endif
+    full.fill(Color::BLACK);
+#ifdef PANEL_BAND_RENDERING
+    HostBandOutput bandOutput(damaged);
+    panelBands.begin(&bandOutput);
+    initializePanels(panelBands.display);
+#else
+    initializePanels(damaged);
+#endif
+    full.resetCounts();
+    damaged.resetCounts();
+
+    int mismatchedFrames = 0;
+    int changedFrames = 0;
+    uint64_t updateAllocations = 0;
+    uint64_t drawAllocations = 0;
+    for (int frame = 0; frame < FRAMES; frame++) {
+        simulate(frame);
+        const uint64_t allocationsBefore = hostAllocations;
+        updatePanelStates();
+        const uint64_t allocationsAfterUpdate = hostAllocations;
+        drawFullFrame(full);
+        full.update();
+        const uint64_t transactionsBefore = damaged.transactions;
+        const uint64_t allocationsBeforeDraw = hostAllocations;
+        drawPanels();
+        damaged.update();
+        // The first frame sets up the panel text and the caches.
+        if (frame > 0) {
+            updateAllocations += allocationsAfterUpdate - allocationsBefore;
+            drawAllocations += hostAllocations - allocationsBeforeDraw;
+        }
+        if (damaged.transactions != transactionsBefore) {
+            changedFrames++;
+        }
+        if (full.pixels != damaged.pixels) {
+            mismatchedFrames++;
+            fprintf(stderr, "frame %d: screens differ\n", frame);
+        }
+        hostAdvance(FRAME_MS);
+    }
+
+    printf("%s, %d frames\n", LAYOUT, FRAMES);
+    printf("%-14s %14s %14s %14s\n", "", "transactions", "pixels", "est. SPI bytes");
+    printf("%-14s %14.1f %14.0f %14.0f  (per frame)\n", "full redraw",
+        (double) full.transactions / FRAMES, (double) full.pixelsWritten / FRAMES, (double) full.spiBytes() / FRAMES);
+    printf("%-14s %14.1f %14.0f %14.0f  (per frame)\n", "drawPanels()",
+        (double) damaged.transactions / FRAMES, (double) damaged.pixelsWritten / FRAMES, (double) damaged.spiBytes() / FRAMES);
+    printf("%d of %d frames changed anything. Per changed frame, drawPanels() made %.1f transactions for %.0f pixels.\n",
+        changedFrames, FRAMES, changedFrames == 0 ? 0.0 : (double) damaged.transactions / changedFrames,
+        changedFrames == 0 ? 0.0 : (double) damaged.pixelsWritten / changedFrames);
+    printf("After the first frame, updatePanelStates() made %llu heap allocations and drawPanels() %llu.\n",
+        (unsigned long long) updateAllocations, (unsigned long long) drawAllocations);
+    return mismatchedFrames == 0 ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+// Measures the render task (panel-render-task.h) on the host, with
+// tft-office's low-RAM band rendering.
+//
+// The main thread plays ESPHome's loop: a frame (updatePanelStates(), then
+// drawPanels()) every FRAME_MS of real time, with a sensor changing every
+// frame. The bands go to a HostDisplay through an output that takes as
+// long as writing them over a 40MHz SPI bus would.
+//
+// Built without -DPANEL_RENDER_TASK, drawPanels() draws and writes the
+// bands on the main thread. With it, drawPanels() publishes the frame and
+// a render thread draws it. Either way it prints how long each frame held
+// up the main thread, and the frames drawn per second. It fails unless
+// the screen ends up as a full redraw of the final panels would draw it.
+//
+// With the render task, a touchscreen on the same bus is read by the
+// render thread, and pressed twice. It fails if a touch read and a band
+// write ever use the bus at the same time, or if the main thread doesn't
+// take each press exactly once. See README.md to build.
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "host-display.h"
+
+#if !defined(TFT_OFFICE) || !defined(PANEL_BAND_RENDERING)
+#error "Build with -DTFT_OFFICE -DPANEL_BAND_RENDERING"
+#endif
+
+#include "tft-office-ids.h"
+#include "tft-room-time-temp-wind.h"
+
+#define FRAMES (300)
+#define FRAME_MS (20)
+#define SPI_HZ (40000000)
+// An xpt2046 read: 5 conversions of 3 bytes each (pressure and position)
+// and the power down, at 2MHz.
+#define TOUCH_READ_US (18 * 8 / 2)
+
+// The shared SPI bus: how many are using it now, and how often more than
+// one was.
+std::atomic<int> busUsers{0};
+std::atomic<int> busOverlaps{0};
+
+void takeBus() {
+    if (busUsers.fetch_add(1) > 0) {
+        busOverlaps++;
+    }
+}
+
+void releaseBus() {
+    busUsers--;
+}
+
+// Writes the bands to a HostDisplay, taking as long as the SPI bus would.
+class SlowBandOutput : public PanelBandOutput {
+    public:
+    HostDisplay &display;
+
+    SlowBandOutput(HostDisplay &display_) : display(display_) {}
+
+    void write(int x, int y, int w, int h, const uint8_t* pixels, int stride) override {
+        takeBus();
+        display.draw_pixels_at(x, y, w, h, pixels, esphome::display::COLOR_ORDER_RGB, esphome::display::COLOR_BITNESS_565,
+            true, 0, 0, stride / 2 - w);
+        const uint64_t bits = ((uint64_t) w * h * 2 + HOST_DISPLAY_WINDOW_BYTES) * 8;
+        std::this_thread::sleep_for(std::chrono::microseconds(bits * 1000000 / SPI_HZ));
+        releaseBus();
+    }
+};
+
+// A touchscreen on the same bus, pressed at (1000, 2000) while pressed is set.
+class SlowTouchInput : public PanelTouchInput {
+    public:
+    std::atomic<bool> pressed{false};
+    std::atomic<int> reads{0};
+
+    bool read(int &xRaw, int &yRaw) override {
+        takeBus();
+        reads++;
+        std::this_thread::sleep_for(std::chrono::microseconds(TOUCH_READ_US));
+        xRaw = 1000;
+        yRaw = 2000;
+        releaseBus();
+        return pressed;
+    }
+};
+
+void drawFullFrame(HostDisplay &display) {
+    display.fill(Color::BLACK);
+    DisplayPanel::drawAllPanels(display, pages[pageNumber]);
+    flashPanel.draw(display);
+}
+
+void simulate(int frame) {
+    inside_temperature->publish_state(20 + frame % 5);
+    if (frame % 10 == 0) {
+        wind_speed->publish_state(10 + frame % 7);
+        wind_gust_speed->publish_state(20);
+        wind_direction->publish_state("NW");
+    }
+    if (frame == 100) {
+        enableFlash("Brightness", "Increased to %d%%", 80);
+    }
+}
+
+int main() {
+    HostDisplay display(WIDTH, HEIGHT);
+    SlowBandOutput output(display);
+    panelBands.begin(&output);
+    back_yard_temperature->publish_state(8);
+#ifdef PANEL_RENDER_TASK
+    SlowTouchInput touch;
+    panelTouchInput = &touch;
+    int touchesTaken = 0;
+    bool touchesRight = true;
+#endif
+    initializePanels(panelBands.display);
+
+    double mainTotalUs = 0;
+    double mainMaxUs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    auto next = start;
+    for (int frame = 0; frame < FRAMES; frame++) {
+        std::this_thread::sleep_until(next);
+        next += std::chrono::milliseconds(FRAME_MS);
+        simulate(frame);
+        const auto frameStart = std::chrono::steady_clock::now();
+        updatePanelStates();
+        drawPanels();
+        const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - frameStart).count();
+        mainTotalUs += us;
+        mainMaxUs = us > mainMaxUs ? us : mainMaxUs;
+        hostAdvance(FRAME_MS);
+#ifdef PANEL_RENDER_TASK
+        // Pressed for 200ms, twice; the YAML takes presses every 50ms.
+        touch.pressed = (frame >= 100 && frame < 110) || (frame >= 200 && frame < 210);
+        int xRaw = 0;
+        int yRaw = 0;
+        if (frame % 3 == 0 && panelRenderTask.touches.take(xRaw, yRaw)) {
+            touchesTaken++;
+            touchesRight = touchesRight && xRaw == 1000 && yRaw == 2000;
+        }
+#endif
+    }
+
+#ifdef PANEL_RENDER_TASK
+    // Make sure the last frame was handed over, then let it be drawn.
+    while (!panelRenderTask.publish(drawOrder)) {
+        std::this_thread::yield();
+    }
+    while (!panelRenderTask.idle()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint32_t drawn = panelRenderTask.framesRendered;
+    panelRenderTask.end();
+    const char* mode = "render task";
+#else
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint32_t drawn = FRAMES;
+    const char* mode = "main thread";
+#endif
+
+    HostDisplay full(WIDTH, HEIGHT);
+    drawFullFrame(full);
+
+    printf("tft-office low-RAM, drawing on the %s, %d frames every %dms\n", mode, FRAMES, FRAME_MS);
+    printf("Main thread per frame: %.0fus average, %.0fus max.\n", mainTotalUs / FRAMES, mainMaxUs);
+    printf("Frames drawn: %u (%.1f per second).\n", drawn, drawn / seconds);
+#ifdef PANEL_RENDER_TASK
+    printf("Touch reads: %d. Presses taken: %d of 2. Bus overlaps: %d.\n",
+        touch.reads.load(), touchesTaken, busOverlaps.load());
+    if (touchesTaken != 2 || !touchesRight || busOverlaps > 0) {
+        printf("FAIL: the touches weren't read on the render task alone, once each\n");
+        return 1;
+    }
+#endif
+    if (full.pixels != display.pixels) {
+        printf("FAIL: the screen differs from a full redraw of the last frame\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,169 @@
+// Measures how often a TFT layout renders, on the host.
+//
+// Runs the same simulated hour of inputs twice:
+//
+// * "fixed 0.1s": a frame (updatePanelStates() then drawPanels()) every
+//   100ms, as with the display's old update_interval.
+// * "scheduled": frames run by frameScheduler (frame-scheduler.h) from
+//   scheduler timeouts, with the main loop running every 16ms.
+//
+// and prints the frames (wakeups) per hour and the host CPU time spent in
+// them. For tft-office it then touches contUpPanel the way on_touch does
+// and times, on the host, the touch to the end of the frame that shows the
+// flash panel. See README.md to build.
+
+#include <stdio.h>
+#include <chrono>
+#include "host-display.h"
+
+#if defined(TFT_OFFICE)
+#include "tft-office-ids.h"
+#include "tft-room-time-temp-wind.h"
+#elif defined(TFT_BACK_DOOR)
+#include "tft-back-door-ids.h"
+#include "tft-door-monitor.h"
+#else
+#error "Define TFT_OFFICE or TFT_BACK_DOOR"
+#endif
+
+#ifdef PANEL_BAND_RENDERING
+#error "Scheduling doesn't depend on how frames are drawn; check band rendering with measure-panels"
+#endif
+
+#define HOUR_MS (3600 * 1000)
+#define LOOP_MS (16)
+#define FIXED_FRAME_MS (100)
+
+#if defined(TFT_OFFICE)
+static const char* LAYOUT = "tft-office";
+
+// Inputs at second of the hour: sensors every few minutes, and a
+// brightness touch now and then.
+void simulate(int second) {
+    if (second % 300 == 0) {
+        inside_temperature->publish_state(21 + (second / 300) % 3);
+        back_yard_temperature->publish_state(8 - (second / 300) % 4);
+    }
+    if (second % 600 == 0) {
+        wind_speed->publish_state(10 + (second / 600) % 5);
+        wind_gust_speed->publish_state(20);
+        wind_direction->publish_state("NW");
+    }
+    if (second % 900 == 450) {
+        enableFlash("Brightness", "Increased to %d%%", 50 + second / 900);
+    }
+}
+#else
+static const char* LAYOUT = "tft-back-door";
+
+// Inputs at second of the hour: the temperature every few minutes, and
+// the back door opening for a minute now and then.
+void simulate(int second) {
+    if (second % 300 == 0) {
+        back_yard_temperature->publish_state(8 - (second / 300) % 4);
+    }
+    if (second % 900 == 100) {
+        back_door_sensor->publish_state(true);
+    }
+    if (second % 900 == 160) {
+        back_door_sensor->publish_state(false);
+    }
+}
+#endif
+
+struct schedule_result_t {
+    uint32_t frames;
+    double cpuMs;
+};  // Frames rendered in an hour, and the host CPU time they took
+
+uint32_t framesRendered = 0;
+double frameCpuMs = 0;
+
+void renderFrame() {
+    const auto start = std::chrono::steady_clock::now();
+    updatePanelStates();
+    drawPanels();
+    frameCpuMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    framesRendered++;
+}
+
+// One hour of inputs, with frames run by the fixed rate or the scheduler.
+schedule_result_t runHour(bool scheduled) {
+    framesRendered = 0;
+    frameCpuMs = 0;
+    int lastSecond = -1;
+    const uint32_t stepMs = scheduled ? LOOP_MS : FIXED_FRAME_MS;
+    for (uint32_t ms = 0; ms < HOUR_MS; ms += stepMs) {
+        if ((int) (ms / 1000) != lastSecond) {
+            lastSecond = ms / 1000;
+            simulate(lastSecond);
+        }
+        if (scheduled) {
+            App.scheduler.call();
+        }
+        else {
+            renderFrame();
+        }
+        hostAdvance(stepMs);
+    }
+    return schedule_result_t{framesRendered, frameCpuMs};
+}
+
+#if defined(TFT_OFFICE)
+#define TOUCHES (100)
+
+// Touch contUpPanel TOUCHES times, half a loop apart, as on_touch does:
+// isPanelTouched(), the handler (enableFlash()), renderRequestedFrame().
+// Fails unless each touch is drawn before on_touch returns.
+bool measureTouches() {
+    const int x = contUpPanel.x + contUpPanel.w / 2;
+    const int y = contUpPanel.y + contUpPanel.h / 2;
+    double totalUs = 0;
+    double maxUs = 0;
+    int drawnInHandler = 0;
+    for (int i = 0; i < TOUCHES; i++) {
+        const uint32_t framesBefore = framesRendered;
+        const auto start = std::chrono::steady_clock::now();
+        if (isPanelTouched(x, y) && lastTouchedPanel == &contUpPanel) {
+            enableFlash("Brightness", "Increased to %d%%", i);
+        }
+        frameScheduler.renderRequestedFrame();
+        const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        if (framesRendered > framesBefore && panelDamage.lastFramePanels > 0) {
+            drawnInHandler++;
+        }
+        totalUs += us;
+        maxUs = us > maxUs ? us : maxUs;
+        hostAdvance(LOOP_MS / 2);
+        App.scheduler.call();
+        hostAdvance(LOOP_MS / 2);
+    }
+    frameScheduler.takeReport();
+    printf("Touch to drawn frame: %.1fus average, %.1fus max on the host; %d of %d touches drawn before on_touch returned.\n",
+        totalUs / TOUCHES, maxUs, drawnInHandler, TOUCHES);
+    printf("Before, a touch waited for the next frame: up to %dms (0.1s update_interval), or up to %dms (the next loop).\n",
+        FIXED_FRAME_MS, LOOP_MS);
+    return drawnInHandler == TOUCHES && !isnan(frameScheduler.reportTouchLatencyMs);
+}
+#endif
+
+int main() {
+    HostDisplay display(WIDTH, HEIGHT);
+    initializePanels(display);
+
+    const schedule_result_t fixed = runHour(false);
+    frameScheduler.begin(esptime, []() { renderFrame(); });
+    const schedule_result_t scheduled = runHour(true);
+
+    printf("%s, one hour\n", LAYOUT);
+    printf("%-12s %10s %14s\n", "", "frames", "host CPU ms");
+    printf("%-12s %10u %14.1f\n", "fixed 0.1s", fixed.frames, fixed.cpuMs);
+    printf("%-12s %10u %14.1f\n", "scheduled", scheduled.frames, scheduled.cpuMs);
+#if defined(TFT_OFFICE)
+    if (!measureTouches()) {
+        printf("FAIL: a touch was not drawn before on_touch returned\n");
+        return 1;
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,216 @@
+// Measures the TM1638 bus traffic of led-and-key1-esp32 on the host,
+// with ESPHome's tm1638 component and with Tm1638Shadow
+// (tm1638-shadow.h), over a simulated hour.
+//
+// Both drive an emulated TM1638 (Tm1638Bus without ARDUINO) through the
+// same hour: the time and temperature every 0.5s, the back door opening
+// and closing (LED 1 and its messages), and a press of button 7 raising
+// the intensity. "tm1638 component" models the ESPHome component the
+// YAML used: every display update sends the intensity and all 8 digits,
+// a 3 byte transaction each, and every loop (16ms) reads the buttons.
+//
+// Whenever the shadow has nothing left to send, both chips must hold the
+// same registers and display control, and both must have seen the button
+// press. It prints the bus clock cycles, bytes and transactions per
+// second. See README.md to build.
+
+#include <stdio.h>
+#include <string>
+#include "esphome-host.h"
+#include "time-snapshot.h"
+#include "tm1638-shadow.h"
+
+#define HOUR_MS (3600000)
+#define LOOP_MS (16)
+#define UPDATE_MS (500)
+
+// What ESPHome's tm1638 component sends.
+class Tm1638ComponentModel {
+    public:
+    Tm1638Bus bus;
+    uint8_t keys = 0;
+
+    Tm1638ComponentModel() : bus(18, 19, 23) {}
+
+    // loop(): read the buttons, for the binary sensors.
+    void loop() {
+        bus.start();
+        bus.write(TM1638_DATA_READ_KEYS);
+        bus.beginRead();
+        uint8_t scanned = 0;
+        for (int i = 0; i < 4; i++) {
+            scanned |= bus.read() << i;
+        }
+        bus.endRead();
+        bus.stop();
+        keys = scanned;
+    }
+
+    // update(): the lambda's set_intensity() and print(), then display().
+    void update(int intensity, const char* text) {
+        bus.command(TM1638_DATA_FIXED);
+        bus.command(intensity > 0 ? TM1638_DISPLAY_ON | intensity : TM1638_DISPLAY_OFF);
+        uint8_t registers[TM1638_REGISTERS] = {};
+        Tm1638Shadow::encode(text, registers);
+        for (int digit = 0; digit < TM1638_DIGITS; digit++) {
+            bus.command(TM1638_DATA_FIXED);
+            bus.start();
+            bus.write(TM1638_ADDRESS | (digit * 2));
+            bus.write(registers[digit * 2]);
+            bus.stop();
+        }
+    }
+
+    // An output's write_state().
+    void setLed(int led, bool on) {
+        bus.command(TM1638_DATA_FIXED);
+        bus.start();
+        bus.write(TM1638_ADDRESS | (led * 2 + 1));
+        bus.write(on ? 1 : 0);
+        bus.stop();
+    }
+};
+
+// The hour's inputs, shared by both runs.
+struct led_key_state_t {
+    std::string message;        // ledkey1_display
+    int intensity = 1;
+    bool backDoorOpen = false;
+    float temperature = 52;
+};  // The YAML's globals and sensors
+
+// Apply the events due at ms. Returns true if LED 1 changed.
+bool simulate(uint32_t ms, led_key_state_t &state, uint8_t &keysHeld) {
+    const uint32_t minute = ms / 60000;
+    const uint32_t inMinute = ms % 60000;
+    bool ledChanged = false;
+    if (inMinute == 0 && minute % 5 == 0) {
+        state.temperature = 52 + (minute / 5) % 4;
+    }
+    // The back door opens every 10 minutes, and closes 2 minutes later.
+    if (inMinute == 0 && minute % 10 == 0) {
+        state.backDoorOpen = true;
+        ledChanged = true;
+    }
+    if (inMinute == 0 && minute % 10 == 2) {
+        state.backDoorOpen = false;
+        ledChanged = true;
+    }
+    if (inMinute < 2000 && (minute % 10 == 0 || minute % 10 == 2)) {
+        state.message = inMinute < 1000 ? "Back dr" : state.backDoorOpen ? "Opened" : "Closed";
+    }
+    if (inMinute == 2000 && (minute % 10 == 0 || minute % 10 == 2)) {
+        state.message.clear();
+    }
+    // Button 7, held for 100ms at 30:30, raises the intensity.
+    if (ms == 1830000) {
+        keysHeld |= 1 << 7;
+        state.intensity++;
+        state.message = "Inten " + std::to_string(state.intensity);
+    }
+    if (ms == 1830100) {
+        keysHeld &= ~(1 << 7);
+    }
+    if (ms == 1831100) {
+        state.message.clear();
+    }
+    return ledChanged;
+}
+
+// The display lambda's text.
+void displayText(const led_key_state_t &state, TimeSnapshot &snapshot, char* text, size_t size) {
+    if (state.message.empty()) {
+        snprintf(text, size, "%s %.0fF", snapshot.hourDotMinute, state.temperature);
+    }
+    else {
+        snprintf(text, size, "%s", state.message.c_str());
+    }
+}
+
+struct bus_result_t {
+    uint32_t clockCycles;
+    uint32_t transactions;
+    int keyPresses;
+};  // A run's totals
+
+void printResult(const char* name, const bus_result_t &result) {
+    const double seconds = HOUR_MS / 1000.0;
+    printf("%-18s %16.0f %12.1f %16.1f\n", name, result.clockCycles / seconds,
+        result.clockCycles / 8 / seconds, result.transactions / seconds);
+}
+
+int main() {
+    esphome::time::RealTimeClock clock;
+    TimeSnapshot snapshot;
+    led_key_state_t componentState;
+    led_key_state_t shadowState;
+    Tm1638ComponentModel component;
+    Tm1638Shadow shadow(18, 19, 23);
+    shadow.setup();
+
+    bus_result_t componentResult = {};
+    bus_result_t shadowResult = {};
+    bool componentKey7 = false;
+    bool shadowKey7 = false;
+    int comparisons = 0;
+    int mismatches = 0;
+    char text[32];
+    for (uint32_t ms = 0; ms < HOUR_MS; ms++) {
+        uint8_t keysHeld = component.bus.hostKeys;
+        if (simulate(ms, componentState, keysHeld)) {
+            component.setLed(1, componentState.backDoorOpen);
+        }
+        component.bus.hostKeys = keysHeld;
+        simulate(ms, shadowState, keysHeld);
+        shadow.setLed(1, shadowState.backDoorOpen);
+        shadow.bus.hostKeys = keysHeld;
+
+        if (ms % LOOP_MS == 0) {
+            component.loop();
+            const bool held = component.keys & (1 << 7);
+            componentResult.keyPresses += held && !componentKey7;
+            componentKey7 = held;
+        }
+        if (ms % UPDATE_MS == 0) {
+            snapshot.tick(clock.now());
+            displayText(componentState, snapshot, text, sizeof(text));
+            component.update(componentState.intensity, text);
+            displayText(shadowState, snapshot, text, sizeof(text));
+            shadow.setIntensity(shadowState.intensity);
+            shadow.print(text);
+        }
+        if (ms % TM1638_SHADOW_TICK_MS == 0) {
+            shadow.tick();
+            const bool held = shadow.key(7);
+            shadowResult.keyPresses += held && !shadowKey7;
+            shadowKey7 = held;
+        }
+
+        if (!shadow.pending() && component.bus.hostDisplayControl != -1) {
+            comparisons++;
+            if (memcmp(component.bus.hostRegisters, shadow.bus.hostRegisters, TM1638_REGISTERS) != 0 ||
+                    component.bus.hostDisplayControl != shadow.bus.hostDisplayControl) {
+                if (mismatches++ == 0) {
+                    fprintf(stderr, "%ums: the chips differ\n", ms);
+                }
+            }
+        }
+        hostAdvance(1);
+    }
+    componentResult.clockCycles = component.bus.clockCycles;
+    componentResult.transactions = component.bus.transactions;
+    shadowResult.clockCycles = shadow.bus.clockCycles;
+    shadowResult.transactions = shadow.bus.transactions;
+
+    printf("led-and-key1-esp32, a simulated hour\n");
+    printf("%-18s %16s %12s %16s\n", "", "clock cycles/s", "bytes/s", "transactions/s");
+    printResult("tm1638 component", componentResult);
+    printResult("Tm1638Shadow", shadowResult);
+    printf("Button 7 presses seen: %d and %d of 1. The chips matched %d of %d times.\n",
+        componentResult.keyPresses, shadowResult.keyPresses, comparisons - mismatches, comparisons);
+    if (mismatches > 0 || componentResult.keyPresses != 1 || shadowResult.keyPresses != 1) {
+        printf("FAIL\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,346 @@
+// Renders a panel app's frames into an in-memory RGB565 frame buffer on
+// the host, and shows how much of each frame's drawing was needed.
+//
+// The app is driven by a script of sensor and clock inputs (a built in
+// one per app, or a file). Each "frame" runs updatePanelStates() and
+// drawPanels() as the display lambda does, then reports:
+//
+// * written: pixel writes (a pixel drawn twice counts twice)
+// * touched: pixels written at least once
+// * changed: pixels that differ from before the frame
+// * redundant: writes beyond the changed pixels (written - changed)
+//
+// Given an output directory, each frame is also written as two PPMs:
+// NNN-frame.ppm, the screen, and NNN-heat.ppm, the writes per pixel
+// (black none, blue 1, green 2, yellow 3, red 4 or more). In the heat
+// map, pixels that changed are bright and pixels written without
+// changing are dim. See README.md to build.
+//
+// Scripts have a command per line; # starts a comment.
+//
+//     set <id> <value>     publish a sensor (a number, on/off, or text)
+//     advance <seconds>    move the clock (and millis()) forward
+//     frame                render a frame
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "host-display.h"
+
+#if defined(TFT_OFFICE)
+#include "tft-office-ids.h"
+#include "tft-room-time-temp-wind.h"
+#elif defined(TFT_BACK_DOOR)
+#include "tft-back-door-ids.h"
+#include "tft-door-monitor.h"
+#elif defined(GUEST_TIME_TEMP)
+#include "guest-time-temp-ids.h"
+#include "room-time-temp-wind.h"
+#else
+#error "Define TFT_OFFICE, TFT_BACK_DOOR or GUEST_TIME_TEMP"
+#endif
+
+#ifdef PANEL_BAND_RENDERING
+// Writes the bands to a HostDisplay, one transaction per band.
+class HostBandOutput : public PanelBandOutput {
+    public:
+    HostDisplay &display;
+
+    HostBandOutput(HostDisplay &display_) : display(display_) {}
+
+    void write(int x, int y, int w, int h, const uint8_t* pixels, int stride) override {
+        display.draw_pixels_at(x, y, w, h, pixels, esphome::display::COLOR_ORDER_RGB, esphome::display::COLOR_BITNESS_565,
+            true, 0, 0, stride / 2 - w);
+    }
+};
+#endif
+
+struct host_input_t {
+    const char* id;
+    esphome::sensor::Sensor* sensor;
+    esphome::text_sensor::TextSensor* textSensor;
+    esphome::binary_sensor::BinarySensor* binarySensor;
+};  // A sensor a script can set, by its YAML id
+
+#if defined(TFT_OFFICE)
+static const char* LAYOUT = "tft-office";
+static const int SCREEN_WIDTH = WIDTH;
+static const int SCREEN_HEIGHT = HEIGHT;
+// auto_clear_enabled: False
+static const bool AUTO_CLEAR = false;
+
+static const host_input_t INPUTS[] = {
+    {"back_yard_temperature", back_yard_temperature, NULL, NULL},
+    {"inside_temperature", inside_temperature, NULL, NULL},
+    {"wind_speed", wind_speed, NULL, NULL},
+    {"wind_gust_speed", wind_gust_speed, NULL, NULL},
+    {"wind_direction", NULL, wind_direction, NULL},
+};
+
+static const char* SCRIPT = R"(
+set inside_temperature 21.4
+set back_yard_temperature 8.2
+set wind_speed 12
+set wind_direction NW
+frame                           # the first frame draws everything
+frame                           # nothing changed
+set wind_gust_speed 20
+frame
+set back_yard_temperature 7.9
+frame
+set inside_temperature 21.6
+set back_yard_temperature 7.6
+frame
+advance 60
+frame                           # the minute rolled over
+)";
+#elif defined(TFT_BACK_DOOR)
+static const char* LAYOUT = "tft-back-door";
+static const int SCREEN_WIDTH = WIDTH;
+static const int SCREEN_HEIGHT = HEIGHT;
+// auto_clear_enabled: False
+static const bool AUTO_CLEAR = false;
+
+static const host_input_t INPUTS[] = {
+    {"back_yard_temperature", back_yard_temperature, NULL, NULL},
+    {"back_door_autolock", NULL, NULL, back_door_autolock},
+    {"front_door_autolock", NULL, NULL, front_door_autolock},
+    {"back_door_sensor", NULL, NULL, back_door_sensor},
+    {"front_door_sensor", NULL, NULL, front_door_sensor},
+};
+
+static const char* SCRIPT = R"(
+set back_door_autolock on
+set front_door_autolock off
+frame                           # the first frame draws everything
+frame                           # nothing changed
+set back_door_sensor on
+frame
+set back_yard_temperature 8.2   # timePanel narrows for the temperature
+frame
+set back_door_sensor off
+frame
+advance 60
+frame                           # the minute rolled over
+)";
+#else
+static const char* LAYOUT = "guest-time-temp";
+// SSD1306 128x64
+static const int SCREEN_WIDTH = 128;
+static const int SCREEN_HEIGHT = 64;
+// The ssd1306 clears the buffer before each lambda (auto_clear_enabled).
+static const bool AUTO_CLEAR = true;
+
+static const host_input_t INPUTS[] = {
+    {"back_yard_temperature", back_yard_temperature, NULL, NULL},
+    {"inside_temperature", inside_temperature, NULL, NULL},
+    {"wind_speed", wind_speed, NULL, NULL},
+    {"wind_gust_speed", wind_gust_speed, NULL, NULL},
+    {"wind_direction", NULL, wind_direction, NULL},
+    {"next_alarm", NULL, next_alarm, NULL},
+};
+
+static const char* SCRIPT = R"(
+set wind_speed 12
+set wind_gust_speed 20
+set wind_direction NW
+frame                           # time only, with the wind
+frame                           # nothing changed
+set inside_temperature 21.4
+set back_yard_temperature 8.2
+frame                           # the temperatures appear
+set next_alarm 7:00 AM
+frame
+advance 60
+frame                           # the minute rolled over
+)";
+#endif
+
+struct frame_totals_t {
+    int frames = 0;
+    uint64_t transactions = 0;
+    uint64_t written = 0;
+    uint64_t touched = 0;
+    uint64_t changed = 0;
+};  // Summed over the frames
+
+// Heat map colours by writes: none, 1, 2, 3, 4 or more.
+static const Color HEAT_COLORS[] = {
+    Color(0, 0, 0), Color(0, 0, 255), Color(0, 255, 0), Color(255, 255, 0), Color(255, 0, 0)
+};
+
+bool writePpm(const std::string &path, int width, int height, const std::vector<Color> &pixels) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Can't write %s\n", path.c_str());
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for (const Color &pixel : pixels) {
+        const uint8_t rgb[3] = {pixel.r, pixel.g, pixel.b};
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+    fclose(file);
+    return true;
+}
+
+std::vector<Color> heatMap(const HostDisplay &display, const std::vector<Color> &before) {
+    std::vector<Color> heat(display.pixels.size());
+    for (size_t i = 0; i < heat.size(); i++) {
+        const int writes = std::min<int>(display.writeCounts[i], 4);
+        Color color = HEAT_COLORS[writes];
+        if (display.pixels[i] == before[i]) {
+            color = Color(color.r / 3, color.g / 3, color.b / 3);
+        }
+        heat[i] = color;
+    }
+    return heat;
+}
+
+const host_input_t* findInput(const std::string &id) {
+    for (const host_input_t &input : INPUTS) {
+        if (id == input.id) {
+            return &input;
+        }
+    }
+    return NULL;
+}
+
+// Publish value to the sensor with the id. false if there's no such sensor.
+bool setInput(const std::string &id, const std::string &value) {
+    const host_input_t* input = findInput(id);
+    if (input == NULL) {
+        return false;
+    }
+    if (input->sensor != NULL) {
+        input->sensor->publish_state(strtof(value.c_str(), NULL));
+    }
+    else if (input->textSensor != NULL) {
+        input->textSensor->publish_state(value);
+    }
+    else {
+        input->binarySensor->publish_state(value == "on" || value == "true" || value == "1");
+    }
+    return true;
+}
+
+// Render one frame as the display lambda does, and count its writes.
+void renderFrame(HostDisplay &display, frame_totals_t &totals, const char* outDir) {
+    const std::vector<Color> before = display.pixels;
+    display.resetCounts();
+    if (AUTO_CLEAR) {
+        display.fill(Color::BLACK);
+    }
+    updatePanelStates();
+    drawPanels();
+
+    uint64_t touched = 0;
+    uint64_t changed = 0;
+    for (size_t i = 0; i < display.pixels.size(); i++) {
+        touched += display.writeCounts[i] > 0;
+        changed += !(display.pixels[i] == before[i]);
+    }
+    printf("%5d %14llu %10llu %10llu %10llu %10llu\n", totals.frames,
+        (unsigned long long) display.transactions, (unsigned long long) display.pixelsWritten,
+        (unsigned long long) touched, (unsigned long long) changed,
+        (unsigned long long) (display.pixelsWritten - changed));
+
+    if (outDir != NULL) {
+        char name[32];
+        snprintf(name, sizeof(name), "/%03d-frame.ppm", totals.frames);
+        writePpm(outDir + std::string(name), display.width, display.height, display.pixels);
+        snprintf(name, sizeof(name), "/%03d-heat.ppm", totals.frames);
+        writePpm(outDir + std::string(name), display.width, display.height, heatMap(display, before));
+    }
+
+    totals.frames++;
+    totals.transactions += display.transactions;
+    totals.written += display.pixelsWritten;
+    totals.touched += touched;
+    totals.changed += changed;
+}
+
+int main(int argc, char** argv) {
+    const char* outDir = argc > 1 ? argv[1] : NULL;
+    std::string script = SCRIPT;
+    if (argc > 2) {
+        std::ifstream file(argv[2]);
+        if (!file) {
+            fprintf(stderr, "Can't read %s\n", argv[2]);
+            return 1;
+        }
+        std::stringstream text;
+        text << file.rdbuf();
+        script = text.str();
+    }
+    if (outDir != NULL && mkdir(outDir, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Can't create %s\n", outDir);
+        return 1;
+    }
+
+    HostDisplay display(SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef PANEL_BAND_RENDERING
+    HostBandOutput bandOutput(display);
+    panelBands.begin(&bandOutput);
+    initializePanels(panelBands.display);
+#else
+    initializePanels(display);
+#endif
+
+    printf("%s, %dx%d\n", LAYOUT, SCREEN_WIDTH, SCREEN_HEIGHT);
+    printf("%5s %14s %10s %10s %10s %10s\n", "frame", "transactions", "written", "touched", "changed", "redundant");
+    frame_totals_t totals;
+    std::istringstream lines(script);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(lines, line)) {
+        lineNumber++;
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string command;
+        if (!(words >> command)) {
+            continue;
+        }
+        if (command == "frame") {
+            renderFrame(display, totals, outDir);
+            continue;
+        }
+        if (command == "advance") {
+            int seconds = 0;
+            if (words >> seconds && seconds >= 0) {
+                hostAdvance(seconds * 1000);
+                continue;
+            }
+        }
+        else if (command == "set") {
+            std::string id;
+            std::string value;
+            words >> id >> std::ws;
+            std::getline(words, value);
+            while (!value.empty() && isspace((unsigned char) value.back())) {
+                value.pop_back();
+            }
+            if (!value.empty() && setInput(id, value)) {
+                continue;
+            }
+        }
+        fprintf(stderr, "line %d: can't run \"%s\"\n", lineNumber, line.c_str());
+        return 1;
+    }
+
+    if (totals.frames == 0) {
+        return 0;
+    }
+    printf("%5s %14llu %10llu %10llu %10llu %10llu\n", "total",
+        (unsigned long long) totals.transactions, (unsigned long long) totals.written,
+        (unsigned long long) totals.touched, (unsigned long long) totals.changed,
+        (unsigned long long) (totals.written - totals.changed));
+    printf("%.1f pixel writes per changed pixel; %.0f%% of the writes changed nothing.\n",
+        totals.changed == 0 ? 0.0 : (double) totals.written / totals.changed,
+        totals.written == 0 ? 0.0 : 100.0 * (totals.written - totals.changed) / totals.written);
+    return 0;
+}
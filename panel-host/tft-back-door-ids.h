@@ -0,0 +1,30 @@
+#ifndef TFT_BACK_DOOR_IDS_H
+#define TFT_BACK_DOOR_IDS_H
+
+// The ids from tft-back-door.yaml that tft-door-monitor.h uses, as the
+// generated ESPHome code would declare them. Font sizes match the YAML.
+
+#include "esphome-host.h"
+
+esphome::font::Font* font_door = new esphome::font::Font(36);
+esphome::font::Font* font_time = new esphome::font::Font(60);
+esphome::font::Font* font_temp = new esphome::font::Font(60);
+esphome::font::Font* font_brightness = new esphome::font::Font(30);
+
+Color color_red = Color(255, 0, 0);
+Color color_green = Color(0, 255, 0);
+Color color_blue = Color(0, 0, 255);
+Color color_yellow = Color(255, 255, 0);
+Color color_orange = Color(255, 165, 0);
+
+esphome::globals::RestoringGlobalsComponent<float>* brightness = new esphome::globals::RestoringGlobalsComponent<float>(1.0);
+esphome::output::FloatOutput* backlight = new esphome::output::FloatOutput();
+esphome::time::RealTimeClock* esptime = new esphome::time::RealTimeClock();
+
+esphome::sensor::Sensor* back_yard_temperature = new esphome::sensor::Sensor();
+esphome::binary_sensor::BinarySensor* back_door_autolock = new esphome::binary_sensor::BinarySensor();
+esphome::binary_sensor::BinarySensor* front_door_autolock = new esphome::binary_sensor::BinarySensor();
+esphome::binary_sensor::BinarySensor* back_door_sensor = new esphome::binary_sensor::BinarySensor();
+esphome::binary_sensor::BinarySensor* front_door_sensor = new esphome::binary_sensor::BinarySensor();
+
+#endif  // TFT_BACK_DOOR_IDS_H
@@ -0,0 +1,31 @@
+#ifndef TFT_OFFICE_IDS_H
+#define TFT_OFFICE_IDS_H
+
+// The ids from tft-office.yaml that tft-room-time-temp-wind.h uses, as the
+// generated ESPHome code would declare them. Font sizes match the YAML.
+
+#include "esphome-host.h"
+
+esphome::font::Font* icon_font_45 = new esphome::font::Font(45);
+esphome::font::Font* font_cont = new esphome::font::Font(70);
+esphome::font::Font* font_date = new esphome::font::Font(35);
+esphome::font::Font* font_day = new esphome::font::Font(35);
+esphome::font::Font* font_time = new esphome::font::Font(110);
+esphome::font::Font* font_temp = new esphome::font::Font(70);
+esphome::font::Font* font_temp_label = new esphome::font::Font(22);
+esphome::font::Font* font_flash = new esphome::font::Font(30);
+
+Color color_text_white = Color(255, 255, 255);
+Color color_green = Color(0, 255, 0);
+
+esphome::globals::RestoringGlobalsComponent<float>* brightness = new esphome::globals::RestoringGlobalsComponent<float>(1.0);
+esphome::output::FloatOutput* backlight = new esphome::output::FloatOutput();
+esphome::time::RealTimeClock* esptime = new esphome::time::RealTimeClock();
+
+esphome::sensor::Sensor* back_yard_temperature = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* inside_temperature = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* wind_speed = new esphome::sensor::Sensor();
+esphome::sensor::Sensor* wind_gust_speed = new esphome::sensor::Sensor();
+esphome::text_sensor::TextSensor* wind_direction = new esphome::text_sensor::TextSensor();
+
+#endif  // TFT_OFFICE_IDS_H
@@ -1,4 +1,8 @@
 #include <display-panel.h>
+#include "panel-damage.h"
+#include "panel-text.h"
+#include "frame-scheduler.h"
+#include "time-snapshot.h"
 
 // Last touched page
 DisplayPanel* lastTouchedPanel = NULL;
@@ -6,9 +10,6 @@ DisplayPanel* lastTouchedPanel = NULL;
 // The display/lcd we are working with. Defined in initializePanels().
 esphome::display::Display* lcd = NULL;
 
-// For sprintf calls.
-char buffer[25];
-
 #define WIDTH 320
 #define HEIGHT 240
 // Convert percentage width or height (0-100) to pixels
@@ -24,6 +25,15 @@ DisplayPanel brightnessDownPanel(PW(88), PH(25), PW(12), PH(25));
 DisplayPanel timePanel(0, PH(50), PW(60), PH(50));
 DisplayPanel tempPanel(PW(60), PH(50), PW(40), PH(50));
 
+// Renders a frame only when the screen can change. See frame-scheduler.h.
+FrameScheduler frameScheduler;
+// The clock, sampled once per frame. See time-snapshot.h.
+TimeSnapshot timeSnapshot;
+// Redraws only the panels that changed. See panel-damage.h.
+PanelDamage panelDamage;
+// Rendered panels, so unchanged text is blitted rather than re-rasterized.
+PanelBitmapCache panelBitmapCache;
+
 std::vector<DisplayPanel*> panels = {
     &backDoorPanel,
     &frontDoorPanel,
@@ -33,41 +43,88 @@ std::vector<DisplayPanel*> panels = {
     &tempPanel
 };
 
-// Predefined Panel text options
-std::vector<std::string> backDoorOpenText = {"Back", "Door", "Open"};
-std::vector<std::string> backDoorText = {"Back", "Door"};
-std::vector<std::string> frontDoorOpenText = {"Front", "Door", "Open"};
-std::vector<std::string> frontDoorText = {"Front", "Door"};
-std::vector<std::string> brightnessUpText = {"+"};
-std::vector<std::string> brightnessDownText = {"-"};
+// Set when an input changes, so updatePanelStates() only rebuilds the
+// panels it affects. The first frame builds them all.
+bool doorsChanged = true;
+bool temperatureChanged = true;
+
+// Render a frame when an input of the panels changes.
+void watchPanelInputs() {
+    back_door_sensor->add_on_state_callback([](bool) { doorsChanged = true; frameScheduler.requestFrame(); });
+    front_door_sensor->add_on_state_callback([](bool) { doorsChanged = true; frameScheduler.requestFrame(); });
+    back_door_autolock->add_on_state_callback([](bool) { doorsChanged = true; frameScheduler.requestFrame(); });
+    front_door_autolock->add_on_state_callback([](bool) { doorsChanged = true; frameScheduler.requestFrame(); });
+    back_yard_temperature->add_on_state_callback([](float) { temperatureChanged = true; frameScheduler.requestFrame(); });
+}
+
+// The door panels' colours and text.
+void updateDoorPanels() {
+    backDoorPanel.color = 
+        back_door_sensor->state && back_door_autolock->state ? color_yellow :
+        back_door_sensor->state && !back_door_autolock->state ? color_orange :
+        back_door_autolock->state ? color_green : color_red;
+    backDoorPanel.textColor = 
+        back_door_sensor->state ? Color::BLACK : 
+        back_door_autolock->state ? Color::BLACK : Color::WHITE;
+    PanelText backDoorText;
+    backDoorText.add("Back").add("Door");
+    if (back_door_sensor->state) {
+        backDoorText.add("Open");
+    }
+    backDoorText.applyTo(backDoorPanel);
+
+    frontDoorPanel.color = 
+        front_door_sensor->state && back_door_autolock->state ? color_yellow :
+        front_door_sensor->state && !front_door_autolock->state ? color_orange :
+        front_door_autolock->state ? color_green : color_red;
+    frontDoorPanel.textColor = 
+        front_door_sensor->state ? Color::BLACK : 
+        front_door_autolock->state ? Color::BLACK : Color::WHITE;
+    PanelText frontDoorText;
+    frontDoorText.add("Front").add("Door");
+    if (front_door_sensor->state) {
+        frontDoorText.add("Open");
+    }
+    frontDoorText.applyTo(frontDoorPanel);
+}
 
 void initializePanels(esphome::display::Display &display) {
     lcd = &display;
+    panelDamage.bitmapCache = &panelBitmapCache;
+    PanelText::reserve(panels);
 
+    backDoorPanel.name = "backDoorPanel";
     backDoorPanel.font = font_door;
     backDoorPanel.fontVertOffset = -5;
     backDoorPanel.fontHeightOffset = -5;
 
+    frontDoorPanel.name = "frontDoorPanel";
     frontDoorPanel.font = font_door;
     frontDoorPanel.fontVertOffset = -5;
     frontDoorPanel.fontHeightOffset = -5;
 
+    timePanel.name = "timePanel";
     timePanel.color = color_blue;
     timePanel.font = font_time;
     timePanel.textColor = Color::WHITE;
     timePanel.touchable = false;
 
+    tempPanel.name = "tempPanel";
     tempPanel.color = color_blue;
     tempPanel.font = font_temp;
     tempPanel.textColor = Color::WHITE;;
     tempPanel.touchable = false;
 
-    brightnessUpPanel.text = brightnessUpText;
+    brightnessUpPanel.name = "brightnessUpPanel";
+    PanelText brightnessUpText;
+    brightnessUpText.add("+").applyTo(brightnessUpPanel);
     brightnessUpPanel.color = color_yellow;
     brightnessUpPanel.font = font_brightness;
     brightnessUpPanel.textColor = Color::BLACK;
 
-    brightnessDownPanel.text = brightnessDownText;
+    brightnessDownPanel.name = "brightnessDownPanel";
+    PanelText brightnessDownText;
+    brightnessDownText.add("-").applyTo(brightnessDownPanel);
     brightnessDownPanel.color = color_yellow;
     brightnessDownPanel.font = font_brightness;
     brightnessDownPanel.textColor = Color::BLACK;
@@ -75,60 +132,58 @@ void initializePanels(esphome::display::Display &display) {
     // Backlight initial level
     backlight->set_level(brightness->value());
 
+    watchPanelInputs();
+
     // Fill the screen the first time to have BLACK in any gaps in Panels.
     display.fill(Color::BLACK);
 }
 
 void updatePanelStates() {
+    PANEL_TIMING_FRAME_BEGIN();
+    PANEL_TIMING_START(updateStart);
     //
     // Update configuration for Panels that might have changed.
     //
-    backDoorPanel.color = 
-        back_door_sensor->state && back_door_autolock->state ? color_yellow :
-        back_door_sensor->state && !back_door_autolock->state ? color_orange :
-        back_door_autolock->state ? color_green : color_red;
-    backDoorPanel.textColor = 
-        back_door_sensor->state ? Color::BLACK : 
-        back_door_autolock->state ? Color::BLACK : Color::WHITE;
-    backDoorPanel.text = back_door_sensor->state ? backDoorOpenText : backDoorText;
+    if (doorsChanged) {
+        doorsChanged = false;
+        updateDoorPanels();
+    }
 
-    frontDoorPanel.color = 
-        front_door_sensor->state && back_door_autolock->state ? color_yellow :
-        front_door_sensor->state && !front_door_autolock->state ? color_orange :
-        front_door_autolock->state ? color_green : color_red;
-    frontDoorPanel.textColor = 
-        front_door_sensor->state ? Color::BLACK : 
-        front_door_autolock->state ? Color::BLACK : Color::WHITE;
-    frontDoorPanel.text = front_door_sensor->state ? frontDoorOpenText : frontDoorText;
-
-    // Time      
-    int hour = esptime->now().hour;
-    int minute = esptime->now().minute;
-    hour = hour == 0 ? 12 : 
-        hour > 12 ? hour - 12 : hour;
-    sprintf(buffer, "%d:%02d", hour, minute);
-    std::vector<std::string> timeText = { buffer };
-    timePanel.text = timeText;
-
-    if (back_yard_temperature->has_state()) {
-        // Temperature
-        timePanel.w = PW(60);
-        tempPanel.w = PW(40);
-        sprintf(buffer, "%.0f°", back_yard_temperature->state);
-        std::vector<std::string> tempText = { buffer };
-        tempPanel.text = tempText;
+    // Time, when the minute rolls over (or the clock is set)
+    if (timeSnapshot.tick(esptime->now())) {
+        PanelText timeText;
+        timeText.add(timeSnapshot.hourMinute).applyTo(timePanel);
     }
-    else {
-        // If we don't have a temperature state, just show time.
-        timePanel.w = 320;
-        tempPanel.w = 0;
+
+    if (temperatureChanged) {
+        temperatureChanged = false;
+        if (back_yard_temperature->has_state()) {
+            // Temperature
+            timePanel.w = PW(60);
+            tempPanel.w = PW(40);
+            PanelText tempText;
+            tempText.addf("%.0f°", back_yard_temperature->state).applyTo(tempPanel);
+        }
+        else {
+            // If we don't have a temperature state, just show time.
+            timePanel.w = 320;
+            tempPanel.w = 0;
+        }
     }
+    PANEL_TIMING_PHASE(PANEL_PHASE_UPDATE, updateStart);
 }
 
+// Ask for the next frame when the minute rolls over, the only change
+// to the screen that no input announces.
+void scheduleNextFrame() {
+    frameScheduler.frameIn(timeSnapshot.secondsToNextMinute() * 1000);
+}
 
-// Draw all of the panels
+// Draw the panels that changed since the last frame
 void drawPanels() {
-    DisplayPanel::drawAllPanels(*lcd, panels);
+    panelDamage.draw(*lcd, panels);
+    PANEL_TIMING_FRAME_END();
+    scheduleNextFrame();
 }
 
 // See if one of the enabled, touchable panels on the
@@ -0,0 +1,82 @@
+#ifndef ALLOC_COUNT_H
+#define ALLOC_COUNT_H
+
+// Counts C++ heap allocations (every operator new) so code can report how
+// many allocations a piece of work made, e.g. per display frame:
+//
+//     uint32_t before = allocationCount;
+//     ... work ...
+//     uint32_t made = allocationCount - before;
+//
+// Replacing the global operator new only happens when ALLOC_COUNT_ENABLED
+// is defined (add -DALLOC_COUNT_ENABLED to esphome: platformio_options:
+// build_flags). Otherwise allocationCount stays 0.
+//
+// Every task's allocations are counted (WiFi and the other tasks allocate
+// too), so the count is atomic, and a difference taken on the loop task
+// includes whatever the other tasks allocated meanwhile.
+//
+// The replacements behave as the standard ones do when the heap is
+// exhausted: operator new throws std::bad_alloc (or, built without
+// exceptions, aborts as the toolchain's own does), and the std::nothrow
+// forms return NULL.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+std::atomic<uint32_t> allocationCount(0);
+
+#ifdef ALLOC_COUNT_ENABLED
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void* operator new(size_t size) {
+    void* allocated = operator new(size, std::nothrow);
+    if (allocated == NULL) {
+#ifdef __cpp_exceptions
+        throw std::bad_alloc();
+#else
+        abort();
+#endif
+    }
+    return allocated;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* allocated) noexcept {
+    free(allocated);
+}
+
+void operator delete[](void* allocated) noexcept {
+    free(allocated);
+}
+
+void operator delete(void* allocated, size_t) noexcept {
+    free(allocated);
+}
+
+void operator delete[](void* allocated, size_t) noexcept {
+    free(allocated);
+}
+
+void operator delete(void* allocated, const std::nothrow_t&) noexcept {
+    free(allocated);
+}
+
+void operator delete[](void* allocated, const std::nothrow_t&) noexcept {
+    free(allocated);
+}
+#endif
+
+#endif  // ALLOC_COUNT_H
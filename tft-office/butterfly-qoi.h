@@ -0,0 +1,1445 @@
+// Generated by images/png-to-qoi565.py from images/butterfly.png. Don't edit.
+// 200x190 RGB565, 22864 bytes (76000 raw, 3.3x smaller). See panel-qoi-image.h.
+
+#ifndef BUTTERFLY_QOI_H
+#define BUTTERFLY_QOI_H
+
+#include <stdint.h>
+
+#define BUTTERFLY_QOI_WIDTH (200)
+#define BUTTERFLY_QOI_HEIGHT (190)
+#define BUTTERFLY_QOI_CHECKSUM (0x7ea5b5d7u)
+
+static const uint8_t BUTTERFLY_QOI[22864] = {
+    0xe5, 0xa3, 0x68, 0xa5, 0x59, 0xa2, 0x79, 0x69, 0x55, 0x9d, 0xa8, 0x9d, 0xa8, 0x00, 0xfd, 0xfd,
+    0xfd, 0xc4, 0xad, 0x08, 0xa5, 0x5a, 0x7e, 0xc3, 0x66, 0x55, 0x9c, 0xa8, 0x30, 0x27, 0x00, 0xfd,
+    0xfd, 0xfd, 0xab, 0x19, 0xa9, 0x37, 0x7f, 0xc1, 0x7e, 0xc3, 0x17, 0x66, 0x3e, 0x9c, 0xa7, 0x97,
+    0xd8, 0x00, 0xfd, 0xfd, 0xfb, 0x03, 0xa9, 0x42, 0xfe, 0xa5, 0x5a, 0xfe, 0x52, 0xd6, 0x6e, 0xc0,
+    0x7a, 0xc4, 0x65, 0x56, 0x51, 0x9b, 0xa9, 0x95, 0xe7, 0x00, 0xfd, 0xfd, 0xf8, 0xa2, 0x78, 0x17,
+    0xfe, 0xbd, 0xfb, 0xa8, 0x42, 0x2b, 0x7a, 0xc3, 0x6e, 0xc0, 0x7a, 0xc1, 0x2e, 0x1f, 0x06, 0x96,
+    0xd8, 0x00, 0xfd, 0xfd, 0xf7, 0xa6, 0x58, 0x2e, 0xfe, 0xef, 0x9e, 0xfe, 0xc6, 0x5c, 0x2e, 0xc5,
+    0x33, 0x36, 0xc1, 0x6e, 0xc0, 0x62, 0x1a, 0x9a, 0xb9, 0x27, 0x00, 0xfd, 0xfd, 0xf5, 0xfe, 0x42,
+    0x51, 0xfe, 0x9c, 0xf9, 0xfe, 0xf7, 0xdf, 0xfe, 0x7b, 0xf8, 0x2e, 0xc0, 0x69, 0xc3, 0x7e, 0x36,
+    0xc0, 0x7e, 0xc1, 0x6e, 0x3e, 0x51, 0x9c, 0x9a, 0x93, 0xe8, 0x00, 0xfd, 0xfd, 0xf2, 0x6f, 0xaf,
+    0x07, 0xad, 0x23, 0xfe, 0xb5, 0xbb, 0xfe, 0x73, 0xf7, 0x2e, 0x27, 0xc5, 0x2f, 0xc1, 0x7e, 0x3e,
+    0xc0, 0x03, 0x7a, 0x03, 0x3b, 0x9c, 0xaa, 0x95, 0xd9, 0x00, 0xfd, 0xfd, 0xf1, 0xfe, 0x4a, 0x93,
+    0x2e, 0x33, 0x2e, 0xc0, 0x27, 0xc5, 0x2a, 0x2f, 0xc0, 0x7a, 0xc1, 0x3e, 0x06, 0xc1, 0x6e, 0x03,
+    0x22, 0x95, 0xda, 0x00, 0xfd, 0xfd, 0xef, 0x1b, 0xfe, 0x63, 0x56, 0xfe, 0xad, 0x7a, 0x33, 0x2e,
+    0x27, 0xc6, 0x2a, 0x2f, 0x32, 0xa8, 0x42, 0xaa, 0x31, 0xa9, 0x41, 0xa6, 0x54, 0xa2, 0x76, 0x9b,
+    0xac, 0xfe, 0x9c, 0x98, 0x06, 0x0b, 0x06, 0x2a, 0x95, 0xcb, 0x94, 0xf7, 0xfd, 0xfd, 0xee, 0xa8,
+    0x46, 0x33, 0xfe, 0xf7, 0xbf, 0xfe, 0x8c, 0x78, 0x27, 0xc6, 0x2a, 0x2f, 0xab, 0x30, 0x14, 0xa5,
+    0x54, 0x7a, 0xc0, 0x6e, 0xc0, 0x6f, 0x9d, 0xaa, 0x06, 0x0b, 0x7a, 0x0b, 0x2a, 0x26, 0x00, 0xfd,
+    0xfd, 0xec, 0x6e, 0xfe, 0x52, 0x91, 0xaf, 0x01, 0x29, 0xfe, 0x9d, 0x1a, 0xfe, 0x5b, 0x15, 0x27,
+    0x5a, 0xc0, 0x27, 0xc2, 0x2a, 0xfe, 0xb5, 0x9a, 0x3a, 0x35, 0xc0, 0x7a, 0xc1, 0x3d, 0x02, 0x9a,
+    0xbd, 0xfe, 0x73, 0x35, 0x06, 0x0e, 0xc1, 0x2f, 0x92, 0xfc, 0x00, 0xfd, 0xfd, 0xea, 0x6f, 0xb0,
+    0x07, 0xae, 0x11, 0xfe, 0xef, 0x7e, 0xa2, 0x77, 0x29, 0x27, 0x5a, 0xc0, 0x27, 0xc2, 0x2a, 0x32,
+    0xfe, 0xde, 0x9c, 0x35, 0x66, 0xc1, 0x7a, 0xc0, 0x38, 0xc0, 0xfe, 0x9c, 0x78, 0x3a, 0x6e, 0x7b,
+    0x6e, 0x6e, 0x0e, 0x2a, 0x91, 0xea, 0x00, 0xfd, 0xfd, 0xe8, 0xa3, 0x68, 0xfe, 0x52, 0xd4, 0xa8,
+    0x53, 0xfe, 0xef, 0x7e, 0x6e, 0x2b, 0x2c, 0xc0, 0x56, 0x7a, 0xc2, 0xa3, 0x75, 0xa4, 0x65, 0xc0,
+    0x76, 0xfe, 0xbd, 0x7a, 0xaa, 0x40, 0x6e, 0x24, 0x7a, 0x6e, 0x33, 0xfe, 0xbd, 0x39, 0xfe, 0x73,
+    0x15, 0x3a, 0xc0, 0x7e, 0x0e, 0xc0, 0x13, 0x0e, 0x9b, 0x9b, 0xfe, 0x10, 0xa5, 0x00, 0xfd, 0xfd,
+    0xe7, 0xfe, 0x42, 0x2f, 0x3b, 0xa8, 0x42, 0x7e, 0x98, 0xbe, 0x51, 0x66, 0xc4, 0x0a, 0xfe, 0xdf,
+    0x1d, 0x66, 0x7a, 0x2d, 0x99, 0xdd, 0xfe, 0xa4, 0x78, 0xa3, 0x65, 0xa8, 0x52, 0xa3, 0x76, 0x56,
+    0xfe, 0xac, 0x98, 0xfe, 0x73, 0x14, 0x7b, 0xc0, 0x6e, 0xc0, 0x6e, 0x0e, 0x6e, 0x7a, 0x0e, 0x99,
+    0xab, 0x0c, 0x65, 0xfd, 0xfd, 0xe6, 0xfe, 0x5a, 0xd3, 0xa3, 0x78, 0xc1, 0x56, 0x2c, 0xc4, 0x27,
+    0xfe, 0x9d, 0x19, 0x34, 0x32, 0x2d, 0x29, 0x97, 0xdf, 0xfe, 0x8b, 0xb6, 0x9a, 0xbc, 0xc3, 0x2e,
+    0x7a, 0x38, 0x3d, 0xc0, 0x02, 0x0e, 0x13, 0x16, 0x6f, 0x9d, 0x9a, 0x96, 0xbb, 0x00, 0xfd, 0xfd,
+    0xe6, 0xb0, 0x06, 0x03, 0x0b, 0x3e, 0x55, 0x2c, 0xc4, 0x2f, 0xc0, 0xfe, 0x94, 0x77, 0xa7, 0x53,
+    0x9d, 0xab, 0x97, 0xde, 0x29, 0xc3, 0x7a, 0xc1, 0x6e, 0xc0, 0x3d, 0xc0, 0x02, 0xc0, 0x6f, 0x16,
+    0x22, 0xc0, 0x3a, 0x91, 0xdc, 0x00, 0xfd, 0xfd, 0xe5, 0xa3, 0x68, 0xfe, 0x6b, 0x35, 0xfe, 0xbd,
+    0xbb, 0x1c, 0x9b, 0xab, 0xc4, 0x2f, 0xc0, 0x7a, 0x69, 0x66, 0x29, 0xc2, 0x66, 0xc0, 0x7e, 0xc1,
+    0x31, 0xc0, 0x38, 0x3d, 0xc1, 0x02, 0x6e, 0x16, 0xc0, 0x7f, 0x16, 0x9b, 0x9b, 0xfe, 0x10, 0x84,
+    0x00, 0xfd, 0xfd, 0xe5, 0xfe, 0x4a, 0x4f, 0xfe, 0xbd, 0xfb, 0x9a, 0xbd, 0x2f, 0x5a, 0xc2, 0x2f,
+    0xc1, 0x32, 0x2b, 0x26, 0x29, 0xc0, 0x24, 0xc1, 0x7a, 0x6e, 0xc1, 0x31, 0xc0, 0x38, 0x3d, 0xc1,
+    0x02, 0xc0, 0x0e, 0x16, 0x7e, 0x25, 0x16, 0x97, 0xad, 0x00, 0xfd, 0xfd, 0xe5, 0xfe, 0x52, 0x70,
+    0xfe, 0xd6, 0xdd, 0x96, 0xcf, 0x2f, 0xc4, 0x6e, 0x32, 0x2b, 0x26, 0x29, 0xc0, 0x24, 0xc0, 0x7a,
+    0xc1, 0x2c, 0xc1, 0x31, 0xc0, 0x3d, 0xc2, 0x02, 0xc0, 0x07, 0x16, 0x6e, 0x25, 0x6e, 0x09, 0x92,
+    0xdc, 0x00, 0xfd, 0xfd, 0xe3, 0xa5, 0x57, 0xfe, 0x9c, 0xb9, 0xfe, 0xef, 0xbe, 0xfe, 0x8c, 0x98,
+    0x34, 0x2f, 0xc1, 0x34, 0x37, 0xc0, 0x32, 0x2b, 0x29, 0xc0, 0x24, 0xc0, 0x27, 0xc1, 0x2c, 0xc1,
+    0x31, 0xc1, 0x3d, 0xc1, 0x02, 0xc1, 0x07, 0x7e, 0x1b, 0x1e, 0x2a, 0xc0, 0x32, 0xfe, 0x10, 0xa5,
+    0x00, 0xfd, 0xfd, 0xe1, 0x0c, 0xfe, 0x63, 0x13, 0xfe, 0xe7, 0x5e, 0x9d, 0x9a, 0xfe, 0x6b, 0x56,
+    0x34, 0xc2, 0x37, 0xc0, 0xa6, 0x53, 0xa7, 0x53, 0x99, 0xcd, 0x29, 0x24, 0xc0, 0x27, 0xc2, 0x6e,
+    0xc1, 0x31, 0xc0, 0x6e, 0x3d, 0xc0, 0x6e, 0xc2, 0x07, 0x6e, 0x16, 0x1e, 0x2a, 0x7a, 0x51, 0x97,
+    0xad, 0xfe, 0x00, 0x21, 0x00, 0xfd, 0xfd, 0xe0, 0xb0, 0x05, 0xfe, 0xb5, 0x7a, 0xfe, 0xdf, 0x1d,
+    0xfe, 0x84, 0x17, 0x9a, 0xbd, 0x3c, 0x37, 0x5a, 0x37, 0xc0, 0xa4, 0x65, 0xfe, 0xde, 0xdd, 0x79,
+    0xfe, 0xbd, 0x79, 0x29, 0x24, 0x27, 0xc3, 0x2c, 0xc0, 0x6e, 0xc0, 0x3d, 0xc0, 0x02, 0xc2, 0x07,
+    0xc1, 0x7e, 0x16, 0x1b, 0x7e, 0x2d, 0xc0, 0x9d, 0x8a, 0x91, 0xed, 0x00, 0xfd, 0xfd, 0xe0, 0xfe,
+    0x6b, 0x34, 0xa6, 0x55, 0x9c, 0xab, 0xc1, 0x03, 0x3c, 0xc1, 0x37, 0xa7, 0x53, 0xfe, 0xe6, 0xfd,
+    0x9d, 0xaa, 0xfe, 0x93, 0xd6, 0x99, 0xcd, 0x27, 0xc4, 0x2c, 0x31, 0xc0, 0x7f, 0xc0, 0x6e, 0xc1,
+    0x07, 0x7a, 0x07, 0x0a, 0x07, 0x0f, 0xc0, 0x1b, 0x1e, 0x2d, 0x6e, 0x2d, 0x9a, 0x9c, 0xfe, 0x10,
+    0x84, 0x9c, 0xa8, 0xfd, 0xfd, 0xdf, 0xfe, 0x5a, 0x90, 0x13, 0x0e, 0x0b, 0xc1, 0x3c, 0xc0, 0x7a,
+    0x3a, 0xc0, 0x0f, 0x3d, 0x2c, 0x27, 0xc1, 0x69, 0x27, 0xc0, 0x7e, 0x6e, 0xc0, 0x6f, 0xc0, 0x05,
+    0xc0, 0x0a, 0xc5, 0x0f, 0xc0, 0x6e, 0x1e, 0x26, 0x6f, 0x7a, 0x42, 0x96, 0xbc, 0xfe, 0x00, 0x00,
+    0xfd, 0xfd, 0xdf, 0xa7, 0x46, 0x13, 0xc1, 0x0b, 0xc0, 0x66, 0x3f, 0xc0, 0x3a, 0xc0, 0x31, 0x2c,
+    0xc0, 0x27, 0xc0, 0x20, 0xc0, 0x7b, 0x2f, 0x6e, 0xc0, 0x6f, 0x05, 0xc0, 0x0a, 0xc4, 0x6e, 0xc3,
+    0x14, 0x1e, 0x23, 0x32, 0x35, 0xc0, 0x9c, 0x9b, 0x90, 0xdb, 0x95, 0xea, 0xfd, 0xfd, 0xdf, 0xfe,
+    0x52, 0x6f, 0xac, 0x34, 0xa3, 0x66, 0x0e, 0x0b, 0xc0, 0x3f, 0xc0, 0x3a, 0x3d, 0x31, 0x2c, 0x27,
+    0xc0, 0x20, 0x7a, 0x2a, 0x6e, 0xc0, 0x34, 0x6f, 0x6e, 0xc0, 0x0a, 0xc1, 0x0f, 0xc6, 0x14, 0xc1,
+    0x7f, 0x7e, 0x35, 0xc1, 0x9a, 0x9b, 0xfe, 0x08, 0x41, 0x51, 0xfd, 0xfd, 0xde, 0xa7, 0x57, 0xfe,
+    0x83, 0x97, 0xfe, 0xe7, 0x1d, 0x13, 0x0b, 0xc0, 0x69, 0x3f, 0x3d, 0x66, 0x31, 0x2c, 0x27, 0x20,
+    0x7a, 0xc0, 0x2a, 0x2f, 0x34, 0x6f, 0xa9, 0x31, 0xa8, 0x32, 0xa3, 0x66, 0x56, 0x9b, 0xbc, 0x99,
+    0xcd, 0x16, 0xc0, 0x0f, 0xc2, 0xa8, 0x32, 0xab, 0x10, 0x9b, 0xbc, 0x28, 0x51, 0x7f, 0x2b, 0x32,
+    0x35, 0x6e, 0x2d, 0x92, 0xdc, 0x90, 0xfb, 0xfd, 0xfd, 0xde, 0xa2, 0x78, 0x1d, 0xfe, 0xef, 0x5e,
+    0x08, 0x99, 0xcd, 0xc1, 0x02, 0x3d, 0x38, 0x69, 0xa4, 0x75, 0x7a, 0x2a, 0x69, 0x2a, 0x2f, 0x34,
+    0x15, 0xfe, 0xde, 0x3b, 0xa6, 0x44, 0x6e, 0x6e, 0x5e, 0xc1, 0x99, 0xce, 0xfe, 0xa4, 0x98, 0x99,
+    0xbd, 0xc0, 0x14, 0xc0, 0xfe, 0xd6, 0xdc, 0xa3, 0x66, 0x5e, 0x9d, 0xaa, 0xfe, 0x94, 0x97, 0x9a,
+    0xdd, 0xc0, 0x2b, 0x7f, 0x7a, 0xc0, 0x9c, 0x9b, 0xfe, 0x10, 0xa4, 0x00, 0xfd, 0xfd, 0xdd, 0xa4,
+    0x67, 0xfe, 0x8b, 0xd7, 0xfe, 0xef, 0xbf, 0x0d, 0x98, 0xde, 0xc1, 0x02, 0x66, 0x31, 0xa7, 0x63,
+    0xfe, 0xee, 0x1b, 0x66, 0x9d, 0x9a, 0x98, 0xcd, 0x97, 0xcf, 0x9c, 0xab, 0x34, 0xfe, 0xc5, 0x59,
+    0xac, 0x10, 0xa2, 0x66, 0x6e, 0x6f, 0x5e, 0xc1, 0xa2, 0x87, 0x7e, 0x26, 0xfe, 0x8b, 0xd6, 0x1e,
+    0x69, 0x39, 0x5e, 0xc1, 0x65, 0xfe, 0xa5, 0x18, 0x23, 0x2b, 0x7b, 0x6e, 0x7a, 0x35, 0x96, 0xbb,
+    0x00, 0xfd, 0xfd, 0xdd, 0xae, 0x25, 0xfe, 0xb5, 0x5a, 0x21, 0xfe, 0x83, 0xb7, 0x0e, 0xc0, 0x69,
+    0x02, 0x76, 0xa5, 0x64, 0xfe, 0xe5, 0xfb, 0x7a, 0x65, 0xc0, 0x3f, 0x04, 0x9d, 0x8a, 0x97, 0xdf,
+    0x3a, 0x03, 0xa7, 0x33, 0x0b, 0x6e, 0xc0, 0x0d, 0xc2, 0x69, 0x20, 0xfe, 0x94, 0x37, 0x9c, 0xbb,
+    0xfe, 0xce, 0xbb, 0x3b, 0xc2, 0x6e, 0xfe, 0xa5, 0x38, 0x98, 0xee, 0xa7, 0x44, 0x98, 0xee, 0x7a,
+    0x6f, 0x51, 0xfe, 0x20, 0xe5, 0x99, 0xba, 0xfd, 0xfd, 0xdb, 0xa3, 0x67, 0x23, 0x10, 0xfe, 0xce,
+    0x3c, 0x16, 0xc0, 0x66, 0x69, 0x05, 0xfe, 0xb4, 0xd8, 0xfe, 0xee, 0x5b, 0x62, 0x65, 0x33, 0xc0,
+    0x3f, 0xa2, 0x66, 0x6f, 0xa2, 0x66, 0x5a, 0x96, 0xdf, 0x52, 0xfe, 0xe7, 0x3d, 0x10, 0x6e, 0xc0,
+    0x5a, 0x0d, 0xc0, 0x69, 0x5a, 0x9d, 0xbb, 0xfe, 0x9c, 0x97, 0xa5, 0x55, 0xfe, 0xd7, 0x5d, 0xc0,
+    0x6e, 0xc1, 0x55, 0xfe, 0x9c, 0xd7, 0xfe, 0xdf, 0x5d, 0x9b, 0xcc, 0xfe, 0xa4, 0x57, 0x66, 0x6b,
+    0x97, 0xbb, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xdb, 0xb3, 0x04, 0xfe, 0xce, 0x3c, 0xa8, 0x42, 0xfe,
+    0x8b, 0xf7, 0x16, 0xc0, 0x11, 0x05, 0x7a, 0xfe, 0xee, 0x7c, 0x61, 0x3f, 0x33, 0xc0, 0x38, 0x6f,
+    0x09, 0x1a, 0x1f, 0x30, 0xa2, 0x66, 0x52, 0x39, 0xfe, 0xd6, 0x9c, 0x15, 0xc1, 0x12, 0x0d, 0xc0,
+    0x69, 0xa2, 0x77, 0x0d, 0xfe, 0x9c, 0xb8, 0xfe, 0xce, 0xbc, 0xa6, 0x33, 0xc2, 0x3b, 0x9b, 0xbb,
+    0x9b, 0xcc, 0x06, 0xfe, 0xce, 0x3b, 0x02, 0x7f, 0x51, 0x8a, 0xfe, 0x96, 0xdb, 0xfd, 0xfd, 0xd9,
+    0xa5, 0x57, 0x2a, 0xfe, 0xbd, 0x7a, 0x2f, 0x62, 0x59, 0x66, 0x66, 0x05, 0x08, 0xfe, 0xee, 0x5b,
+    0x04, 0x3f, 0x33, 0xc0, 0x3f, 0x04, 0x09, 0xa2, 0x67, 0xa2, 0x66, 0x30, 0x3a, 0x6f, 0x10, 0xfe,
+    0xc5, 0xdb, 0x6e, 0x15, 0xc1, 0x5a, 0x0d, 0xc0, 0x03, 0xc0, 0x52, 0xfe, 0xad, 0x39, 0x36, 0xa2,
+    0x66, 0xc1, 0x66, 0xc0, 0xfe, 0xb5, 0xb9, 0xac, 0x10, 0x7f, 0xfe, 0xb4, 0xf9, 0x9a, 0xdd, 0x6e,
+    0x98, 0xba, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xd9, 0xac, 0x35, 0x25, 0x2a, 0x25, 0xc0, 0x1e, 0x19,
+    0x66, 0x65, 0x66, 0xfe, 0xd5, 0x79, 0x04, 0x3f, 0x33, 0x38, 0x3f, 0x04, 0x0e, 0x1a, 0x24, 0x6f,
+    0x6e, 0x06, 0xa2, 0x66, 0x7e, 0x98, 0xce, 0x98, 0xde, 0x15, 0xc1, 0x5a, 0xc0, 0x0d, 0x59, 0xc0,
+    0x36, 0xfe, 0xb5, 0xda, 0xfe, 0xd7, 0x7d, 0xc1, 0x3b, 0x69, 0x9b, 0xcc, 0x26, 0x3c, 0x9c, 0xbb,
+    0xfe, 0xac, 0x37, 0x6f, 0xc0, 0xfe, 0x29, 0x46, 0x96, 0xdc, 0xfd, 0xfd, 0xd8, 0xab, 0x35, 0x2a,
+    0xc1, 0x25, 0x69, 0x19, 0x66, 0x08, 0x66, 0xa5, 0x64, 0x04, 0x3f, 0x38, 0x3f, 0x04, 0x09, 0x0e,
+    0x1a, 0x24, 0x30, 0x35, 0xa2, 0x66, 0x7f, 0x18, 0x6f, 0x96, 0xef, 0xfe, 0xb5, 0x19, 0x10, 0x15,
+    0xc0, 0x12, 0xc0, 0x0d, 0x59, 0x12, 0x9d, 0xaa, 0x99, 0xcd, 0xa9, 0x11, 0xc0, 0x3b, 0xc0, 0x65,
+    0xfe, 0xb5, 0x79, 0xfe, 0xdf, 0x1d, 0x3c, 0x28, 0x9c, 0xbc, 0xc0, 0x99, 0xb9, 0xfe, 0x00, 0x00,
+    0xfd, 0xfd, 0xd8, 0x7f, 0xfe, 0x83, 0x95, 0xa6, 0x55, 0x2a, 0xc0, 0x1e, 0xfe, 0xc5, 0xba, 0xa6,
+    0x64, 0x99, 0xcd, 0x97, 0xee, 0x97, 0xdf, 0xa7, 0x53, 0xfe, 0xed, 0xfb, 0x04, 0xc0, 0x09, 0xc0,
+    0x1a, 0x6e, 0x6e, 0x30, 0x35, 0xa2, 0x76, 0x0e, 0x18, 0x6f, 0xc0, 0xfe, 0xbd, 0x9a, 0x9a, 0xcd,
+    0x0d, 0x15, 0xc0, 0x5a, 0xc0, 0x0d, 0x5e, 0xc0, 0x99, 0xdd, 0x6e, 0xa5, 0x44, 0x3b, 0xc0, 0x2f,
+    0x9b, 0xcc, 0x9c, 0xbb, 0x34, 0xfe, 0xc5, 0xba, 0x05, 0x11, 0x7e, 0xfe, 0x29, 0x26, 0x97, 0xcb,
+    0xfd, 0xfd, 0xd8, 0xac, 0x35, 0xfe, 0xd6, 0x3c, 0x99, 0xbd, 0xfe, 0x93, 0xd7, 0x65, 0xa7, 0x43,
+    0xfe, 0xf6, 0xfd, 0x61, 0x1a, 0x04, 0x96, 0xdf, 0x99, 0xcd, 0xa9, 0x31, 0x04, 0x09, 0x6e, 0x1a,
+    0x6e, 0x6e, 0x7f, 0x38, 0x02, 0x6f, 0x6e, 0x6e, 0x6f, 0x9d, 0xaa, 0xfe, 0x9c, 0x17, 0xa5, 0x54,
+    0xfe, 0xe7, 0x5e, 0x15, 0x12, 0xc2, 0x03, 0x6e, 0xfe, 0xc6, 0x5b, 0xa9, 0x11, 0x66, 0x36, 0x65,
+    0x66, 0x96, 0xff, 0xaa, 0x21, 0xfe, 0xc5, 0x9a, 0x3d, 0x05, 0x19, 0x96, 0xcb, 0xfe, 0x00, 0x00,
+    0xfd, 0xfd, 0xd8, 0xa2, 0x77, 0xfe, 0xa4, 0xb9, 0x13, 0xfe, 0x93, 0xb7, 0x21, 0x3a, 0x38, 0x27,
+    0x62, 0x55, 0x09, 0x04, 0xfe, 0xbc, 0x77, 0x97, 0xdf, 0xaa, 0x21, 0xab, 0x20, 0x1f, 0x7a, 0x27,
+    0x33, 0x38, 0x02, 0x6f, 0x13, 0x18, 0xc0, 0xfe, 0xc5, 0xdb, 0xfe, 0xa4, 0x37, 0xc0, 0x1b, 0xfe,
+    0xe7, 0x3d, 0xa3, 0x66, 0x12, 0xc1, 0x0f, 0x08, 0x03, 0x99, 0xcd, 0xa7, 0x33, 0x36, 0x2a, 0x25,
+    0x99, 0xdd, 0xa2, 0x77, 0x1a, 0xfe, 0xa3, 0xf6, 0x05, 0x7f, 0x19, 0xfe, 0x18, 0xa3, 0x9b, 0xaa,
+    0xfd, 0xfd, 0xd8, 0xfe, 0x83, 0x95, 0xfe, 0xff, 0xbf, 0xfe, 0x9b, 0xf7, 0x9d, 0xaa, 0x7e, 0x33,
+    0x22, 0x1d, 0x55, 0x66, 0xc1, 0x21, 0xfe, 0x93, 0x35, 0x6e, 0xa8, 0x42, 0xaa, 0x21, 0xa9, 0x21,
+    0x33, 0x38, 0x6e, 0x6e, 0x99, 0xce, 0x97, 0xde, 0x99, 0xcd, 0x62, 0x6e, 0xc1, 0xa2, 0x77, 0xfe,
+    0xde, 0xfd, 0xa6, 0x43, 0x12, 0xc1, 0x5a, 0xc0, 0x99, 0xed, 0x3b, 0x36, 0x2a, 0x25, 0x66, 0xfe,
+    0xbd, 0x79, 0xa3, 0x66, 0x31, 0x7f, 0x0d, 0x19, 0x91, 0xdc, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xd8,
+    0xfe, 0x8b, 0x95, 0xfe, 0xf7, 0x5e, 0xfe, 0x93, 0xb6, 0x1c, 0x66, 0x1f, 0x22, 0x1d, 0x65, 0x5a,
+    0xc1, 0x09, 0xfe, 0xa3, 0x96, 0x51, 0xc0, 0x6e, 0x6f, 0xa7, 0x42, 0xa4, 0x56, 0x65, 0x3d, 0x61,
+    0x6f, 0xc0, 0x3d, 0x02, 0xc2, 0x16, 0xfe, 0xdf, 0x1d, 0x1a, 0x56, 0xc1, 0xa2, 0x87, 0x7e, 0x3f,
+    0x36, 0x2a, 0x25, 0x20, 0xfe, 0xb5, 0x59, 0xa5, 0x64, 0xfe, 0x9b, 0xd6, 0x7e, 0x05, 0x19, 0x0d,
+    0xfe, 0x08, 0x21, 0x00, 0xfd, 0xfd, 0xd6, 0xa5, 0x66, 0xfe, 0xac, 0xd9, 0xaa, 0x30, 0xfe, 0x9b,
+    0xb6, 0x1f, 0x66, 0xfe, 0xe6, 0x3b, 0xa3, 0x76, 0x1d, 0xc0, 0x11, 0xc1, 0x1d, 0xfe, 0xc4, 0xd8,
+    0x0e, 0x13, 0xc0, 0x1f, 0xc0, 0x24, 0x7a, 0x6e, 0xc0, 0x38, 0x3d, 0xc0, 0x02, 0xc3, 0xa3, 0x66,
+    0x3c, 0xa4, 0x55, 0x12, 0xc2, 0xfe, 0xc6, 0x3b, 0x2a, 0xc0, 0x25, 0x20, 0x98, 0xee, 0x98, 0xee,
+    0x97, 0xee, 0x2c, 0xa2, 0x77, 0x0d, 0xa2, 0x77, 0x8b, 0xff, 0x91, 0xed, 0xfd, 0xfd, 0xd6, 0xfe,
+    0x6a, 0xd0, 0xfe, 0xde, 0x7c, 0x3d, 0x9d, 0xaa, 0x1f, 0x13, 0xfe, 0xdd, 0xfb, 0xa6, 0x53, 0x22,
+    0x66, 0xc3, 0x97, 0xde, 0x13, 0xc1, 0x7f, 0xc0, 0x6e, 0xc0, 0x6e, 0x31, 0x38, 0x3d, 0xc0, 0x7e,
+    0xc1, 0x6f, 0xc0, 0x07, 0x28, 0xfe, 0xe7, 0x7e, 0x1a, 0x5a, 0x12, 0x0d, 0x51, 0x0b, 0x34, 0x25,
+    0x20, 0x9c, 0xbb, 0xfe, 0x9b, 0xd5, 0x66, 0x27, 0xa2, 0x76, 0xa2, 0x77, 0x21, 0x9a, 0xaa, 0x00,
+    0xfd, 0xfd, 0xd5, 0xb2, 0x13, 0xfe, 0xbd, 0x3a, 0x98, 0xdd, 0x24, 0x1f, 0xc0, 0x13, 0xfe, 0xd5,
+    0xba, 0xa8, 0x42, 0x66, 0x66, 0xc3, 0xfe, 0xcc, 0xf8, 0x13, 0xc0, 0x7e, 0x6b, 0xc0, 0x6e, 0xc0,
+    0x2c, 0x31, 0x38, 0x7e, 0xc1, 0x05, 0xc0, 0x11, 0xc1, 0x69, 0xa5, 0x45, 0xfe, 0xe7, 0x5e, 0x1a,
+    0x12, 0xc0, 0x65, 0x0b, 0xa5, 0x44, 0xa7, 0x43, 0x20, 0x61, 0xfe, 0x9b, 0xd5, 0x66, 0x31, 0xab,
+    0x20, 0x9d, 0xab, 0x9c, 0xbb, 0xa2, 0x76, 0xfe, 0x29, 0x05, 0x98, 0xbb, 0xfd, 0xfd, 0xd3, 0xb2,
+    0x14, 0x35, 0x66, 0x69, 0x24, 0x1f, 0xc0, 0x13, 0xfe, 0xcd, 0x39, 0xfe, 0xf6, 0xbc, 0x66, 0xc3,
+    0x56, 0xfe, 0xab, 0xd6, 0x9d, 0xaa, 0x1b, 0x6b, 0xc0, 0x6e, 0xc0, 0x2c, 0xc0, 0x7e, 0x6b, 0x6e,
+    0xc0, 0x05, 0xc1, 0x11, 0xc3, 0xa3, 0x65, 0xfe, 0xde, 0xdd, 0x15, 0x12, 0x01, 0x02, 0xc0, 0xfe,
+    0xc5, 0xfa, 0x20, 0x0f, 0xfe, 0xa3, 0xd5, 0x56, 0xab, 0x21, 0xab, 0x10, 0xa2, 0x77, 0xfe, 0xc4,
+    0xb8, 0xc0, 0x92, 0xdd, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xd2, 0xa6, 0x56, 0xfe, 0x9c, 0x17, 0x35,
+    0x30, 0x24, 0xc0, 0x1f, 0xc0, 0x13, 0x2c, 0xfe, 0xdd, 0xfb, 0xa6, 0x53, 0x66, 0xc1, 0x1a, 0xfe,
+    0xbc, 0x77, 0x16, 0x1b, 0xc0, 0x6b, 0x6e, 0xc0, 0x7a, 0x2f, 0xc0, 0x34, 0x3b, 0x6e, 0xc0, 0x05,
+    0xa3, 0x66, 0x62, 0x11, 0xc5, 0xa4, 0x55, 0x6e, 0x05, 0x02, 0x65, 0xc0, 0x0a, 0x36, 0x25, 0x66,
+    0xa7, 0x33, 0xfe, 0xde, 0x3b, 0xa3, 0x66, 0x98, 0xee, 0x98, 0xee, 0x21, 0xfe, 0x08, 0x41, 0x51,
+    0xfd, 0xfd, 0xd1, 0xa8, 0x56, 0xfe, 0xbd, 0x3a, 0x9a, 0xcc, 0x30, 0x65, 0x1f, 0xc2, 0x69, 0x13,
+    0xa8, 0x32, 0x0c, 0x20, 0x9b, 0xbb, 0x27, 0x61, 0x1b, 0xc0, 0x22, 0xc0, 0x27, 0x2a, 0xa2, 0x66,
+    0xa5, 0x55, 0x9c, 0xab, 0x3b, 0xc0, 0x00, 0x7a, 0x6e, 0xa5, 0x45, 0xfe, 0xee, 0xfd, 0x1e, 0x62,
+    0xc0, 0x19, 0xc1, 0x5a, 0xc0, 0x0a, 0xc0, 0x05, 0x02, 0x36, 0x31, 0xc0, 0x2c, 0x25, 0x7b, 0xfe,
+    0xde, 0x1b, 0xa2, 0x77, 0xc0, 0xfe, 0xbc, 0x78, 0xa2, 0x77, 0xfe, 0x49, 0xc9, 0x92, 0xdd, 0xfd,
+    0xfd, 0xd1, 0xa2, 0x77, 0xfe, 0xb4, 0xd9, 0xfe, 0xd6, 0x5c, 0x24, 0xc0, 0x1f, 0xc4, 0x18, 0x13,
+    0x18, 0x1b, 0xc1, 0x22, 0xc0, 0x27, 0xc0, 0x2a, 0x6e, 0x39, 0xa9, 0x21, 0x66, 0x97, 0xef, 0x08,
+    0x03, 0xc0, 0x08, 0xc0, 0xfe, 0xe6, 0xbc, 0x35, 0x1e, 0x19, 0xc5, 0x0a, 0xc0, 0x05, 0x65, 0xc0,
+    0x66, 0x2c, 0x25, 0x66, 0x07, 0x3e, 0xa3, 0x66, 0xfe, 0xcc, 0xf9, 0x30, 0x97, 0xba, 0xfe, 0x00,
+    0x00, 0xc7, 0x37, 0x9c, 0x99, 0x00, 0xfd, 0xfd, 0xc6, 0xa4, 0x66, 0xfe, 0xa4, 0x58, 0xfe, 0xe6,
+    0xfd, 0x24, 0x1f, 0xc8, 0x22, 0xc2, 0x27, 0xc1, 0x2a, 0x2f, 0xfe, 0xe6, 0x1b, 0xa8, 0x22, 0xc0,
+    0x6e, 0x38, 0xfe, 0xcd, 0x19, 0x08, 0x17, 0x51, 0x99, 0xde, 0xfe, 0xff, 0xbf, 0x17, 0x19, 0xc5,
+    0x65, 0x0a, 0x66, 0xc0, 0x39, 0x34, 0xc0, 0x65, 0x66, 0xa2, 0x77, 0xfe, 0xdd, 0xfb, 0xa2, 0x76,
+    0x9b, 0xbc, 0x29, 0x6e, 0xfe, 0x10, 0x62, 0x00, 0xc5, 0xad, 0x23, 0xfe, 0xbc, 0xd9, 0xfe, 0x49,
+    0xea, 0x00, 0xfd, 0xfd, 0xc6, 0x26, 0x16, 0xfe, 0xe6, 0xdd, 0x24, 0x1f, 0xc8, 0x22, 0x6e, 0xc3,
+    0x6e, 0x2f, 0x34, 0xfe, 0xee, 0x9c, 0x3d, 0xc0, 0x6e, 0xc0, 0x7f, 0xc0, 0x6e, 0xc0, 0x56, 0xa3,
+    0x66, 0x6e, 0xfe, 0xcd, 0x7a, 0x1c, 0x6e, 0xc1, 0x1e, 0x19, 0xc0, 0x69, 0x0d, 0x08, 0x55, 0xc0,
+    0x34, 0x2f, 0x65, 0xc0, 0xa5, 0x55, 0xfe, 0xdd, 0xda, 0x06, 0xfe, 0xc4, 0x98, 0xa2, 0x76, 0xfe,
+    0x52, 0x0a, 0x00, 0xc4, 0xa3, 0x67, 0xfe, 0xb4, 0xb8, 0xa2, 0x87, 0xfe, 0x41, 0xc9, 0x00, 0xfd,
+    0xfd, 0xc6, 0xb3, 0x13, 0xfe, 0xbd, 0x5a, 0xa6, 0x53, 0xfe, 0x9b, 0x96, 0xc4, 0x6e, 0xc2, 0x7a,
+    0xc3, 0x2f, 0xc1, 0xfe, 0xcd, 0x59, 0x17, 0x38, 0x3d, 0xc0, 0x02, 0xc0, 0x11, 0xc0, 0x16, 0xc0,
+    0x6e, 0x6f, 0xc0, 0x51, 0xfe, 0xbc, 0xb8, 0x21, 0xc2, 0x1c, 0xc1, 0x55, 0x08, 0xc0, 0x39, 0x66,
+    0x2f, 0x28, 0x66, 0x66, 0xc0, 0x10, 0xa2, 0x77, 0xa2, 0x77, 0x98, 0xaa, 0x00, 0xc4, 0xb0, 0x12,
+    0x3a, 0x9c, 0x99, 0xfe, 0x00, 0x21, 0x00, 0xfd, 0xfd, 0xc5, 0xa3, 0x77, 0xfe, 0x9b, 0xf6, 0xfe,
+    0xde, 0x9d, 0xfe, 0xac, 0xb8, 0x97, 0xef, 0x1f, 0xc2, 0x6e, 0xc1, 0x7a, 0xc3, 0x6e, 0x03, 0xa5,
+    0x55, 0x9c, 0xba, 0x3f, 0x21, 0x03, 0x13, 0x3d, 0xc0, 0x02, 0xc0, 0x6b, 0x11, 0x16, 0xc0, 0x1b,
+    0x6f, 0xc0, 0x6e, 0x3e, 0x21, 0xc4, 0x66, 0x10, 0x0d, 0x66, 0x65, 0x37, 0x34, 0x28, 0x66, 0xc0,
+    0x1e, 0x7e, 0x15, 0xa3, 0x76, 0xc0, 0xfe, 0x10, 0x62, 0x00, 0xc3, 0xfe, 0x7b, 0x30, 0xae, 0x23,
+    0xfe, 0x31, 0x46, 0x00, 0xfd, 0xfd, 0xc5, 0x6e, 0xfe, 0x7b, 0x32, 0xfe, 0xc5, 0xbb, 0xa3, 0x65,
+    0xfe, 0x93, 0x96, 0xc0, 0x1f, 0xc1, 0x24, 0xc2, 0x7a, 0xc0, 0x6e, 0xc1, 0xa7, 0x43, 0x35, 0xc2,
+    0x61, 0xfe, 0xcd, 0x59, 0x9c, 0xbb, 0xfe, 0xe6, 0x9c, 0x13, 0x02, 0xc0, 0x09, 0x0e, 0x13, 0x16,
+    0x1b, 0x6f, 0xc0, 0x6e, 0x51, 0x29, 0x26, 0x3a, 0xaa, 0x11, 0x07, 0x21, 0x66, 0xc0, 0x10, 0x08,
+    0x69, 0x3c, 0x66, 0x65, 0x56, 0xc0, 0x1e, 0x7a, 0xa5, 0x45, 0x2e, 0x31, 0xfe, 0x49, 0xc9, 0x00,
+    0xc3, 0xfe, 0x93, 0xd3, 0x97, 0xcc, 0x00, 0xfd, 0xfd, 0xc5, 0xa3, 0x77, 0x28, 0xfe, 0xbd, 0x5a,
+    0xa4, 0x55, 0xfe, 0x93, 0xd6, 0x62, 0xc0, 0x1f, 0xc1, 0x6e, 0xc2, 0x7e, 0xc2, 0x6e, 0xfe, 0xd5,
+    0xfb, 0x35, 0xc3, 0x6e, 0x9c, 0xbb, 0x3f, 0xa3, 0x66, 0x35, 0x02, 0x09, 0x0e, 0xc0, 0x13, 0x1b,
+    0x27, 0xc0, 0x6e, 0xc0, 0xfe, 0xd5, 0xdb, 0x29, 0xfe, 0xde, 0x5c, 0x2c, 0x56, 0x30, 0x18, 0x98,
+    0xee, 0x10, 0xc0, 0x08, 0x3c, 0x37, 0x66, 0x55, 0xc0, 0x1e, 0x21, 0x3c, 0xa4, 0x66, 0xc0, 0x94,
+    0xcc, 0x00, 0xc3, 0xfe, 0x9b, 0xf4, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xc4, 0xa6, 0x66, 0xfe,
+    0x93, 0xd5, 0xa1, 0x89, 0x66, 0x55, 0x66, 0xc2, 0x7a, 0x6e, 0xc0, 0xa6, 0x44, 0xfe, 0xcd, 0xfb,
+    0xa5, 0x54, 0xc0, 0x03, 0x36, 0xc0, 0xa6, 0x43, 0xa2, 0x77, 0xc3, 0x3a, 0xc2, 0x03, 0xfe, 0xbc,
+    0xb8, 0x03, 0xab, 0x00, 0x0e, 0xc0, 0x13, 0x18, 0xc0, 0x27, 0x2c, 0xc0, 0x9b, 0xbc, 0x29, 0x17,
+    0x2c, 0x27, 0x18, 0x13, 0x3a, 0x03, 0x9b, 0xcc, 0x9b, 0xbb, 0x10, 0x37, 0xc0, 0x23, 0x1e, 0x65,
+    0xc0, 0x32, 0xa5, 0x45, 0xc0, 0x01, 0x00, 0xc3, 0xfe, 0x72, 0xef, 0x00, 0xfd, 0xfd, 0xc4, 0x14,
+    0xfe, 0x93, 0xd5, 0xa1, 0x89, 0x56, 0x65, 0xc0, 0x66, 0xc2, 0x7a, 0x24, 0x0d, 0xfe, 0xe6, 0xdd,
+    0xc0, 0x6e, 0xc0, 0x6e, 0x3a, 0xcb, 0x66, 0x0c, 0xa2, 0x67, 0xfe, 0xef, 0x3e, 0x0e, 0x13, 0xc0,
+    0x18, 0x6f, 0xc0, 0x2c, 0xc0, 0xfe, 0xcd, 0x3a, 0x0a, 0x2c, 0xc0, 0x13, 0x66, 0x09, 0x3a, 0x35,
+    0x51, 0x66, 0x99, 0xdd, 0x10, 0x23, 0x1e, 0x12, 0x66, 0x23, 0xa5, 0x45, 0x10, 0x6b, 0xfe, 0x28,
+    0xe5, 0x00, 0xc2, 0xb2, 0x11, 0x00, 0xfd, 0xfd, 0xc4, 0xaf, 0x24, 0xb0, 0x24, 0x56, 0x65, 0xc0,
+    0x66, 0xc3, 0x7e, 0x35, 0xfe, 0xde, 0xbd, 0x6e, 0x32, 0xc0, 0x37, 0xc8, 0x3a, 0xc2, 0x6e, 0xc0,
+    0x06, 0x03, 0xfe, 0xc4, 0xf9, 0x32, 0xa3, 0x66, 0x13, 0x18, 0xc0, 0x6f, 0xc0, 0x6e, 0x0f, 0x9b,
+    0xcc, 0x27, 0x6e, 0x13, 0x0e, 0x06, 0x65, 0x62, 0x55, 0x66, 0x66, 0x03, 0x2e, 0xfe, 0xab, 0x75,
+    0x55, 0x66, 0x1e, 0xa5, 0x45, 0x0d, 0x08, 0x8f, 0xed, 0x00, 0xc2, 0xb1, 0x12, 0x8f, 0xfe, 0xfd,
+    0xfd, 0xc4, 0xb0, 0x23, 0xfe, 0xac, 0xb9, 0xc0, 0x98, 0xdd, 0x66, 0x5a, 0xc0, 0x1c, 0xc1, 0x7e,
+    0xc0, 0xfe, 0xd6, 0x5c, 0x2a, 0x32, 0xc0, 0x37, 0xcb, 0x3a, 0x3f, 0xc2, 0x9d, 0xab, 0xfe, 0xc5,
+    0x39, 0xfe, 0xe6, 0xbc, 0xa6, 0x34, 0xc0, 0x18, 0x6b, 0x6e, 0xc0, 0x06, 0xfe, 0xcd, 0x5a, 0x1f,
+    0x65, 0x0e, 0x09, 0x3a, 0x66, 0x30, 0x21, 0x66, 0x62, 0x03, 0x66, 0x97, 0xee, 0x05, 0xc0, 0xa2,
+    0x67, 0x34, 0x08, 0xc0, 0x97, 0xbb, 0x00, 0xc2, 0xaf, 0x23, 0x00, 0xfd, 0xfd, 0xc4, 0xab, 0x34,
+    0x27, 0xfe, 0xd6, 0x9d, 0xfe, 0x93, 0xd7, 0x19, 0xc1, 0x7a, 0xc1, 0x6e, 0x7a, 0xa3, 0x66, 0xfe,
+    0xcd, 0xfb, 0xa8, 0x22, 0x32, 0x37, 0xc0, 0x6e, 0xc1, 0x37, 0xc6, 0x3c, 0xc3, 0x06, 0x3c, 0xfe,
+    0xcd, 0x7a, 0xa8, 0x22, 0x0b, 0x10, 0xc0, 0x6f, 0xc0, 0x7e, 0x07, 0x13, 0xc0, 0x0e, 0x06, 0x65,
+    0x35, 0x30, 0x55, 0x17, 0x12, 0x03, 0x62, 0x65, 0xfe, 0xbc, 0x57, 0x96, 0xff, 0x0a, 0xa4, 0x56,
+    0xa2, 0x67, 0xc0, 0x34, 0xfe, 0x00, 0x00, 0xc2, 0xae, 0x23, 0x00, 0xfd, 0xfd, 0xc4, 0xa7, 0x44,
+    0xfe, 0xb4, 0xf9, 0xfe, 0xce, 0x9d, 0xfe, 0xa4, 0x98, 0x19, 0xc0, 0x66, 0x7e, 0xc1, 0x6e, 0x7a,
+    0x6e, 0xc0, 0xa5, 0x55, 0xaa, 0x10, 0x25, 0x3c, 0xc8, 0x37, 0xc1, 0x3c, 0x37, 0x3c, 0x37, 0x6f,
+    0xc1, 0x33, 0x0c, 0xa9, 0x21, 0xc1, 0x6f, 0xc0, 0x36, 0x32, 0x0e, 0x06, 0x3a, 0x35, 0x30, 0x55,
+    0x66, 0x17, 0x12, 0x3e, 0x39, 0x55, 0x20, 0xfe, 0xab, 0x75, 0x05, 0xa4, 0x46, 0xa2, 0x76, 0xc1,
+    0xfe, 0x20, 0xc4, 0x00, 0xc1, 0xac, 0x34, 0x00, 0xfd, 0xfd, 0xc4, 0xa2, 0x77, 0xfe, 0xb5, 0x3a,
+    0xaa, 0x11, 0xfe, 0xa4, 0xb9, 0x97, 0xee, 0x66, 0xc0, 0x19, 0x7a, 0xc0, 0xa5, 0x44, 0xaa, 0x21,
+    0xa7, 0x33, 0xa3, 0x66, 0x65, 0x38, 0x99, 0xdd, 0x52, 0x1f, 0xa8, 0x22, 0x3c, 0xc7, 0x37, 0xc4,
+    0x6b, 0x03, 0xc0, 0x98, 0xee, 0xa2, 0x76, 0xaa, 0x11, 0x41, 0xc0, 0x7b, 0x14, 0x0f, 0x0b, 0x66,
+    0x3a, 0x35, 0x30, 0x21, 0x66, 0x62, 0x56, 0x65, 0x39, 0x51, 0x20, 0x99, 0xdd, 0xfe, 0x9b, 0x14,
+    0xa4, 0x55, 0xa2, 0x67, 0xc1, 0x8e, 0xed, 0x00, 0xc1, 0xab, 0x34, 0x00, 0xfd, 0xfd, 0xc4, 0xa9,
+    0x45, 0x2b, 0x15, 0xfe, 0x9c, 0x58, 0x99, 0xdd, 0xc1, 0x19, 0x7a, 0xfe, 0xad, 0x19, 0x1a, 0x22,
+    0xc0, 0x7e, 0x6e, 0x6e, 0x6b, 0x6d, 0x16, 0x1f, 0x9b, 0xbc, 0xa4, 0x65, 0xa9, 0x11, 0xa4, 0x55,
+    0xc3, 0x34, 0xc8, 0x03, 0x9a, 0xcc, 0x0c, 0xa8, 0x22, 0xc1, 0x9b, 0xcc, 0x98, 0xee, 0x06, 0xc0,
+    0x32, 0x66, 0x66, 0x65, 0x66, 0x12, 0x55, 0x3e, 0x62, 0x55, 0x20, 0x65, 0xfe, 0xa3, 0x54, 0x5f,
+    0x2c, 0x27, 0xc0, 0x94, 0xbb, 0x00, 0xc1, 0xaa, 0x44, 0x00, 0xfd, 0xfd, 0xc4, 0xfe, 0x6a, 0xce,
+    0x2a, 0x9c, 0x9b, 0xfe, 0x93, 0xb6, 0x52, 0xc1, 0x19, 0x36, 0x15, 0x6e, 0x22, 0x6e, 0xc0, 0x7f,
+    0x3b, 0x6e, 0xc0, 0x08, 0x5a, 0xc0, 0x1b, 0xfe, 0xbd, 0x7a, 0x9d, 0xba, 0xa9, 0x11, 0x39, 0xc1,
+    0x66, 0xc8, 0x3b, 0xc0, 0x16, 0x66, 0x00, 0xc0, 0x3b, 0xfe, 0xc5, 0x19, 0xfe, 0xf7, 0x9e, 0xa3,
+    0x66, 0x62, 0x28, 0x66, 0x17, 0x66, 0x56, 0x3e, 0x66, 0x55, 0x25, 0x62, 0x65, 0x99, 0xcd, 0x97,
+    0xdf, 0xa3, 0x56, 0x66, 0xc0, 0x99, 0xa9, 0x8b, 0xfd, 0xc1, 0xa8, 0x55, 0x00, 0xfd, 0xfd, 0xc3,
+    0xa7, 0x55, 0xfe, 0xcd, 0x9a, 0xfe, 0xe7, 0x3e, 0xfe, 0xac, 0xf9, 0x19, 0x14, 0xc0, 0x19, 0xa6,
+    0x54, 0x06, 0x7f, 0x6e, 0x22, 0x6e, 0x6e, 0x3b, 0x6e, 0xc0, 0x05, 0xc2, 0xa2, 0x86, 0xa3, 0x76,
+    0x34, 0x38, 0x9a, 0xcc, 0xa6, 0x34, 0x34, 0xc7, 0x2f, 0x2c, 0x6e, 0xc0, 0x6b, 0x16, 0x10, 0x08,
+    0x00, 0xfe, 0xb4, 0x98, 0xfe, 0xff, 0xdf, 0x6e, 0xc0, 0x2d, 0x9d, 0xaa, 0x66, 0x0a, 0x3e, 0x39,
+    0x56, 0x25, 0x20, 0x1b, 0x65, 0x5a, 0x13, 0x6e, 0xc1, 0x9c, 0xaa, 0xfe, 0x00, 0x00, 0xc1, 0xa7,
+    0x56, 0x00, 0xfd, 0xfd, 0xc3, 0xfe, 0x9b, 0xb4, 0x32, 0x33, 0xfe, 0x9b, 0xd6, 0x19, 0x66, 0xc0,
+    0x19, 0xfe, 0xbd, 0xdb, 0xa4, 0x56, 0x7e, 0x1a, 0x6e, 0x27, 0x6e, 0x38, 0x7e, 0xc0, 0x05, 0xc3,
+    0xa2, 0x86, 0x00, 0xc0, 0x69, 0x9b, 0xbc, 0x97, 0xff, 0xa4, 0x55, 0xa9, 0x11, 0xc2, 0x2c, 0xc7,
+    0x22, 0x27, 0x38, 0xfe, 0xb4, 0xd9, 0xfe, 0xde, 0xdd, 0xa9, 0x31, 0x9d, 0xab, 0x98, 0xde, 0x61,
+    0x0a, 0x69, 0x3e, 0x56, 0x66, 0x25, 0x1b, 0x66, 0x55, 0x0c, 0x98, 0xde, 0x99, 0xcd, 0xc1, 0x5a,
+    0xfe, 0x00, 0x20, 0x66, 0xc0, 0x0b, 0x00, 0xfd, 0xfd, 0xc2, 0xad, 0x34, 0xb6, 0x11, 0x6e, 0x42,
+    0x9d, 0xaa, 0x19, 0x14, 0xc0, 0xa4, 0x55, 0xfe, 0xc6, 0x3c, 0x6f, 0x7e, 0x1a, 0x6e, 0x27, 0x6f,
+    0x6e, 0x7e, 0x6e, 0xc5, 0x56, 0x69, 0xc0, 0x66, 0xc0, 0x9c, 0xbb, 0x12, 0x35, 0x2c, 0xc1, 0x27,
+    0xc2, 0x5a, 0xc3, 0x9d, 0xba, 0x27, 0xfe, 0xbd, 0x3a, 0xa4, 0x55, 0x22, 0x66, 0x65, 0x62, 0x66,
+    0x69, 0x66, 0x66, 0x25, 0x56, 0x66, 0x0c, 0x66, 0xc0, 0x04, 0x10, 0xc0, 0x66, 0xc0, 0xfe, 0x18,
+    0x83, 0x9c, 0x99, 0xc0, 0xa7, 0x56, 0x00, 0xfd, 0xfd, 0xc2, 0xfe, 0x83, 0x31, 0xaa, 0x45, 0xc0,
+    0x56, 0x51, 0x9d, 0x9a, 0x56, 0xc0, 0xa5, 0x54, 0x01, 0x0d, 0x6e, 0x1a, 0x1f, 0x27, 0x33, 0x38,
+    0x7e, 0x05, 0xc4, 0x5a, 0x66, 0x69, 0xc0, 0x66, 0xc1, 0xa6, 0x74, 0x96, 0xdf, 0xfe, 0xb5, 0x39,
+    0x35, 0xa6, 0x34, 0xc1, 0x1f, 0xc6, 0x15, 0x9a, 0xcc, 0x9b, 0xcb, 0x1a, 0x75, 0x66, 0x66, 0x61,
+    0xc0, 0x66, 0x25, 0x1d, 0x18, 0x65, 0x66, 0x66, 0xc0, 0x31, 0x10, 0x0b, 0xc0, 0x66, 0x8e, 0xca,
+    0x99, 0xba, 0xc0, 0xa8, 0x55, 0x00, 0xfd, 0xfd, 0xc2, 0xfe, 0x93, 0x94, 0xa7, 0x55, 0xc1, 0x52,
+    0x51, 0x21, 0x56, 0x21, 0xfe, 0xbe, 0x1c, 0x0d, 0x6e, 0x7e, 0x1f, 0x27, 0x33, 0x6e, 0x7e, 0x05,
+    0xc3, 0x5a, 0x3d, 0xc0, 0x69, 0x66, 0xc0, 0x5a, 0xc0, 0xa3, 0x86, 0x31, 0xc0, 0x35, 0x3e, 0xa8,
+    0x22, 0x1f, 0xc0, 0x5a, 0x66, 0xc5, 0x01, 0xfe, 0xa4, 0x57, 0x15, 0x09, 0x66, 0x61, 0x66, 0x66,
+    0x1d, 0xc0, 0x18, 0x66, 0x55, 0x66, 0x66, 0xc0, 0xa6, 0x33, 0xfe, 0xa4, 0x17, 0x06, 0x5a, 0x69,
+    0x90, 0xdb, 0x97, 0xba, 0xc0, 0xa8, 0x55, 0x00, 0xfd, 0xfd, 0xc2, 0xb4, 0x13, 0xaf, 0x22, 0x7e,
+    0x19, 0xc0, 0x51, 0x52, 0x55, 0x56, 0xab, 0x01, 0xaa, 0x11, 0x12, 0x7e, 0x1f, 0x27, 0x6f, 0xa2,
+    0x66, 0xc0, 0x7e, 0xc2, 0x02, 0xc0, 0x3d, 0x36, 0xc0, 0x31, 0x5a, 0xc0, 0x66, 0xc0, 0x24, 0xa3,
+    0x76, 0x51, 0x9d, 0x9a, 0x97, 0xff, 0x65, 0xa9, 0x12, 0x10, 0x0b, 0xc2, 0x12, 0xc2, 0xfe, 0x9b,
+    0xf7, 0x01, 0xc0, 0x66, 0x2b, 0x26, 0x66, 0x65, 0xc0, 0x66, 0x04, 0x3f, 0x3a, 0xc0, 0x65, 0x18,
+    0x99, 0xbd, 0x95, 0xff, 0x66, 0xc0, 0x93, 0xca, 0x95, 0xba, 0xc0, 0x32, 0x5a, 0x00, 0xfd, 0xfd,
+    0xc1, 0xa6, 0x56, 0x35, 0xa5, 0x74, 0xc0, 0x66, 0x56, 0x55, 0x56, 0x38, 0x35, 0xab, 0x00, 0x12,
+    0x1a, 0x1f, 0x29, 0x7f, 0x6e, 0xc0, 0x02, 0x7a, 0xc0, 0x02, 0xc0, 0x3d, 0xc0, 0x36, 0xc0, 0x56,
+    0xc0, 0x29, 0xc0, 0x56, 0xc0, 0x66, 0xc0, 0x69, 0x66, 0x9c, 0xbb, 0x97, 0xff, 0xa7, 0x23, 0xa5,
+    0x44, 0x66, 0xc4, 0x66, 0xfe, 0x9c, 0x78, 0xa9, 0x22, 0xa3, 0x66, 0x2b, 0x26, 0x66, 0x65, 0x66,
+    0xc0, 0x04, 0x3f, 0xc0, 0x56, 0x65, 0x66, 0x10, 0x41, 0xfe, 0x8b, 0x14, 0xc1, 0x94, 0xca, 0x00,
+    0xc1, 0xa9, 0x55, 0x00, 0xfd, 0xfd, 0xc2, 0xad, 0x35, 0xb4, 0x11, 0xa3, 0x76, 0xc1, 0x19, 0x14,
+    0x05, 0xc0, 0x56, 0xa3, 0x66, 0x23, 0xa8, 0x22, 0x33, 0x38, 0x6e, 0x02, 0xc3, 0x3d, 0xc0, 0x36,
+    0x5a, 0x2e, 0xc0, 0x66, 0x5a, 0x66, 0xc0, 0x1c, 0x69, 0x56, 0xc0, 0x08, 0xaa, 0x51, 0x08, 0x97,
+    0xfe, 0x62, 0xa9, 0x02, 0xc3, 0x66, 0xc0, 0x98, 0xee, 0x61, 0xa8, 0x33, 0x23, 0x66, 0x65, 0x66,
+    0x66, 0x69, 0x66, 0x66, 0xc0, 0x2b, 0x66, 0xc0, 0x04, 0x12, 0xfe, 0x8a, 0xf4, 0x5a, 0xc0, 0x96,
+    0xba, 0x93, 0xc9, 0xc1, 0xaa, 0x44, 0x00, 0xe5, 0xa9, 0x44, 0xb0, 0x23, 0xfe, 0x08, 0x61, 0x00,
+    0xfd, 0xd7, 0xb0, 0x24, 0x05, 0xa3, 0x76, 0xc1, 0x26, 0xa7, 0x33, 0xa3, 0x56, 0x62, 0x08, 0x9b,
+    0xbb, 0x62, 0x0a, 0xa8, 0x22, 0x3d, 0x6e, 0xc3, 0x3d, 0xc0, 0x59, 0x66, 0xc0, 0x66, 0x5a, 0x66,
+    0xc0, 0x1c, 0x59, 0x66, 0x66, 0xc0, 0x03, 0xc0, 0x5a, 0x3b, 0x9d, 0xaa, 0x98, 0xfd, 0xa7, 0x24,
+    0x36, 0xc0, 0x66, 0xc1, 0x55, 0xfe, 0x94, 0x17, 0xfe, 0xb5, 0xbb, 0x66, 0x0f, 0x0a, 0x66, 0x3c,
+    0x66, 0xc0, 0x66, 0xc0, 0x65, 0x66, 0x5a, 0x3c, 0xa6, 0x34, 0x2f, 0xc0, 0x66, 0x98, 0xa9, 0x92,
+    0xc9, 0xc1, 0xaa, 0x45, 0x00, 0xe4, 0xa6, 0x56, 0xfe, 0xbc, 0xd8, 0x7f, 0xfe, 0x18, 0xa3, 0x00,
+    0xfd, 0xd8, 0xac, 0x35, 0xb3, 0x12, 0xa4, 0x86, 0xa2, 0x76, 0xfe, 0xee, 0xfd, 0xa7, 0x33, 0x24,
+    0xc0, 0x56, 0x65, 0x9b, 0xbc, 0x97, 0xee, 0x98, 0xee, 0xc0, 0xaa, 0x01, 0x38, 0xa2, 0x76, 0x02,
+    0xc0, 0x3d, 0x69, 0x56, 0xc0, 0x66, 0x5a, 0x66, 0xc0, 0x66, 0x12, 0x0d, 0x08, 0xc0, 0x56, 0xc0,
+    0x3b, 0x66, 0xc0, 0x5a, 0x65, 0x98, 0xee, 0xa3, 0x66, 0x27, 0x22, 0xc0, 0x6b, 0xc0, 0xfe, 0x8c,
+    0x17, 0xac, 0x00, 0x66, 0x0a, 0x66, 0x39, 0x66, 0x66, 0x66, 0x23, 0x1e, 0xc0, 0x66, 0xc0, 0xa4,
+    0x55, 0xa7, 0x23, 0xfe, 0x82, 0xf4, 0x66, 0xc0, 0x99, 0xa8, 0x91, 0xca, 0xc1, 0xab, 0x34, 0x00,
+    0xe4, 0xfe, 0x7b, 0x10, 0xaf, 0x22, 0x98, 0xbb, 0x00, 0xfd, 0xda, 0xa5, 0x67, 0xb3, 0x13, 0x14,
+    0xfe, 0xe6, 0xbd, 0xaa, 0x10, 0xc0, 0x2c, 0x5a, 0x24, 0xc0, 0x56, 0x69, 0x99, 0xde, 0x1f, 0x32,
+    0x1f, 0xaa, 0x01, 0xa3, 0x66, 0x3d, 0xc0, 0x2e, 0xc0, 0x66, 0x21, 0xc0, 0x66, 0x12, 0x0d, 0x08,
+    0x5a, 0x66, 0x3b, 0x69, 0x56, 0xc0, 0x27, 0xc0, 0x22, 0x10, 0xa3, 0x76, 0xfe, 0xad, 0x5a, 0xa3,
+    0x46, 0xc1, 0x66, 0x98, 0xed, 0xa4, 0x56, 0x07, 0x66, 0x65, 0x66, 0x66, 0x65, 0x66, 0xc0, 0x16,
+    0xc0, 0x11, 0x69, 0xa3, 0x66, 0xa8, 0x23, 0xfe, 0x8b, 0x34, 0x9c, 0xbb, 0x5a, 0x9a, 0xa9, 0x91,
+    0xc9, 0xc1, 0xa8, 0x55, 0x9a, 0xaa, 0x00, 0xe2, 0xa3, 0x67, 0xfe, 0xbc, 0xb8, 0x6e, 0x1a, 0x00,
+    0xfd, 0xdc, 0xab, 0x45, 0xb2, 0x13, 0xfe, 0xd6, 0x3c, 0xab, 0x10, 0xa2, 0x76, 0x6e, 0x2c, 0xc0,
+    0x5a, 0x24, 0xc0, 0x56, 0x55, 0x97, 0xff, 0xfe, 0xc5, 0x19, 0xa4, 0x45, 0xaa, 0x01, 0x3d, 0x65,
+    0x2e, 0x66, 0x21, 0x66, 0x59, 0x66, 0x08, 0x05, 0x66, 0x3b, 0x59, 0x66, 0x66, 0xc0, 0x56, 0xc1,
+    0xfe, 0xef, 0x9f, 0xa3, 0x75, 0xfe, 0xb5, 0xdb, 0x96, 0xef, 0xa7, 0x33, 0x6b, 0xc0, 0x51, 0x98,
+    0xee, 0xa8, 0x32, 0x66, 0x65, 0x62, 0x65, 0x66, 0x16, 0x11, 0x0a, 0x66, 0xc1, 0xa3, 0x66, 0xa8,
+    0x13, 0xfe, 0x8b, 0x35, 0x1b, 0xc0, 0x9a, 0xaa, 0x91, 0xc8, 0xc1, 0x6f, 0xa7, 0x65, 0x00, 0xe2,
+    0xfe, 0x6a, 0xce, 0x23, 0xfe, 0x31, 0x67, 0x00, 0xfd, 0xdf, 0x04, 0xfe, 0x8b, 0xd4, 0xfe, 0xce,
+    0x1b, 0xaa, 0x21, 0xa3, 0x66, 0x6e, 0x7a, 0x29, 0x24, 0xc0, 0x1c, 0xc0, 0x65, 0x99, 0xdd, 0xfe,
+    0xc5, 0x3a, 0xa3, 0x55, 0xaa, 0x01, 0xa2, 0x66, 0x56, 0x66, 0x56, 0x0d, 0x08, 0x66, 0x5a, 0x3b,
+    0x55, 0xc0, 0x66, 0x5a, 0x1f, 0xc0, 0x66, 0xc1, 0x22, 0x9d, 0x9a, 0x66, 0x12, 0xa4, 0x56, 0x01,
+    0x3c, 0x97, 0xee, 0x37, 0x65, 0x72, 0x18, 0x13, 0x66, 0x69, 0x66, 0x66, 0xc2, 0xa4, 0x55, 0xa7,
+    0x33, 0xfe, 0x8b, 0x35, 0x9b, 0xbb, 0xc0, 0x9b, 0x99, 0x91, 0xc8, 0xc2, 0xaa, 0x44, 0x00, 0xe1,
+    0xac, 0x34, 0xb3, 0x11, 0xfe, 0x20, 0xc4, 0x00, 0xfd, 0xe2, 0xa7, 0x66, 0xaf, 0x13, 0xfe, 0xbd,
+    0x59, 0xac, 0x00, 0xa6, 0x44, 0x7a, 0x6e, 0xc0, 0x1f, 0x1c, 0x69, 0x10, 0x56, 0x99, 0xed, 0xfe,
+    0xc5, 0x19, 0xa5, 0x35, 0xaa, 0x00, 0x66, 0x56, 0x17, 0x55, 0x66, 0x3b, 0x66, 0x59, 0x66, 0x56,
+    0xc0, 0x1a, 0xc0, 0x56, 0x65, 0xc0, 0x01, 0x5a, 0x66, 0xc0, 0xa0, 0xa8, 0x41, 0x6f, 0x99, 0xdd,
+    0xa4, 0x65, 0x7e, 0x0f, 0x99, 0xcd, 0x62, 0x65, 0x66, 0x66, 0xc0, 0x69, 0x7a, 0xc0, 0xa4, 0x56,
+    0xa6, 0x34, 0xfe, 0x83, 0x15, 0x9c, 0xba, 0xc0, 0x9c, 0x98, 0x00, 0xc2, 0xa9, 0x55, 0x00, 0xe0,
+    0xb0, 0x22, 0xa2, 0x77, 0x00, 0xd5, 0x0c, 0xa4, 0x66, 0xa2, 0x87, 0xa2, 0x78, 0x7f, 0xa2, 0x68,
+    0x7a, 0x6f, 0xc0, 0x6b, 0xc0, 0x56, 0x55, 0x66, 0x65, 0x55, 0x55, 0x55, 0x65, 0x51, 0x64, 0x55,
+    0x00, 0xf7, 0x0c, 0x09, 0xb1, 0x01, 0xfe, 0xcd, 0xfb, 0xa8, 0x32, 0xa5, 0x55, 0xc1, 0x55, 0xc0,
+    0x66, 0x56, 0xc0, 0x98, 0xee, 0x97, 0xee, 0x38, 0xa5, 0x45, 0x56, 0x55, 0x56, 0x56, 0x65, 0x27,
+    0x66, 0x5a, 0x66, 0x55, 0xc0, 0x06, 0x3e, 0xc0, 0x39, 0xc0, 0x66, 0xc0, 0xfe, 0xd6, 0xdd, 0xfe,
+    0x8c, 0xb9, 0xc1, 0x99, 0xed, 0xa9, 0x22, 0xfe, 0xff, 0xff, 0xfe, 0xb5, 0x5a, 0x97, 0xde, 0x62,
+    0xc0, 0x65, 0x76, 0xc2, 0xa5, 0x44, 0xa6, 0x45, 0xfe, 0x82, 0xd4, 0x9d, 0x9a, 0xc0, 0x9d, 0x98,
+    0x90, 0xc8, 0xc2, 0xa9, 0x45, 0x00, 0xde, 0xa5, 0x66, 0xae, 0x23, 0x93, 0xed, 0x00, 0xce, 0xa3,
+    0x77, 0xa5, 0x66, 0xa5, 0x66, 0xa5, 0x67, 0xa5, 0x66, 0xa4, 0x77, 0xa3, 0x77, 0xa3, 0x68, 0x7f,
+    0x66, 0x02, 0x66, 0xc0, 0x56, 0xc1, 0x56, 0xc0, 0x56, 0xc0, 0x65, 0x5a, 0x66, 0x5a, 0x66, 0x5a,
+    0x65, 0x56, 0xc0, 0x56, 0x51, 0x40, 0x9d, 0xa8, 0x9c, 0xa9, 0x9d, 0x98, 0x9c, 0xa9, 0x9d, 0xa7,
+    0x00, 0xe6, 0xa4, 0x66, 0xa6, 0x56, 0xa3, 0x87, 0xa4, 0x77, 0xa4, 0x66, 0xa4, 0x77, 0xa4, 0x66,
+    0xa4, 0x66, 0xa3, 0x77, 0xa2, 0x78, 0x6e, 0xc0, 0x45, 0x6e, 0xa5, 0x66, 0x66, 0xa3, 0x76, 0xa6,
+    0x43, 0xa7, 0x23, 0xc0, 0x66, 0x56, 0xc0, 0x66, 0x55, 0x97, 0xff, 0x9b, 0xbb, 0xa9, 0x12, 0x6e,
+    0x56, 0x56, 0x55, 0x56, 0x66, 0x56, 0x65, 0x56, 0xc0, 0x56, 0x39, 0x34, 0xc0, 0x55, 0xc0, 0x66,
+    0xc1, 0x52, 0x7a, 0x97, 0xee, 0xa8, 0x33, 0xa3, 0x75, 0x3c, 0x52, 0x75, 0x66, 0x66, 0xc2, 0x7a,
+    0x3d, 0xa6, 0x34, 0xfe, 0x7a, 0x93, 0x56, 0xc0, 0x9c, 0xa9, 0x00, 0xc2, 0x37, 0x51, 0x00, 0xdc,
+    0xae, 0x23, 0x65, 0x00, 0xca, 0x7f, 0xa7, 0x55, 0xa7, 0x66, 0xa7, 0x56, 0xa7, 0x55, 0xa5, 0x77,
+    0xa2, 0x77, 0xc1, 0x56, 0xc1, 0x66, 0x5a, 0xc2, 0x66, 0xc0, 0x5a, 0x3d, 0xc1, 0x5a, 0xc0, 0x35,
+    0xc1, 0x5a, 0x66, 0xc1, 0x5a, 0xc0, 0x66, 0x5a, 0x65, 0xc0, 0x56, 0x56, 0x55, 0x56, 0x51, 0x9c,
+    0xaa, 0x9a, 0xb9, 0x9a, 0xa8, 0x9b, 0xb7, 0x00, 0xde, 0xa2, 0x67, 0xb1, 0x00, 0xac, 0x44, 0xa7,
+    0x66, 0xa1, 0x99, 0x66, 0xc0, 0xa2, 0x76, 0xa9, 0x11, 0xa7, 0x33, 0xa5, 0x44, 0xa2, 0x77, 0xc0,
+    0x66, 0x66, 0x51, 0x56, 0x3a, 0x52, 0x9d, 0xaa, 0x9d, 0xaa, 0x9a, 0xcc, 0x9b, 0xbc, 0xa4, 0x65,
+    0xa9, 0x12, 0xa6, 0x44, 0xc0, 0x69, 0x56, 0x66, 0x52, 0x96, 0xff, 0x6e, 0xa7, 0x23, 0x56, 0x65,
+    0x56, 0x52, 0x56, 0x69, 0x56, 0x66, 0x39, 0x34, 0x55, 0xc0, 0x20, 0xc0, 0x56, 0xc0, 0x66, 0xc0,
+    0x61, 0x9b, 0xcc, 0xc0, 0xa4, 0x65, 0x61, 0x65, 0x66, 0x66, 0x65, 0xc0, 0x66, 0x7a, 0x6e, 0xa4,
+    0x56, 0xa5, 0x45, 0xfe, 0x72, 0x73, 0x66, 0xc0, 0x9d, 0x88, 0x91, 0xc7, 0xc3, 0xaa, 0x44, 0x00,
+    0xda, 0x1a, 0xa4, 0x67, 0x96, 0xcb, 0x00, 0xc7, 0xa6, 0x66, 0xa9, 0x55, 0xa9, 0x44, 0xa7, 0x66,
+    0xa6, 0x66, 0x6b, 0x29, 0xc0, 0x66, 0x56, 0xc0, 0x56, 0x69, 0x66, 0x5a, 0xc4, 0xa2, 0x67, 0x6e,
+    0x16, 0x51, 0x3d, 0x5a, 0xc0, 0x35, 0xc1, 0x5a, 0xc0, 0x66, 0xc1, 0x5a, 0xc0, 0x66, 0xc0, 0x59,
+    0x22, 0x66, 0x69, 0xc0, 0x5a, 0xc0, 0x66, 0x56, 0x56, 0x51, 0x9d, 0x9a, 0x9b, 0x98, 0x99, 0xc7,
+    0x99, 0xc9, 0x00, 0xda, 0xad, 0x33, 0xfe, 0xac, 0x77, 0xa2, 0x88, 0xc0, 0x30, 0xc0, 0xa2, 0x66,
+    0xfe, 0xd6, 0x39, 0xfe, 0xe7, 0x7a, 0x6e, 0x69, 0x36, 0xc0, 0xa1, 0x89, 0x7f, 0x6b, 0x7f, 0xc6,
+    0x9a, 0xcd, 0x96, 0xef, 0x96, 0xff, 0xa3, 0x66, 0x3b, 0xa6, 0x34, 0x66, 0x66, 0x5a, 0x33, 0x98,
+    0xde, 0xa8, 0x22, 0x5b, 0x55, 0x66, 0x56, 0x55, 0x01, 0x66, 0x56, 0x65, 0x56, 0xc0, 0x56, 0x66,
+    0xc0, 0x65, 0xc0, 0x66, 0xc0, 0x52, 0x97, 0xfd, 0xa9, 0x22, 0x62, 0x16, 0x66, 0x65, 0xc0, 0x76,
+    0xc1, 0x6e, 0xa4, 0x66, 0xa4, 0x45, 0xfe, 0x72, 0x52, 0x6b, 0x59, 0x9d, 0x98, 0x00, 0xc3, 0xac,
+    0x33, 0x00, 0xd8, 0xa6, 0x55, 0x2e, 0x98, 0xbb, 0x00, 0xc5, 0xa3, 0x77, 0xaa, 0x55, 0xab, 0x44,
+    0xab, 0x43, 0xa3, 0x77, 0x6b, 0xc0, 0x59, 0x29, 0x24, 0x1c, 0x3a, 0xa4, 0x55, 0xc0, 0x96, 0xff,
+    0x56, 0x66, 0xc0, 0x59, 0xc1, 0xa8, 0x22, 0xfe, 0xd6, 0x9c, 0xa5, 0x54, 0x6f, 0x6e, 0xc0, 0x08,
+    0x98, 0xdd, 0xfe, 0x9c, 0x37, 0x51, 0xc2, 0x66, 0x5a, 0xc0, 0x1e, 0xc1, 0x5a, 0xc0, 0x66, 0xc3,
+    0x5a, 0x66, 0xc3, 0x5a, 0x66, 0x3e, 0x9d, 0x9a, 0x9d, 0x99, 0x98, 0xc8, 0x97, 0xd8, 0x50, 0xd6,
+    0xae, 0x23, 0xb1, 0x23, 0xa5, 0x67, 0x7e, 0xc2, 0x7a, 0xfe, 0xd6, 0xb9, 0xa6, 0x32, 0xc3, 0x6b,
+    0x6b, 0x7a, 0x6f, 0x7f, 0x6b, 0x7f, 0xc1, 0x7e, 0xc3, 0x2c, 0x98, 0xde, 0xfe, 0xbd, 0x39, 0x98,
+    0xee, 0x01, 0xa9, 0x22, 0x6f, 0x0c, 0x56, 0x96, 0xff, 0xa2, 0x67, 0xa5, 0x44, 0x56, 0x56, 0x55,
+    0x62, 0x56, 0x55, 0x56, 0x66, 0xc0, 0x56, 0x07, 0x66, 0x5a, 0x66, 0xc1, 0x66, 0x97, 0xfd, 0xa5,
+    0x45, 0x7e, 0x0e, 0x75, 0x66, 0x65, 0xc2, 0x03, 0xa4, 0x55, 0xa2, 0x67, 0xfe, 0x6a, 0x52, 0xc0,
+    0x66, 0x9d, 0x88, 0x92, 0xc7, 0xc3, 0xae, 0x33, 0x00, 0xd6, 0xa7, 0x56, 0x7e, 0x14, 0x00, 0xc4,
+    0xa6, 0x66, 0xaa, 0x56, 0xab, 0x44, 0xa7, 0x65, 0x1c, 0x24, 0x6e, 0x6e, 0x29, 0xc0, 0xa4, 0x55,
+    0xa3, 0x66, 0xa4, 0x55, 0xa4, 0x55, 0xc2, 0x97, 0xef, 0xfe, 0xa3, 0xd6, 0xc2, 0xa7, 0x33, 0xab,
+    0x00, 0xa7, 0x32, 0x6b, 0x6e, 0x6e, 0x34, 0x55, 0x66, 0x9d, 0xaa, 0xfe, 0xa4, 0xb8, 0x9a, 0xbc,
+    0x66, 0xc3, 0x56, 0xc1, 0x16, 0xc1, 0x0e, 0x69, 0xc0, 0x0e, 0x07, 0x0e, 0xc0, 0x66, 0x0e, 0xc0,
+    0x0b, 0xc2, 0x56, 0x56, 0x22, 0x9d, 0x9a, 0x99, 0xb8, 0x97, 0xd7, 0x00, 0xd3, 0xae, 0x34, 0xfe,
+    0xb4, 0x98, 0xc1, 0x7f, 0xc2, 0x30, 0xa5, 0x33, 0xfe, 0xd7, 0x7a, 0xc2, 0x66, 0x6b, 0x7a, 0x6f,
+    0xc0, 0x6b, 0x7f, 0x7a, 0x6f, 0xc0, 0x7a, 0x6e, 0xc0, 0x7a, 0x31, 0xc2, 0x9d, 0xab, 0x33, 0xfe,
+    0xa4, 0x37, 0xa3, 0x66, 0x33, 0x04, 0x66, 0x9b, 0xbb, 0x9c, 0xab, 0xa6, 0x34, 0x62, 0x55, 0x56,
+    0x37, 0x55, 0x66, 0x56, 0x55, 0x66, 0x66, 0x56, 0xc0, 0x35, 0x5a, 0x66, 0xc0, 0x9d, 0xa9, 0x99,
+    0xed, 0xfe, 0xe7, 0x1d, 0x0a, 0xfe, 0x7b, 0x35, 0x65, 0x66, 0x66, 0xc0, 0x7a, 0xa2, 0x66, 0xa4,
+    0x56, 0xc0, 0x95, 0xff, 0xc1, 0x9c, 0x98, 0x00, 0xc3, 0xaf, 0x23, 0x14, 0x00, 0xd2, 0x14, 0xa8,
+    0x55, 0x56, 0x98, 0xba, 0x00, 0xc3, 0xa3, 0x77, 0xac, 0x45, 0xab, 0x55, 0xa5, 0x67, 0x7e, 0x6e,
+    0x10, 0x6f, 0x6e, 0x7a, 0x10, 0x61, 0x56, 0xa9, 0x21, 0xa8, 0x33, 0x3e, 0xc0, 0x6e, 0xc0, 0x6e,
+    0xfe, 0xbc, 0xf8, 0x96, 0xef, 0xc0, 0xa7, 0x33, 0xfe, 0xce, 0x1a, 0x6f, 0x9c, 0xbb, 0x5a, 0xc0,
+    0x69, 0x56, 0x6e, 0xa2, 0x77, 0xa2, 0x66, 0xc0, 0x52, 0x9c, 0xbb, 0x98, 0xde, 0x9b, 0xbb, 0xc0,
+    0x66, 0xc1, 0x66, 0xc1, 0x56, 0xc1, 0x66, 0xc6, 0x5a, 0xc0, 0x6b, 0xa5, 0x64, 0x06, 0xc1, 0x56,
+    0x56, 0x41, 0x9d, 0x9a, 0x98, 0xc8, 0x96, 0xe7, 0x00, 0xd1, 0xfe, 0x83, 0x52, 0x1e, 0xc1, 0x6b,
+    0x7e, 0xc2, 0x7a, 0xfe, 0xd7, 0x1a, 0xa2, 0x66, 0xc0, 0x6b, 0xc1, 0x6b, 0xc0, 0x6b, 0x6e, 0x7b,
+    0xc0, 0x7f, 0xc0, 0x7a, 0x6e, 0xc0, 0x7a, 0x29, 0xc0, 0x7a, 0x6e, 0xc1, 0x29, 0x96, 0xff, 0xfe,
+    0xac, 0x98, 0x9d, 0xaa, 0xaa, 0x11, 0xa3, 0x66, 0x56, 0x12, 0x5a, 0x56, 0x66, 0x56, 0x51, 0x56,
+    0x56, 0x65, 0x56, 0x56, 0x35, 0x65, 0x5a, 0x66, 0xc0, 0x66, 0xc0, 0x96, 0xfe, 0x07, 0x98, 0xdd,
+    0xfe, 0x72, 0xf4, 0x66, 0x69, 0x76, 0xc1, 0xa2, 0x77, 0xa4, 0x56, 0x51, 0x98, 0xdd, 0x66, 0xc0,
+    0x9c, 0x87, 0x94, 0xb7, 0xc3, 0xac, 0x33, 0x9b, 0xaa, 0x00, 0xd0, 0xa9, 0x44, 0x2e, 0x9d, 0x9a,
+    0x00, 0xc4, 0xa9, 0x56, 0xab, 0x56, 0xa8, 0x56, 0x7e, 0x7e, 0x6f, 0x6e, 0x7e, 0xc1, 0x65, 0x61,
+    0x66, 0x66, 0xc0, 0x5a, 0x10, 0xa6, 0x44, 0x6e, 0x55, 0x9c, 0xbb, 0x9b, 0xbc, 0x51, 0x5a, 0x6e,
+    0xa3, 0x66, 0xa8, 0x22, 0xa7, 0x33, 0xa5, 0x45, 0xa2, 0x76, 0xc0, 0x6e, 0x6e, 0xc0, 0x6e, 0x6b,
+    0xc0, 0x6e, 0xc1, 0x9b, 0xbb, 0xfe, 0xad, 0x79, 0xfe, 0x8b, 0xf6, 0x51, 0x66, 0xc1, 0x56, 0xc1,
+    0x66, 0xc1, 0x66, 0xc3, 0x5a, 0xc0, 0x0e, 0xfe, 0xde, 0x7c, 0xa8, 0x32, 0x9a, 0xbc, 0xfe, 0x7b,
+    0xb6, 0x9d, 0x9b, 0xc0, 0x66, 0x36, 0x55, 0x9d, 0x9b, 0x9c, 0xa8, 0x93, 0xf8, 0x9d, 0xa7, 0xcf,
+    0xa5, 0x66, 0xfe, 0xac, 0x78, 0xfe, 0xc5, 0xfb, 0x9a, 0xdc, 0x9b, 0xcc, 0xc0, 0x7f, 0xc2, 0x7a,
+    0xfe, 0xcf, 0x1b, 0xa2, 0x76, 0xc0, 0x5a, 0x6b, 0xc1, 0x3b, 0x66, 0x3b, 0x6b, 0xc0, 0x7b, 0x6e,
+    0xc0, 0x7e, 0xc1, 0x7e, 0xc0, 0x7a, 0x6e, 0xc0, 0x2c, 0x6e, 0x2c, 0x29, 0x98, 0xde, 0xfe, 0xa4,
+    0x37, 0x52, 0xab, 0x00, 0xa2, 0x77, 0x55, 0x62, 0x56, 0x55, 0x56, 0x66, 0x55, 0x52, 0x56, 0x56,
+    0x65, 0x56, 0xc0, 0x66, 0x5a, 0x66, 0xc0, 0x9b, 0xcb, 0x9d, 0xb9, 0xa4, 0x56, 0x71, 0x65, 0x66,
+    0xc2, 0xa2, 0x77, 0xa4, 0x55, 0x27, 0x9a, 0xbc, 0xc1, 0x9b, 0x97, 0x00, 0xc3, 0xa9, 0x55, 0xa2,
+    0x77, 0x00, 0xcd, 0xa6, 0x66, 0x3d, 0x55, 0x97, 0xbc, 0x00, 0xc3, 0x0c, 0xaa, 0x66, 0xad, 0x35,
+    0xa3, 0x87, 0x6e, 0x7f, 0xc0, 0x6e, 0x7e, 0xc1, 0x66, 0x61, 0x65, 0xc1, 0x1e, 0xc1, 0x6e, 0xc1,
+    0x5a, 0xc0, 0x6e, 0xc0, 0xa2, 0x67, 0xfe, 0xc5, 0x99, 0xa9, 0x12, 0x6e, 0xc0, 0x6e, 0xc0, 0x6e,
+    0x6e, 0xc0, 0x3b, 0xc1, 0x6e, 0xc1, 0x3b, 0xc1, 0x9d, 0xaa, 0xfe, 0x94, 0x56, 0x9a, 0xcd, 0xc0,
+    0x66, 0xc0, 0x07, 0x66, 0xc1, 0x66, 0xc3, 0x66, 0xc0, 0x5a, 0xfe, 0xb5, 0x39, 0xfe, 0xf7, 0x3d,
+    0xc0, 0x6f, 0x96, 0xdf, 0xfe, 0x6b, 0x36, 0xc1, 0x5a, 0x66, 0x56, 0x51, 0x9d, 0x89, 0xfe, 0x10,
+    0xa6, 0x9b, 0xb7, 0xce, 0xfe, 0x7b, 0x52, 0xad, 0x22, 0xfe, 0xd7, 0x5e, 0x61, 0xfe, 0xb4, 0x98,
+    0xc0, 0x6b, 0x7e, 0xc1, 0x6e, 0xfe, 0xcf, 0x5c, 0xc2, 0x66, 0xc0, 0x6b, 0xc1, 0x6b, 0xc1, 0x6b,
+    0x7e, 0xc1, 0x11, 0xc1, 0x7e, 0xc0, 0x7e, 0xc0, 0x7e, 0xc3, 0x21, 0xfe, 0xce, 0x3b, 0xfe, 0x93,
+    0xb6, 0xa2, 0x77, 0xa9, 0x22, 0x6e, 0x56, 0x51, 0x66, 0x56, 0x55, 0x56, 0x66, 0x55, 0x52, 0x5a,
+    0x66, 0x14, 0x65, 0xc0, 0x56, 0x3b, 0x97, 0xfd, 0xa6, 0x54, 0x66, 0x65, 0x66, 0xc0, 0x7a, 0xc0,
+    0xa2, 0x76, 0xa4, 0x56, 0x0e, 0x9c, 0xab, 0xc1, 0x9a, 0x97, 0x97, 0xa6, 0xc3, 0xa8, 0x55, 0xa7,
+    0x55, 0x00, 0xca, 0x06, 0xa4, 0x66, 0xc0, 0x9a, 0xaa, 0x00, 0xc4, 0x7f, 0xab, 0x46, 0xab, 0x56,
+    0xa3, 0x77, 0xc0, 0x7e, 0x18, 0x1f, 0x27, 0x6e, 0xc0, 0x65, 0x62, 0x65, 0x66, 0x0a, 0x12, 0x6f,
+    0x23, 0xc2, 0x6e, 0xc0, 0x5a, 0x2c, 0xc1, 0xfe, 0xcd, 0xfa, 0xa6, 0x34, 0x6e, 0xc0, 0x6e, 0x2a,
+    0xc0, 0x2f, 0x6f, 0xc1, 0x6e, 0xc3, 0x3b, 0xc2, 0x97, 0xff, 0xfe, 0x83, 0x95, 0xc0, 0x66, 0xc0,
+    0x07, 0x66, 0xc1, 0x66, 0xc1, 0x66, 0x69, 0x38, 0xc0, 0x5a, 0xfe, 0xe6, 0x9c, 0xa3, 0x76, 0x6e,
+    0x6e, 0x6b, 0xfe, 0x83, 0xb7, 0x9c, 0x9a, 0x3e, 0x5a, 0x36, 0xc0, 0x56, 0x51, 0x9d, 0x9a, 0x94,
+    0xe8, 0x9a, 0xc6, 0xcb, 0xa2, 0x77, 0xb3, 0x03, 0xb1, 0x01, 0xfe, 0xcf, 0x1e, 0xa3, 0x65, 0x66,
+    0xfe, 0xb4, 0xd9, 0x61, 0xc0, 0x7f, 0xc1, 0xa7, 0x22, 0xfe, 0xcf, 0x5c, 0xc0, 0x66, 0x5a, 0x67,
+    0xc2, 0x6b, 0xc2, 0x7b, 0xc0, 0x01, 0xc0, 0x7a, 0x6e, 0xc1, 0x11, 0xc1, 0x19, 0x7e, 0xc0, 0x7e,
+    0xc0, 0x66, 0x56, 0x55, 0xfe, 0xb5, 0x39, 0xfe, 0x83, 0x14, 0xa8, 0x33, 0xa6, 0x44, 0x5a, 0x66,
+    0x51, 0x56, 0x66, 0x55, 0x56, 0x56, 0x66, 0x55, 0x56, 0x66, 0x5a, 0x3b, 0x66, 0x9c, 0xb9, 0x61,
+    0xa2, 0x87, 0x66, 0x65, 0xc2, 0xa2, 0x77, 0xa3, 0x67, 0x9a, 0xcb, 0x51, 0xc0, 0x6b, 0x99, 0x97,
+    0x98, 0xa6, 0xc3, 0xa8, 0x55, 0xa8, 0x56, 0x00, 0xc7, 0x06, 0xa5, 0x56, 0x65, 0x99, 0xab, 0x00,
+    0xc6, 0xab, 0x57, 0xab, 0x56, 0xa2, 0x77, 0x6e, 0x7f, 0xc0, 0x6e, 0x7a, 0x18, 0xc0, 0x13, 0x65,
+    0x62, 0x7a, 0xc0, 0x05, 0x6e, 0x12, 0x6f, 0x6e, 0x28, 0xc0, 0x6b, 0xc1, 0x6e, 0xc0, 0x5a, 0xc0,
+    0xa7, 0x33, 0xfe, 0xd6, 0xdc, 0x7e, 0x2a, 0xc0, 0x6f, 0xc0, 0x6e, 0x6e, 0xc6, 0x3b, 0xc0, 0x7a,
+    0xc0, 0xfe, 0xb5, 0xba, 0x0f, 0xc1, 0x66, 0xc0, 0x56, 0xc1, 0x66, 0xc0, 0x66, 0x69, 0xc1, 0x5a,
+    0xa4, 0x76, 0xfe, 0xf6, 0xdc, 0x6b, 0x6e, 0x6e, 0x6e, 0xfe, 0xad, 0x19, 0xfe, 0x6b, 0x15, 0xc0,
+    0x5b, 0xc1, 0x5a, 0x66, 0x51, 0x9d, 0x8a, 0x94, 0xf7, 0x9a, 0xc7, 0xc8, 0x14, 0xfe, 0x7c, 0x11,
+    0xa8, 0x68, 0x67, 0x35, 0xa2, 0x67, 0xc0, 0x9d, 0xba, 0xfe, 0xb4, 0x98, 0xc1, 0x6b, 0x7e, 0xc0,
+    0xa3, 0x55, 0xa4, 0x55, 0x6e, 0xa2, 0x67, 0xa2, 0x66, 0x6f, 0xa2, 0x66, 0xa2, 0x67, 0x6f, 0x5a,
+    0xc0, 0x2d, 0xc2, 0x6e, 0x7b, 0xc1, 0x01, 0x7a, 0x09, 0xc1, 0x11, 0xc0, 0x7e, 0xc0, 0x7e, 0xc0,
+    0x1c, 0x59, 0x62, 0x9a, 0xbc, 0xfe, 0x93, 0xf6, 0x99, 0xdd, 0xa9, 0x22, 0xa3, 0x66, 0x52, 0x56,
+    0x65, 0x56, 0x56, 0x22, 0x55, 0x5a, 0x66, 0x56, 0x56, 0x65, 0x66, 0x66, 0x99, 0xdb, 0xfe, 0x8b,
+    0xf6, 0x96, 0xff, 0x9c, 0xab, 0x69, 0x76, 0x6f, 0xa2, 0x76, 0xa3, 0x67, 0x26, 0x66, 0x5e, 0xc0,
+    0x98, 0xb8, 0x00, 0xc3, 0xaa, 0x44, 0xa7, 0x66, 0x00, 0xc4, 0xa5, 0x66, 0xab, 0x44, 0x55, 0x97,
+    0xbc, 0x00, 0xc7, 0xa9, 0x57, 0xab, 0x57, 0xa3, 0x77, 0x7a, 0x6e, 0x6e, 0x7b, 0x6e, 0x6e, 0x7a,
+    0x6e, 0x7e, 0xa2, 0x77, 0xa2, 0x76, 0xa2, 0x77, 0x7f, 0x69, 0x15, 0x9c, 0xbb, 0x9d, 0xaa, 0x6e,
+    0x7e, 0x6b, 0x37, 0x34, 0xc3, 0x6e, 0x56, 0x6e, 0xa3, 0x66, 0xa7, 0x33, 0xa4, 0x55, 0xa2, 0x66,
+    0x6f, 0x6e, 0xa2, 0x77, 0x6e, 0x55, 0x66, 0x3f, 0x5a, 0x09, 0xa3, 0x66, 0xa2, 0x77, 0x6e, 0x36,
+    0x18, 0x96, 0xef, 0xfe, 0x8b, 0xb6, 0x55, 0xc1, 0x0a, 0xc0, 0x5a, 0x66, 0xc0, 0x66, 0xc0, 0x65,
+    0xc1, 0x66, 0x5a, 0xa5, 0x64, 0xfe, 0xf6, 0xbc, 0x6e, 0x6b, 0x6e, 0x6e, 0x99, 0xbd, 0xfe, 0x6b,
+    0x15, 0x5a, 0xc0, 0x6b, 0x5a, 0xc1, 0x66, 0x41, 0x9c, 0xaa, 0x93, 0xf6, 0x9c, 0xb8, 0xc7, 0xfe,
+    0x8c, 0x94, 0xa1, 0xac, 0xa8, 0x22, 0xfe, 0xcf, 0x3f, 0x6e, 0xc0, 0x2d, 0xfe, 0xb5, 0x1a, 0x9c,
+    0xba, 0x7a, 0xc1, 0x7f, 0xc0, 0xa6, 0x23, 0xa3, 0x66, 0xc0, 0x66, 0x1a, 0x62, 0x61, 0x72, 0x6e,
+    0x10, 0x26, 0xa3, 0x56, 0xa4, 0x35, 0xa2, 0x67, 0xc0, 0x7e, 0xc1, 0x6e, 0x35, 0x01, 0xc0, 0x7e,
+    0xc0, 0x7a, 0x11, 0xc2, 0x19, 0x1c, 0x0d, 0x08, 0x56, 0x55, 0xfe, 0xad, 0x19, 0xfe, 0x7a, 0xb4,
+    0xa5, 0x44, 0xa7, 0x44, 0x56, 0x65, 0x56, 0x56, 0x65, 0x56, 0x56, 0xc0, 0x55, 0x66, 0x56, 0xc0,
+    0x55, 0x9b, 0xdb, 0xfe, 0x9c, 0x36, 0xfe, 0x72, 0xd3, 0x9a, 0xcb, 0x66, 0xc0, 0x7e, 0xa2, 0x67,
+    0xa2, 0x77, 0x9a, 0xbd, 0xc2, 0x98, 0xa7, 0x9a, 0x96, 0xc3, 0xad, 0x33, 0xa2, 0x88, 0x00, 0xc2,
+    0xa6, 0x66, 0xb0, 0x22, 0x9b, 0xaa, 0x91, 0xdd, 0x00, 0xc7, 0xa6, 0x67, 0xac, 0x57, 0xa3, 0x88,
+    0x6f, 0x6e, 0xc0, 0x7e, 0x6e, 0x0b, 0xa8, 0x32, 0xa6, 0x44, 0xa3, 0x76, 0x7a, 0x65, 0xc0, 0x1b,
+    0x6e, 0x6e, 0x7e, 0x6e, 0x6f, 0x51, 0x98, 0xee, 0x99, 0xdd, 0xc1, 0x6e, 0xc1, 0x39, 0xc1, 0x5a,
+    0xc1, 0x6f, 0xab, 0x00, 0xa9, 0x21, 0xa4, 0x55, 0xa3, 0x66, 0xa3, 0x86, 0x9d, 0x7a, 0x69, 0xc0,
+    0x66, 0x12, 0x39, 0x99, 0xcd, 0x99, 0xdd, 0x99, 0xcd, 0x9a, 0xcd, 0xc0, 0x66, 0x5a, 0x69, 0x66,
+    0xc0, 0x66, 0xc1, 0x05, 0x56, 0xc0, 0x65, 0xc1, 0x66, 0xc1, 0x29, 0x2a, 0xa7, 0x53, 0x6e, 0x5f,
+    0xc1, 0xfe, 0x6b, 0x15, 0x5a, 0xc1, 0x57, 0x6e, 0x2e, 0xc0, 0x55, 0x52, 0x9c, 0x99, 0xfe, 0x00,
+    0x21, 0x00, 0xc5, 0xfe, 0x52, 0x6d, 0xae, 0x35, 0x6e, 0xa8, 0x22, 0xa4, 0x55, 0x66, 0x9c, 0xbb,
+    0x9b, 0xdb, 0x66, 0xc0, 0x7e, 0xc1, 0xa4, 0x56, 0xfe, 0xbe, 0xbd, 0xa4, 0x65, 0xa4, 0x85, 0x9a,
+    0x8d, 0xc1, 0x66, 0xc0, 0x66, 0x61, 0x9f, 0xb8, 0x9c, 0xab, 0x9d, 0xca, 0x61, 0x62, 0x15, 0xa4,
+    0x36, 0xa5, 0x35, 0xa3, 0x65, 0x6e, 0x7a, 0xc0, 0x6e, 0x7f, 0xc1, 0x7e, 0xc3, 0x7a, 0x69, 0x66,
+    0x56, 0x56, 0x51, 0x99, 0xdd, 0xfe, 0x8b, 0x75, 0x9a, 0xcc, 0xa7, 0x34, 0xa2, 0x77, 0x56, 0x55,
+    0x66, 0x56, 0x55, 0x66, 0x56, 0x65, 0x5a, 0x65, 0x55, 0x61, 0x9b, 0xcc, 0xa2, 0x76, 0x69, 0x76,
+    0x6e, 0x6b, 0xa2, 0x76, 0x6b, 0x9c, 0xac, 0x6e, 0xc1, 0x98, 0x96, 0x9a, 0xa7, 0xc3, 0xb1, 0x22,
+    0x9a, 0xaa, 0x00, 0xc0, 0xa3, 0x77, 0xb2, 0x12, 0xc0, 0x8f, 0xed, 0x00, 0xc7, 0xa3, 0x78, 0xab,
+    0x58, 0xa6, 0x77, 0x6e, 0xc0, 0x7f, 0x6e, 0xc0, 0xa6, 0x44, 0xaa, 0x21, 0xa7, 0x43, 0x61, 0x9d,
+    0xba, 0x66, 0x07, 0x6e, 0x7f, 0x6e, 0x6e, 0x6e, 0x7f, 0x3e, 0x6e, 0xc0, 0x7f, 0x2a, 0xfe, 0xbc,
+    0x57, 0x3c, 0xc0, 0x6f, 0xc2, 0x5a, 0xc1, 0x5a, 0xc0, 0xfe, 0xc5, 0xda, 0xfe, 0xe7, 0x7e, 0xc0,
+    0x6e, 0x7e, 0x46, 0xc1, 0x65, 0x12, 0xc0, 0x03, 0xc1, 0xa0, 0xa9, 0x96, 0xdf, 0x96, 0xef, 0x97,
+    0xef, 0x56, 0x66, 0x69, 0xc0, 0x0a, 0xc0, 0x66, 0x56, 0x69, 0x31, 0xc0, 0x66, 0xc2, 0x29, 0xa5,
+    0x65, 0xfe, 0xee, 0x7c, 0xa3, 0x55, 0x6b, 0x6e, 0x6e, 0xfe, 0x73, 0x76, 0x9d, 0x9a, 0xc0, 0x56,
+    0xc0, 0x6b, 0xc1, 0x5a, 0x51, 0x51, 0x98, 0xc9, 0x00, 0xc4, 0xa6, 0x56, 0xfe, 0x94, 0x38, 0xa9,
+    0x21, 0x99, 0xde, 0x65, 0xc0, 0x7a, 0x6e, 0x7a, 0xc1, 0xa2, 0x77, 0xa8, 0x02, 0xa6, 0x34, 0xa5,
+    0x34, 0xc1, 0x66, 0xc0, 0x56, 0xc0, 0x66, 0xc0, 0x66, 0xa2, 0x76, 0xa4, 0x85, 0x18, 0xc2, 0x9c,
+    0xda, 0x9c, 0xcb, 0x9a, 0xec, 0xc0, 0xa7, 0x13, 0xa9, 0x02, 0xa2, 0x76, 0x6e, 0x7f, 0xc1, 0x7e,
+    0xc3, 0x65, 0xc1, 0x66, 0x51, 0x56, 0x62, 0x55, 0xfe, 0x9c, 0x98, 0xfe, 0x72, 0x73, 0xa4, 0x55,
+    0x19, 0x56, 0x66, 0x3d, 0x56, 0x65, 0x55, 0x66, 0x55, 0x65, 0x56, 0x61, 0x61, 0x56, 0x7d, 0x66,
+    0x09, 0x7f, 0x7e, 0x5b, 0x9d, 0xac, 0xc1, 0x6e, 0x97, 0xa6, 0x9b, 0x97, 0xc1, 0xa4, 0x77, 0x55,
+    0xb3, 0x11, 0x8c, 0xff, 0x00, 0xa8, 0x55, 0xb4, 0x01, 0x8f, 0xfe, 0x00, 0xc7, 0x6f, 0xaa, 0x68,
+    0x0e, 0x7e, 0xc0, 0x6e, 0xc0, 0x7f, 0xa8, 0x32, 0xfe, 0xbd, 0x7a, 0xa4, 0x65, 0x9c, 0xbb, 0x9c,
+    0xcb, 0xc1, 0x7e, 0x6e, 0x7f, 0x6e, 0x6e, 0xa2, 0x66, 0x7f, 0x3e, 0x6e, 0x7f, 0xc0, 0x6e, 0x6e,
+    0x51, 0xfe, 0xbc, 0x57, 0x66, 0x5a, 0xc0, 0x6e, 0xc1, 0x5a, 0xc2, 0xfe, 0xde, 0xdc, 0xa6, 0x34,
+    0xc7, 0x56, 0x69, 0xc1, 0xa1, 0x98, 0x03, 0xc0, 0x62, 0xfe, 0xbd, 0xba, 0xfe, 0x8b, 0xf6, 0x9d,
+    0xab, 0x69, 0x66, 0xc0, 0x66, 0x66, 0x36, 0x31, 0xc0, 0x2c, 0xc2, 0x5a, 0xc0, 0xa6, 0x54, 0x17,
+    0x30, 0x6e, 0x6e, 0xfe, 0x7b, 0xb6, 0x9a, 0xbd, 0xc0, 0x27, 0xc1, 0x2e, 0xc1, 0x55, 0x52, 0x41,
+    0xfe, 0x08, 0x84, 0x9c, 0xb8, 0xc3, 0xab, 0x35, 0xfe, 0x94, 0x38, 0xfe, 0xc6, 0x7d, 0x6e, 0xfe,
+    0x9c, 0x58, 0xc0, 0x7a, 0xc0, 0x13, 0x7a, 0xc0, 0xfe, 0xb5, 0xbc, 0xfe, 0xbf, 0x1f, 0xc1, 0x65,
+    0xc0, 0x5a, 0x22, 0xc0, 0x1d, 0xc0, 0x66, 0xc0, 0x5a, 0x66, 0xc1, 0x18, 0xc1, 0x25, 0xa6, 0x83,
+    0x98, 0xae, 0x9a, 0xec, 0x34, 0x66, 0xa9, 0x01, 0xa9, 0x12, 0xa2, 0x77, 0xc0, 0x7e, 0xc3, 0x65,
+    0xc0, 0x66, 0x38, 0x65, 0x56, 0x17, 0x61, 0x56, 0x99, 0xdd, 0xfe, 0x7a, 0xf4, 0x9c, 0xbb, 0xa6,
+    0x34, 0x7a, 0x56, 0x2c, 0x55, 0x65, 0x56, 0x51, 0x65, 0x21, 0x65, 0x65, 0x52, 0x04, 0x69, 0x04,
+    0x7e, 0xa2, 0x67, 0x67, 0x52, 0x19, 0xc0, 0x5a, 0x97, 0xa6, 0x9c, 0x96, 0xa3, 0x77, 0xad, 0x44,
+    0x7f, 0x3e, 0xa2, 0x77, 0x99, 0xaa, 0x9a, 0xaa, 0xb4, 0x11, 0x37, 0x00, 0xc7, 0xa6, 0x79, 0xaa,
+    0x58, 0xa2, 0x88, 0x0e, 0xc0, 0x7e, 0x6e, 0xa8, 0x33, 0xac, 0x00, 0x26, 0x9d, 0xba, 0x9c, 0xbb,
+    0x65, 0x7e, 0x6b, 0x6e, 0x02, 0xa2, 0x66, 0x6f, 0x20, 0x6e, 0x7f, 0x6e, 0xa2, 0x66, 0x7f, 0x6e,
+    0xc0, 0x6e, 0x6f, 0x30, 0x9c, 0xaa, 0xfe, 0xbc, 0x77, 0x66, 0xc1, 0x5e, 0xc0, 0x66, 0x5a, 0xc1,
+    0xaa, 0x11, 0xfe, 0xef, 0x9e, 0x6e, 0xc0, 0x5a, 0x66, 0xc5, 0x66, 0xc1, 0x69, 0xc1, 0xa3, 0x77,
+    0x61, 0xfe, 0xac, 0xf9, 0xfe, 0x83, 0x96, 0x65, 0xc0, 0x66, 0x66, 0x55, 0xc0, 0x2c, 0xc2, 0x56,
+    0x6e, 0xc0, 0xa6, 0x54, 0xa8, 0x42, 0xa7, 0x43, 0xab, 0x20, 0x5a, 0xfe, 0x6b, 0x55, 0x9d, 0xab,
+    0x5a, 0xc2, 0x6b, 0xc1, 0x5a, 0x51, 0x51, 0x97, 0xd8, 0x96, 0xe7, 0xc3, 0xae, 0x14, 0xb3, 0x03,
+    0xfe, 0xce, 0xdd, 0x6f, 0xfe, 0xad, 0x3a, 0x99, 0xdd, 0xc0, 0x7a, 0x13, 0xc0, 0x7a, 0xfe, 0xb6,
+    0x1c, 0xa7, 0x24, 0x5a, 0xc1, 0x22, 0xc0, 0x66, 0xc1, 0x56, 0xc0, 0x66, 0xc4, 0x7e, 0xc0, 0x1d,
+    0x7e, 0xc0, 0x7e, 0x6e, 0x30, 0xfe, 0xc5, 0xdb, 0x96, 0xff, 0xa5, 0x45, 0x24, 0xa5, 0x55, 0xc2,
+    0x66, 0x69, 0xc0, 0x56, 0x62, 0x65, 0x56, 0x56, 0x51, 0x62, 0x55, 0x9d, 0xab, 0xfe, 0x83, 0x55,
+    0x97, 0xee, 0xa4, 0x55, 0x2c, 0x65, 0x55, 0x66, 0x55, 0x65, 0x55, 0x66, 0x55, 0x66, 0x65, 0x53,
+    0x7d, 0x3d, 0x6e, 0x7f, 0x57, 0x53, 0x6b, 0x6e, 0xc0, 0x96, 0xa5, 0x00, 0x3e, 0x9d, 0xaa, 0x9d,
+    0x99, 0x55, 0xa2, 0x87, 0x3e, 0xa7, 0x56, 0x8e, 0xed, 0x00, 0xc6, 0xa2, 0x78, 0xaa, 0x69, 0x3a,
+    0x6f, 0x7a, 0x6e, 0xc0, 0xa4, 0x65, 0xfe, 0xac, 0xb9, 0xa6, 0x44, 0x61, 0x9c, 0xba, 0x62, 0x6e,
+    0x26, 0x6e, 0x7f, 0x6e, 0x6e, 0x7f, 0x6e, 0xa2, 0x76, 0x6f, 0x7e, 0x6e, 0x6f, 0x7e, 0x6e, 0x1c,
+    0x6e, 0x7f, 0x35, 0x6e, 0x9a, 0xcd, 0xfe, 0xbc, 0x78, 0xc3, 0x19, 0xc1, 0x5a, 0x66, 0xa6, 0x43,
+    0xfe, 0xde, 0xdd, 0xa7, 0x32, 0xc2, 0x66, 0x5a, 0xc5, 0x0d, 0xc1, 0x15, 0xc0, 0x51, 0xfe, 0xbd,
+    0x9a, 0xfe, 0x83, 0x96, 0x65, 0x05, 0x66, 0x55, 0xc0, 0x2c, 0xc1, 0x66, 0x5a, 0x29, 0xc0, 0xa7,
+    0x53, 0xfe, 0xee, 0xbc, 0xfe, 0xb5, 0x39, 0xfe, 0x83, 0xd6, 0xa3, 0x66, 0xfe, 0x62, 0xf5, 0x5a,
+    0xc3, 0x6b, 0xc1, 0x5a, 0x55, 0x52, 0x9b, 0xb8, 0xfe, 0x00, 0x00, 0xc2, 0xa2, 0x77, 0xfe, 0x84,
+    0x15, 0xa9, 0x34, 0xfe, 0xce, 0xfe, 0x55, 0xfe, 0xad, 0x5a, 0x97, 0xff, 0x0b, 0x7a, 0xc0, 0x6e,
+    0x7a, 0xfe, 0xb6, 0x9e, 0xa2, 0x67, 0xc2, 0x69, 0x66, 0xc0, 0x56, 0xc1, 0x66, 0xc5, 0x18, 0xc0,
+    0x1d, 0x7e, 0xc0, 0x2d, 0x6e, 0xa2, 0x87, 0x7e, 0x45, 0x1f, 0xfe, 0xb5, 0x5a, 0x3e, 0xaa, 0x11,
+    0x11, 0xc0, 0x65, 0xc0, 0x66, 0x56, 0x66, 0x55, 0x1f, 0x51, 0x03, 0x62, 0x55, 0x52, 0x62, 0x95,
+    0xff, 0xfe, 0x6a, 0x32, 0xc0, 0xa4, 0x54, 0xc0, 0x65, 0x55, 0x65, 0x56, 0x61, 0x56, 0x69, 0x3d,
+    0x56, 0x66, 0x7d, 0x3d, 0x7e, 0x9f, 0x8b, 0x57, 0xc0, 0x6b, 0xc0, 0x96, 0x94, 0x7d, 0xac, 0x55,
+    0x9a, 0xba, 0x9d, 0x9a, 0xc0, 0xa3, 0x66, 0xa4, 0x76, 0xa5, 0x67, 0x40, 0x90, 0xdd, 0xc5, 0xa6,
+    0x79, 0xaa, 0x58, 0x3a, 0xc0, 0x6f, 0x7a, 0x6e, 0xa9, 0x22, 0xac, 0x10, 0xc0, 0x9d, 0xa9, 0x9d,
+    0xba, 0xc0, 0x7f, 0x6e, 0x7e, 0x6e, 0x7f, 0x6e, 0x04, 0xa2, 0x77, 0x6e, 0x7e, 0x6f, 0xa2, 0x76,
+    0x6e, 0x6f, 0x7e, 0x6e, 0x6e, 0x7f, 0x6e, 0x6e, 0x6e, 0x7f, 0x21, 0xfe, 0xc4, 0xf9, 0x9d, 0xaa,
+    0xc0, 0x66, 0x19, 0xc2, 0x16, 0x66, 0xc0, 0xa2, 0x66, 0xa6, 0x44, 0xa5, 0x54, 0xa5, 0x44, 0xa5,
+    0x54, 0xa4, 0x55, 0xc0, 0x66, 0xc2, 0x12, 0xc1, 0x66, 0xc2, 0x01, 0xfe, 0xb5, 0x59, 0xfe, 0x83,
+    0x75, 0x66, 0x66, 0x65, 0x2c, 0xc1, 0x66, 0xc0, 0x5a, 0xc0, 0x6e, 0xa5, 0x55, 0xfe, 0xee, 0xbc,
+    0x5f, 0xfe, 0x9c, 0xb8, 0xfe, 0x62, 0xf5, 0xc0, 0x5a, 0xc4, 0x2e, 0x6e, 0xfe, 0x9d, 0x1a, 0xa3,
+    0x75, 0xfe, 0x42, 0x95, 0x9a, 0xc8, 0xfe, 0x00, 0x00, 0xc1, 0xa6, 0x45, 0xfe, 0xa5, 0x77, 0xfe,
+    0x9c, 0xb9, 0xfe, 0xc6, 0xbd, 0x66, 0xc0, 0xfe, 0xa4, 0xb9, 0x9c, 0xbb, 0x6e, 0xc0, 0x7a, 0x6e,
+    0xa4, 0x56, 0xfe, 0xb6, 0x9e, 0x6e, 0xc3, 0x5a, 0x66, 0xc1, 0x10, 0xc6, 0x18, 0x1d, 0xc0, 0x7e,
+    0x6e, 0x7a, 0x32, 0xc0, 0x7e, 0x6e, 0x7b, 0xa2, 0x86, 0xa3, 0x85, 0xfe, 0xde, 0x9c, 0x97, 0xdf,
+    0xa8, 0x22, 0xa7, 0x33, 0xc0, 0x66, 0x56, 0x66, 0x55, 0x17, 0x65, 0x52, 0x56, 0x61, 0x56, 0x52,
+    0x61, 0x9c, 0xab, 0xfe, 0x72, 0xb4, 0x9a, 0xcc, 0xa2, 0x75, 0xa2, 0x65, 0x66, 0x65, 0x55, 0x66,
+    0x59, 0x02, 0x65, 0x56, 0x67, 0x2e, 0x36, 0x02, 0x67, 0x9f, 0x8b, 0xc0, 0x6b, 0xc0, 0x94, 0xa4,
+    0x69, 0xab, 0x55, 0x9c, 0xaa, 0x9d, 0xaa, 0x6e, 0xa3, 0x77, 0xa4, 0x66, 0xa5, 0x66, 0xa5, 0x66,
+    0x8e, 0xee, 0x00, 0xc2, 0xa1, 0x89, 0xaa, 0x69, 0xa5, 0x68, 0xc0, 0x7e, 0xc0, 0x6e, 0x7f, 0xfe,
+    0x9c, 0x17, 0xa6, 0x44, 0x1b, 0x9d, 0xaa, 0x66, 0x7e, 0xc0, 0xa2, 0x77, 0x6e, 0x26, 0x6f, 0x6e,
+    0xa2, 0x76, 0x6f, 0x7e, 0x6e, 0xa2, 0x77, 0x6e, 0x7e, 0x6f, 0x7e, 0xa2, 0x66, 0x6e, 0x7f, 0x35,
+    0x6e, 0x6b, 0x7e, 0x6e, 0x6e, 0xc0, 0xfe, 0xd5, 0xba, 0x97, 0xef, 0xc1, 0x1e, 0xc0, 0x19, 0xc0,
+    0x5a, 0x66, 0xc0, 0x69, 0x5a, 0x02, 0xc0, 0x1b, 0xa9, 0x21, 0xa9, 0x22, 0xa6, 0x43, 0x6e, 0x15,
+    0xc4, 0x66, 0x5a, 0x66, 0x3c, 0xfe, 0x94, 0x17, 0x9a, 0xcc, 0x66, 0x65, 0x56, 0x66, 0xc2, 0x5a,
+    0xc0, 0x29, 0x6e, 0xfe, 0xe6, 0xbc, 0xa2, 0x67, 0x2a, 0xfe, 0x6b, 0x55, 0x9d, 0x9b, 0xc5, 0x6b,
+    0xfe, 0xbe, 0x1c, 0xfe, 0xff, 0xff, 0xfe, 0x8c, 0x99, 0x0f, 0xfe, 0x18, 0xe8, 0x99, 0xc7, 0xc1,
+    0xfe, 0x9d, 0x57, 0x9e, 0xad, 0x17, 0xc0, 0x66, 0x99, 0xdd, 0xfe, 0x94, 0x38, 0x7a, 0xc0, 0x6e,
+    0x7a, 0xc0, 0xfe, 0xb5, 0xdc, 0xa5, 0x44, 0xc0, 0x6f, 0x5a, 0x6e, 0xc1, 0x18, 0x5a, 0xc1, 0x66,
+    0xc2, 0x15, 0x18, 0xc0, 0x1d, 0xc0, 0x7e, 0xc0, 0x6e, 0x7e, 0xc0, 0x7e, 0xc0, 0x6e, 0x7a, 0xa2,
+    0x87, 0x31, 0x56, 0x9d, 0x8b, 0x9b, 0xcb, 0x9b, 0xbc, 0xa3, 0x66, 0xa5, 0x54, 0x38, 0x66, 0x55,
+    0x1a, 0x51, 0x56, 0x56, 0x61, 0x52, 0x56, 0x61, 0x52, 0x51, 0x97, 0xee, 0xfe, 0x62, 0x32, 0x61,
+    0xa2, 0x65, 0x79, 0x55, 0xc0, 0x65, 0x56, 0x65, 0x5a, 0x66, 0x67, 0x2e, 0x36, 0x6b, 0x9e, 0x9d,
+    0xc0, 0x6f, 0x50, 0x96, 0x93, 0xc0, 0xa7, 0x77, 0x51, 0x61, 0xa2, 0x77, 0xa4, 0x56, 0xa4, 0x77,
+    0xa5, 0x55, 0xa5, 0x66, 0x90, 0xdd, 0x00, 0xc1, 0xa6, 0x69, 0xa8, 0x79, 0xa1, 0x89, 0x6e, 0xc0,
+    0x7e, 0xc0, 0xa5, 0x55, 0xab, 0x11, 0x7e, 0x51, 0x9d, 0xba, 0xc0, 0xa2, 0x76, 0x6f, 0x7e, 0x6f,
+    0xa2, 0x76, 0x6e, 0x7f, 0x6e, 0x04, 0x6f, 0x7e, 0x6e, 0xa2, 0x77, 0x6e, 0x7e, 0xa2, 0x67, 0x7e,
+    0x1c, 0x28, 0x7e, 0x35, 0x6e, 0x7f, 0x6e, 0x6e, 0x6f, 0x7e, 0xc0, 0xfe, 0xde, 0x3b, 0xfe, 0xbc,
+    0x98, 0xc1, 0x1e, 0x66, 0xc1, 0x11, 0xc2, 0x07, 0x66, 0xc2, 0x6f, 0xa7, 0x32, 0xa8, 0x32, 0x08,
+    0xa3, 0x65, 0x66, 0xc2, 0x66, 0x66, 0x65, 0xfe, 0xcd, 0xfb, 0xfe, 0x83, 0x55, 0x65, 0x34, 0x56,
+    0x66, 0xc2, 0x5a, 0xc0, 0x6e, 0x5a, 0xfe, 0xb5, 0x59, 0xfe, 0xe6, 0xfd, 0x5e, 0xfe, 0x94, 0xb8,
+    0xfe, 0x5a, 0xf5, 0xc5, 0xa5, 0x55, 0xfe, 0xff, 0xff, 0xfe, 0xad, 0x9b, 0xfe, 0x4a, 0xb5, 0x97,
+    0xd8, 0x00, 0xc1, 0xa8, 0x34, 0xfe, 0x9d, 0x1a, 0xfe, 0xc6, 0xbd, 0x66, 0x66, 0x0c, 0xfe, 0x94,
+    0x38, 0xc1, 0x06, 0x6e, 0xc0, 0x7e, 0xa6, 0x34, 0x66, 0x7a, 0xc5, 0x7a, 0xc3, 0x7a, 0x6e, 0x6e,
+    0xc0, 0xa2, 0x67, 0xa2, 0x66, 0xa2, 0x67, 0xa2, 0x67, 0x17, 0xa3, 0x56, 0x6e, 0xc0, 0x7e, 0xc1,
+    0x6e, 0x7a, 0xa2, 0x77, 0x66, 0xc0, 0x69, 0xa2, 0x87, 0x9c, 0xbb, 0x9a, 0xbc, 0xa3, 0x66, 0x6f,
+    0x55, 0x62, 0x51, 0x56, 0x52, 0x55, 0x18, 0x51, 0x56, 0x62, 0x51, 0x52, 0x9d, 0xba, 0x96, 0xee,
+    0x98, 0xed, 0x6e, 0x7c, 0x64, 0x5a, 0x65, 0x66, 0xc0, 0x55, 0xc0, 0x9f, 0x9c, 0x2e, 0x36, 0x9e,
+    0x9e, 0x5a, 0x05, 0x9d, 0x76, 0x99, 0xa5, 0xa4, 0x77, 0xa1, 0x99, 0x51, 0xc0, 0xa3, 0x66, 0xa4,
+    0x77, 0xa4, 0x66, 0xa5, 0x66, 0xa4, 0x66, 0x8a, 0xff, 0x51, 0x0f, 0xa9, 0x6a, 0xa4, 0x79, 0x23,
+    0x7a, 0x6b, 0x6e, 0x7a, 0xa8, 0x33, 0xa7, 0x33, 0x66, 0x61, 0x65, 0x6e, 0x7f, 0x6e, 0x7f, 0xa2,
+    0x66, 0x7e, 0x6f, 0xa2, 0x76, 0x6f, 0x7e, 0xa2, 0x66, 0x7f, 0x6e, 0x7e, 0xa2, 0x77, 0x6e, 0xa2,
+    0x77, 0x6e, 0x7e, 0x6f, 0xa2, 0x66, 0x7e, 0x6e, 0x6f, 0x7e, 0x6e, 0xa2, 0x77, 0xa2, 0x66, 0x27,
+    0x6e, 0xfe, 0xde, 0x1b, 0xfe, 0xbc, 0x98, 0xc2, 0x19, 0xc1, 0x66, 0x5a, 0xc2, 0x65, 0x02, 0xc2,
+    0x6f, 0xa5, 0x54, 0x56, 0xa2, 0x76, 0xa7, 0x33, 0xaa, 0x20, 0xa3, 0x66, 0xc0, 0x66, 0x66, 0x3a,
+    0x62, 0xfe, 0x83, 0x55, 0x61, 0x66, 0x56, 0xc3, 0x5a, 0x6e, 0xc0, 0x5a, 0xa2, 0x77, 0xfe, 0xbd,
+    0xba, 0xab, 0x10, 0xfe, 0x7c, 0x17, 0x97, 0xdf, 0xc5, 0xa8, 0x43, 0xfe, 0xde, 0xfd, 0xfe, 0x52,
+    0xf6, 0xfe, 0x21, 0x08, 0x00, 0xc2, 0xfe, 0x5a, 0xf1, 0xaa, 0x35, 0xa4, 0x65, 0x7a, 0x9d, 0xaa,
+    0x52, 0x7e, 0xc1, 0x7a, 0xc0, 0x6e, 0x0e, 0x6e, 0x7f, 0x6e, 0x6e, 0x7e, 0x6f, 0x6e, 0x7e, 0xa2,
+    0x67, 0x6e, 0xa2, 0x76, 0x6f, 0x6e, 0x7a, 0xc1, 0x66, 0x56, 0x79, 0x66, 0x66, 0x1d, 0x66, 0x9d,
+    0xaa, 0x66, 0xc0, 0xa2, 0x57, 0xa3, 0x55, 0x30, 0xa4, 0x45, 0xa5, 0x45, 0xa3, 0x65, 0x7a, 0xc2,
+    0x66, 0x66, 0x7a, 0x9c, 0x9b, 0xc0, 0x66, 0x51, 0x56, 0x52, 0x51, 0x56, 0x62, 0x51, 0x52, 0x9b,
+    0xcb, 0x9c, 0xbb, 0x51, 0x51, 0x9b, 0xcc, 0x9a, 0xcb, 0x66, 0x6d, 0xa0, 0x85, 0x69, 0x66, 0x69,
+    0x56, 0xc1, 0x9f, 0x9c, 0x6d, 0x6b, 0x9f, 0x8b, 0xc0, 0x9c, 0x94, 0x68, 0x66, 0x51, 0x65, 0xa2,
+    0x67, 0xa4, 0x76, 0xa6, 0x56, 0xa4, 0x66, 0xa3, 0x77, 0x95, 0xbb, 0x95, 0xcc, 0xa5, 0x7a, 0xa8,
+    0x69, 0x1e, 0xc1, 0x7e, 0xc0, 0x7f, 0xa9, 0x22, 0xa3, 0x66, 0x65, 0x62, 0xc0, 0x6e, 0x7e, 0x6f,
+    0x7e, 0xa2, 0x66, 0x7f, 0x6e, 0xa2, 0x77, 0x6e, 0xa2, 0x77, 0x7e, 0xa2, 0x66, 0x7f, 0x6e, 0x7f,
+    0xa2, 0x66, 0x7e, 0xa2, 0x67, 0x7e, 0x6e, 0xa4, 0x55, 0x7e, 0x32, 0x7f, 0x6e, 0x7e, 0x6e, 0xa2,
+    0x77, 0x6e, 0x09, 0xfe, 0xd5, 0xba, 0x98, 0xee, 0xc0, 0x56, 0xc1, 0x66, 0x5a, 0xc0, 0x66, 0xc0,
+    0x11, 0x69, 0x66, 0xc0, 0x02, 0xc0, 0x3d, 0xc0, 0x32, 0xa6, 0x44, 0xc1, 0x9b, 0xbb, 0xfe, 0xc5,
+    0xdb, 0x9c, 0xab, 0xa8, 0x42, 0xa8, 0x32, 0x65, 0x3a, 0x61, 0xfe, 0x8b, 0x95, 0x9c, 0xbb, 0x66,
+    0x66, 0x5a, 0xc1, 0x5a, 0xc0, 0x6e, 0xc0, 0x5a, 0x6f, 0x5a, 0xc0, 0x56, 0xc1, 0x5a, 0xc0, 0x27,
+    0xc0, 0x6b, 0x6e, 0xfe, 0x9c, 0xfa, 0xfe, 0x39, 0xee, 0xfe, 0x00, 0x00, 0xc2, 0xa6, 0x56, 0xfe,
+    0x7b, 0xf8, 0xc0, 0x7a, 0x6e, 0x7a, 0xc1, 0x7e, 0xc0, 0xa4, 0x65, 0xa2, 0x77, 0x0a, 0xa2, 0x67,
+    0x6e, 0x6e, 0x7f, 0x6e, 0x3e, 0x6e, 0x7f, 0x6e, 0x6e, 0xa2, 0x76, 0x6f, 0x6e, 0x6e, 0xc0, 0x7a,
+    0xc1, 0x3a, 0xc0, 0x35, 0x3a, 0xc3, 0x35, 0x61, 0x9c, 0xbb, 0x9d, 0xba, 0x9b, 0xcc, 0x9c, 0xba,
+    0x52, 0xa3, 0x66, 0x30, 0xa8, 0x22, 0xa3, 0x66, 0xc0, 0x66, 0xa2, 0x76, 0x2c, 0x52, 0x66, 0x06,
+    0x39, 0x25, 0x52, 0x9d, 0xaa, 0x97, 0xee, 0x98, 0xee, 0x9a, 0xcc, 0x61, 0x5a, 0x66, 0xc0, 0x59,
+    0x1e, 0xc0, 0x56, 0xc0, 0x69, 0x68, 0x68, 0x65, 0xc2, 0x9f, 0x9c, 0x5b, 0x66, 0x9d, 0x94, 0x54,
+    0x66, 0x59, 0x66, 0xc0, 0x1a, 0xa4, 0x66, 0xa5, 0x55, 0x92, 0xdd, 0x55, 0x6f, 0xa8, 0x7b, 0xa4,
+    0x79, 0x7a, 0x1e, 0xc1, 0x7a, 0x32, 0xa8, 0x43, 0x6e, 0x65, 0x66, 0xc0, 0x34, 0x7f, 0x08, 0x7e,
+    0xa2, 0x67, 0x7e, 0xa2, 0x67, 0x7e, 0xa2, 0x67, 0x1b, 0xa2, 0x77, 0x6e, 0xa2, 0x76, 0x6f, 0x7e,
+    0xa2, 0x67, 0x7e, 0xa2, 0x66, 0x07, 0xa2, 0x76, 0xa5, 0x45, 0xa7, 0x42, 0xc0, 0x9b, 0xbc, 0x66,
+    0x0b, 0x7e, 0x6e, 0x99, 0xde, 0xfe, 0xd5, 0x7a, 0x9a, 0xcc, 0x6f, 0xa4, 0x55, 0xa4, 0x55, 0xa3,
+    0x66, 0xa2, 0x76, 0x6e, 0xc0, 0x14, 0x9d, 0xaa, 0x9b, 0xcc, 0x99, 0xcd, 0x9d, 0xaa, 0xc2, 0x02,
+    0xc0, 0x3d, 0xc0, 0xfe, 0xe7, 0x1d, 0xa5, 0x55, 0xc0, 0x65, 0xc1, 0x56, 0x97, 0xef, 0xfe, 0xac,
+    0xd9, 0x2e, 0xa9, 0x31, 0x1c, 0x00, 0x65, 0x66, 0x2a, 0x59, 0x6b, 0xc1, 0x5e, 0xc0, 0x5e, 0xc0,
+    0x6b, 0x5a, 0x5a, 0xc0, 0x66, 0xc0, 0x5a, 0x27, 0xc0, 0x6b, 0x6e, 0xc1, 0xfe, 0x10, 0xc5, 0x9a,
+    0xc9, 0xc2, 0xa7, 0x46, 0xfe, 0x7c, 0x38, 0xab, 0x30, 0x96, 0xef, 0x52, 0xc0, 0x7a, 0xc0, 0xa3,
+    0x65, 0xa8, 0x43, 0x6e, 0x16, 0xc0, 0x1b, 0xc0, 0x7e, 0x6e, 0x6f, 0x39, 0x6e, 0x7e, 0x12, 0xa2,
+    0x66, 0x7e, 0xa2, 0x67, 0x6e, 0xc0, 0x7e, 0xc0, 0x6e, 0x02, 0xc1, 0x66, 0x3a, 0xc0, 0x6e, 0x02,
+    0xc1, 0x3f, 0xc0, 0x02, 0xc2, 0x35, 0x06, 0x9a, 0xdc, 0x9d, 0xaa, 0xc0, 0x17, 0xa6, 0x44, 0xa3,
+    0x66, 0x52, 0x51, 0x34, 0x23, 0x9a, 0xbc, 0x98, 0xee, 0x51, 0xa2, 0x67, 0xa2, 0x77, 0xc1, 0x2f,
+    0x52, 0x51, 0x9d, 0xaa, 0x51, 0x9c, 0xbb, 0x9d, 0xaa, 0x51, 0x66, 0xc1, 0x69, 0xc0, 0x65, 0x5b,
+    0xc0, 0x36, 0x9c, 0x94, 0x1a, 0x66, 0xc0, 0x55, 0xc0, 0x6e, 0xa2, 0x88, 0xa4, 0x65, 0xa7, 0x45,
+    0x00, 0xa2, 0x89, 0xa9, 0x6b, 0x16, 0xc0, 0x19, 0xc1, 0x6e, 0xa2, 0x77, 0xa6, 0x54, 0xc0, 0x66,
+    0x69, 0xc0, 0x27, 0x7e, 0x6e, 0x7f, 0xa2, 0x66, 0x7f, 0xa2, 0x66, 0xa2, 0x77, 0x6e, 0xa2, 0x77,
+    0x7e, 0xa2, 0x67, 0x7e, 0xa2, 0x67, 0x7e, 0x17, 0x7f, 0xa2, 0x76, 0x6f, 0x0c, 0x6f, 0xa7, 0x42,
+    0xa5, 0x54, 0xc0, 0x9d, 0xaa, 0x9d, 0xab, 0x9c, 0xbb, 0x99, 0xdd, 0x9c, 0xbb, 0xa5, 0x44, 0xa5,
+    0x55, 0xa6, 0x43, 0xa4, 0x55, 0xc4, 0x66, 0xc1, 0x65, 0x0e, 0xfe, 0xd5, 0xba, 0xfe, 0xac, 0x37,
+    0xc0, 0x66, 0x5a, 0xc1, 0x66, 0xfe, 0xd6, 0x3c, 0x18, 0xc0, 0x66, 0xc0, 0x0b, 0x06, 0x69, 0x66,
+    0xfe, 0xcd, 0xba, 0xfe, 0xa4, 0x57, 0x9c, 0xbb, 0x9a, 0xbc, 0x2f, 0x66, 0x69, 0x20, 0x6b, 0xc0,
+    0x5e, 0xc1, 0x2b, 0x6b, 0x5a, 0xc0, 0x5a, 0xc1, 0x66, 0x5a, 0x27, 0x2c, 0xa5, 0x55, 0xa6, 0x63,
+    0x98, 0xcf, 0x9c, 0xab, 0xfe, 0x08, 0x42, 0x50, 0xc3, 0xfe, 0x6b, 0x95, 0xfe, 0xc6, 0xbd, 0x9d,
+    0xba, 0x0a, 0x9d, 0xab, 0x7a, 0xc1, 0xa5, 0x64, 0xa5, 0x54, 0xc1, 0x6e, 0x6b, 0xa2, 0x66, 0x7a,
+    0x6e, 0x6f, 0xa2, 0x66, 0x6e, 0x7f, 0x1c, 0x6e, 0xa2, 0x77, 0x6e, 0xc0, 0x7a, 0x6e, 0x6e, 0x7a,
+    0xc0, 0x07, 0x02, 0xc8, 0x07, 0x02, 0xc1, 0x5a, 0x3d, 0xc0, 0x66, 0x01, 0xfe, 0xac, 0xd9, 0x9b,
+    0xcb, 0x6e, 0xa2, 0x67, 0x66, 0xc0, 0x24, 0xa3, 0x66, 0x51, 0x24, 0x51, 0x56, 0x61, 0x56, 0x66,
+    0x51, 0x56, 0x66, 0x51, 0x56, 0x50, 0x9d, 0xaa, 0x9d, 0xba, 0x11, 0xc0, 0x56, 0xc1, 0x69, 0x9b,
+    0xa4, 0x15, 0x1a, 0x15, 0xc0, 0x69, 0x5a, 0x1a, 0xa2, 0x77, 0xa3, 0x77, 0xa7, 0x54, 0x94, 0xbe,
+    0x02, 0x7f, 0xc1, 0x6e, 0x79, 0x6b, 0xa3, 0x65, 0xa4, 0x65, 0xc0, 0x67, 0xc1, 0x6e, 0x7e, 0x6f,
+    0xa2, 0x76, 0x6f, 0xa2, 0x76, 0x6f, 0xa2, 0x76, 0x37, 0x7e, 0xa2, 0x77, 0x18, 0x2c, 0xa2, 0x66,
+    0x7f, 0x0f, 0x7f, 0x28, 0x7e, 0xa2, 0x77, 0x6e, 0xa2, 0x77, 0xa2, 0x76, 0xa6, 0x54, 0x9d, 0xaa,
+    0xfe, 0xcd, 0xbb, 0x9a, 0xdc, 0x29, 0xab, 0x00, 0xa4, 0x55, 0x7e, 0xc0, 0x6e, 0x7a, 0xc2, 0x66,
+    0xc1, 0x65, 0xfe, 0xe6, 0x5c, 0xfe, 0xbc, 0x78, 0x51, 0xc0, 0x5a, 0x66, 0xc1, 0x5a, 0x66, 0xc0,
+    0xab, 0x10, 0xfe, 0xf7, 0x7e, 0x66, 0xc0, 0x66, 0x59, 0x66, 0x66, 0xc0, 0x65, 0x9c, 0xbb, 0xfe,
+    0x9b, 0xd6, 0x34, 0x66, 0x66, 0x69, 0x5a, 0x6b, 0xc0, 0x5e, 0xfe, 0xb5, 0x19, 0xc0, 0x32, 0xc0,
+    0x5a, 0xc0, 0x5a, 0xc1, 0x66, 0xc0, 0x2c, 0xfe, 0x94, 0xb9, 0x24, 0x9c, 0xab, 0xfe, 0x9c, 0xd9,
+    0xfe, 0x4a, 0xb3, 0xfe, 0x00, 0x00, 0xc4, 0xaf, 0x04, 0xfe, 0xad, 0xdb, 0xa6, 0x54, 0x99, 0xdd,
+    0xfe, 0x84, 0x18, 0xc0, 0x3b, 0xc0, 0x7e, 0xa7, 0x43, 0x7e, 0xc0, 0x6e, 0x0f, 0x6f, 0x20, 0x28,
+    0x6f, 0x6e, 0xa2, 0x66, 0x7f, 0x17, 0xa2, 0x66, 0x7f, 0x6e, 0xc0, 0x6e, 0x7a, 0x6e, 0x7e, 0xc2,
+    0x5a, 0x02, 0xc1, 0x07, 0xc6, 0x02, 0x5a, 0x3a, 0x76, 0x65, 0x62, 0x1d, 0x51, 0x9b, 0xcc, 0x99,
+    0xcd, 0x7e, 0x05, 0x51, 0x2c, 0x18, 0x56, 0x66, 0x37, 0x66, 0x56, 0x55, 0x66, 0x56, 0x52, 0x65,
+    0x56, 0x60, 0x50, 0x65, 0x55, 0x52, 0x62, 0x56, 0x9f, 0x9b, 0x9c, 0xa4, 0x9e, 0x97, 0x1a, 0x7b,
+    0x1a, 0x15, 0xc1, 0x1a, 0xa2, 0x77, 0xa4, 0x66, 0xa6, 0x56, 0xfe, 0x49, 0x70, 0x11, 0xc0, 0x69,
+    0xc1, 0x7e, 0xa3, 0x65, 0xa2, 0x76, 0x67, 0xc0, 0x6b, 0x6e, 0x6e, 0x7f, 0x6e, 0x7f, 0x6e, 0xa2,
+    0x77, 0xa2, 0x66, 0x7f, 0xa2, 0x66, 0xa2, 0x77, 0x0b, 0x10, 0xa2, 0x77, 0x6e, 0xa2, 0x77, 0xa2,
+    0x66, 0x0f, 0x20, 0x28, 0xa2, 0x77, 0x6e, 0xa2, 0x76, 0x66, 0x9a, 0xcc, 0x99, 0xed, 0xc0, 0xaa,
+    0x11, 0xa9, 0x12, 0xa2, 0x76, 0x7e, 0x6f, 0xc0, 0x7a, 0x6e, 0xc1, 0x7a, 0xc1, 0x65, 0xc2, 0x9d,
+    0xab, 0xfe, 0xbc, 0xd8, 0x9a, 0xdd, 0xc0, 0x5a, 0xc1, 0x56, 0xc0, 0x66, 0x23, 0xfe, 0xf7, 0x5e,
+    0x65, 0xc0, 0x66, 0x56, 0xc0, 0x66, 0x65, 0x66, 0x66, 0x51, 0xfe, 0xac, 0x37, 0xfe, 0x82, 0xd4,
+    0x69, 0xc0, 0x5b, 0xc0, 0x2c, 0xa6, 0x44, 0xfe, 0xe6, 0xbc, 0x6f, 0xfe, 0x7b, 0xb6, 0x9c, 0xab,
+    0x2f, 0xc0, 0x5a, 0xc2, 0x66, 0x2c, 0x08, 0xa3, 0x76, 0xfe, 0x6b, 0x97, 0x97, 0xdb, 0xfe, 0x08,
+    0x42, 0x50, 0xc4, 0xa7, 0x46, 0xfe, 0x94, 0xfa, 0xfe, 0xc6, 0x9d, 0x39, 0xfe, 0x84, 0x38, 0x66,
+    0x7a, 0xc1, 0xa7, 0x52, 0x6f, 0xc0, 0x7e, 0x6e, 0x6e, 0x6f, 0x20, 0x28, 0x39, 0x6e, 0xa2, 0x76,
+    0x17, 0x6e, 0xa2, 0x76, 0x6b, 0x6e, 0xc0, 0x7e, 0x6e, 0x7e, 0xc6, 0x5a, 0x0a, 0x07, 0xc0, 0x6b,
+    0xc1, 0x07, 0x02, 0xc0, 0x56, 0x35, 0x71, 0x1d, 0x51, 0x97, 0xfe, 0x34, 0xa4, 0x55, 0x01, 0x34,
+    0x52, 0x55, 0x66, 0x56, 0x65, 0x56, 0x52, 0x1e, 0x56, 0x66, 0x56, 0x55, 0x66, 0x52, 0xa8, 0x41,
+    0xfe, 0xbd, 0xba, 0xfe, 0x62, 0x50, 0x55, 0x9d, 0xab, 0x63, 0x57, 0x9e, 0x97, 0x15, 0x7f, 0xc2,
+    0x59, 0x15, 0xc0, 0x1a, 0xa2, 0x77, 0xa4, 0x66, 0xa4, 0x68, 0xfe, 0x49, 0x70, 0x7a, 0xc0, 0x0a,
+    0xc0, 0x7d, 0xa3, 0x65, 0xc1, 0x67, 0x6e, 0x6b, 0x7f, 0x6e, 0x7f, 0x6e, 0xa2, 0x67, 0x7e, 0xa2,
+    0x67, 0xa2, 0x76, 0xa2, 0x67, 0x2a, 0x37, 0xfe, 0xc5, 0xdb, 0xc0, 0x97, 0xcf, 0xa2, 0x76, 0xa2,
+    0x67, 0x7e, 0xa2, 0x67, 0x20, 0x6f, 0x7e, 0x9a, 0xcc, 0x9a, 0xdc, 0x9d, 0xba, 0xa9, 0x12, 0xa9,
+    0x21, 0xa6, 0x34, 0x7a, 0x6e, 0x08, 0xc0, 0x6e, 0x10, 0x6f, 0x7a, 0xc0, 0x69, 0xc1, 0x7a, 0xc0,
+    0x66, 0xc2, 0xfe, 0xbc, 0x78, 0x03, 0xc0, 0x5a, 0x66, 0xc0, 0x59, 0x66, 0xc0, 0x6f, 0xfe, 0xf7,
+    0x1d, 0xc1, 0x56, 0x66, 0x69, 0x66, 0x66, 0x66, 0x65, 0x66, 0x62, 0x97, 0xce, 0xfe, 0x82, 0xd4,
+    0x69, 0x5b, 0x6e, 0xc0, 0x19, 0x2d, 0x5a, 0xfe, 0x73, 0x96, 0x9d, 0xaa, 0x56, 0xc0, 0x5a, 0xc3,
+    0xa3, 0x76, 0xfe, 0xf7, 0xdf, 0xfe, 0xc6, 0x3c, 0xfe, 0x5a, 0xf4, 0xfe, 0x00, 0x21, 0x65, 0xc5,
+    0xa7, 0x46, 0xfe, 0x7c, 0x58, 0x17, 0x39, 0xfe, 0x8c, 0x38, 0x56, 0xc0, 0x7a, 0xc0, 0xa6, 0x63,
+    0xc0, 0x6e, 0x6f, 0x05, 0x6e, 0x6e, 0x6f, 0x6e, 0x34, 0x3e, 0x6e, 0x7f, 0xc0, 0x01, 0x3c, 0x2b,
+    0x62, 0x65, 0x66, 0x15, 0x7e, 0x6f, 0x6e, 0xa2, 0x76, 0x6f, 0x6e, 0x6e, 0x6f, 0xa2, 0x66, 0xc0,
+    0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x02, 0xc0, 0x56, 0xc0, 0x27, 0x9b, 0xcc, 0xfe, 0xb4, 0xd9, 0xa6,
+    0x43, 0xc0, 0x9d, 0xab, 0x51, 0x62, 0x55, 0x52, 0x69, 0x56, 0x66, 0x32, 0x56, 0x1e, 0x56, 0x66,
+    0x56, 0x65, 0x56, 0x56, 0x60, 0xc0, 0x99, 0xdd, 0x56, 0x66, 0xc0, 0x56, 0x9b, 0xa4, 0x79, 0x6e,
+    0x6b, 0x29, 0x24, 0xc0, 0x55, 0x69, 0x6f, 0xa2, 0x77, 0xa4, 0x66, 0xa3, 0x7b, 0x9c, 0xad, 0xc0,
+    0x7a, 0x6d, 0xa2, 0x75, 0x7d, 0x6b, 0x66, 0xc0, 0x6b, 0x6f, 0x6e, 0x6f, 0x7f, 0x6f, 0x7e, 0xa2,
+    0x67, 0xa2, 0x66, 0xa2, 0x77, 0x7f, 0xa2, 0x66, 0xa2, 0x77, 0x00, 0xfe, 0xce, 0x5c, 0xc0, 0xfe,
+    0x9c, 0xd9, 0x6f, 0xa2, 0x76, 0xa2, 0x67, 0x3f, 0x9b, 0xcb, 0x9c, 0xbb, 0xc0, 0xa6, 0x44, 0xa8,
+    0x22, 0x17, 0x7a, 0xc0, 0x66, 0x22, 0xa8, 0x42, 0x9c, 0x9b, 0x7e, 0xc0, 0xa2, 0x77, 0x65, 0xc0,
+    0x6e, 0x18, 0xc1, 0x66, 0xc0, 0x7a, 0xc0, 0x66, 0xc0, 0xfe, 0xdd, 0xdb, 0xfe, 0xb4, 0x37, 0x66,
+    0x56, 0xc0, 0x69, 0x56, 0xc0, 0x66, 0xc0, 0xfe, 0xcd, 0x7a, 0xfe, 0xf6, 0xfd, 0xc0, 0x66, 0x55,
+    0xc0, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0x66, 0x9b, 0x9c, 0xfe, 0x8b, 0x14, 0x46, 0xc0, 0x6e,
+    0x35, 0xfe, 0x9c, 0x98, 0x41, 0x97, 0xdf, 0xc0, 0x5a, 0x66, 0x5a, 0xc3, 0x7f, 0x10, 0xfe, 0x9c,
+    0xf9, 0xfe, 0x39, 0xcc, 0x92, 0xfa, 0xc6, 0xab, 0x15, 0xfe, 0x74, 0x18, 0x12, 0x25, 0xfe, 0x7b,
+    0xf8, 0x7a, 0x6e, 0x7a, 0x7e, 0xa4, 0x75, 0xc0, 0x6e, 0x6e, 0x6f, 0x7e, 0x0f, 0x6f, 0x66, 0x65,
+    0x62, 0x61, 0x62, 0x69, 0xa3, 0x56, 0xa3, 0x66, 0xa3, 0x66, 0x01, 0xa3, 0x66, 0xa3, 0x66, 0xa2,
+    0x66, 0xa2, 0x76, 0xc0, 0x6b, 0xc6, 0x5a, 0xc3, 0x65, 0xc0, 0x5a, 0x66, 0xfe, 0xbd, 0x9a, 0x9c,
+    0xbb, 0xa9, 0x22, 0x9d, 0xaa, 0x9d, 0xba, 0x51, 0x2f, 0x51, 0x66, 0x56, 0x65, 0x56, 0x66, 0x5a,
+    0x66, 0x55, 0x56, 0x05, 0x31, 0xfe, 0x7b, 0x35, 0x52, 0x9b, 0xbb, 0x9c, 0xba, 0xc0, 0x56, 0xc1,
+    0x65, 0x40, 0x9c, 0xa4, 0x7f, 0x7b, 0xc1, 0x55, 0x1a, 0x65, 0x5a, 0x7e, 0xa2, 0x78, 0xa6, 0x55,
+    0x9f, 0x9f, 0x61, 0xa1, 0x74, 0x7e, 0xc1, 0x6b, 0xc1, 0x6b, 0xc0, 0x6f, 0x7f, 0x6f, 0xa2, 0x67,
+    0x7f, 0xa2, 0x66, 0xa2, 0x77, 0xa2, 0x67, 0xfe, 0xe7, 0x3e, 0xfe, 0xad, 0x19, 0xfe, 0x83, 0xd7,
+    0xa2, 0x66, 0x7f, 0xa2, 0x67, 0x7e, 0xc0, 0x51, 0x61, 0xc0, 0xa2, 0x77, 0xa6, 0x44, 0xa6, 0x34,
+    0xa2, 0x76, 0x7e, 0x6e, 0x12, 0x6e, 0x7e, 0x6e, 0x7a, 0x22, 0x9c, 0xbb, 0xc0, 0x75, 0xa8, 0x22,
+    0xa2, 0x67, 0x7a, 0x6e, 0xc0, 0x7a, 0xc2, 0x66, 0xc0, 0x7a, 0xc0, 0x65, 0x9d, 0xab, 0xfe, 0xd5,
+    0x7a, 0xfe, 0xb4, 0x17, 0x55, 0x66, 0x5a, 0x66, 0xc2, 0x06, 0x33, 0x65, 0x5a, 0x66, 0x66, 0x65,
+    0x09, 0x66, 0x66, 0x65, 0xc0, 0x3f, 0x98, 0xbd, 0xfe, 0x7a, 0xf4, 0x6e, 0x6b, 0x5e, 0xc0, 0x5a,
+    0xc0, 0x5a, 0xc0, 0x66, 0xc0, 0x5a, 0xc1, 0x7f, 0xc0, 0x20, 0xfe, 0x6b, 0x77, 0xfe, 0x29, 0x49,
+    0x96, 0xd9, 0xc6, 0xfe, 0x42, 0x8e, 0xae, 0x14, 0xfe, 0xbe, 0x1c, 0x97, 0xdf, 0x98, 0xce, 0x7a,
+    0x6e, 0xc0, 0xa1, 0x97, 0xa3, 0x76, 0x6e, 0x7a, 0x6e, 0x5a, 0x24, 0x1f, 0x61, 0xc0, 0x27, 0xa3,
+    0x66, 0xa4, 0x45, 0x39, 0x12, 0xc0, 0x17, 0xc0, 0x7e, 0x6e, 0x7f, 0x6e, 0xa2, 0x76, 0x6e, 0x6f,
+    0xc2, 0x66, 0xc1, 0x5a, 0xc4, 0x65, 0xc0, 0x9d, 0xaa, 0xfe, 0xb4, 0xf9, 0xa9, 0x11, 0xa4, 0x56,
+    0x9d, 0xba, 0x9d, 0xaa, 0x9d, 0xaa, 0x01, 0x9d, 0xab, 0x51, 0x66, 0x56, 0x65, 0x56, 0x66, 0x5a,
+    0x2d, 0x55, 0xc0, 0x04, 0x26, 0xfe, 0x6a, 0xb4, 0x9a, 0xdc, 0x5a, 0xa2, 0x76, 0x3c, 0x6d, 0x55,
+    0x65, 0x55, 0x99, 0xc9, 0x61, 0x7f, 0xc1, 0x56, 0x65, 0x55, 0x55, 0x69, 0x6f, 0xa3, 0x77, 0xa7,
+    0x57, 0x9c, 0xaf, 0x69, 0x79, 0x6e, 0x69, 0x79, 0xc0, 0x5a, 0x7b, 0x3d, 0x6b, 0x6f, 0x6f, 0xa8,
+    0x43, 0xfe, 0xa4, 0xb8, 0xfe, 0x62, 0x93, 0xa2, 0x77, 0x6f, 0x6e, 0xfe, 0xb5, 0x5a, 0xfe, 0x83,
+    0xf7, 0x9a, 0xbc, 0x32, 0x7e, 0xa2, 0x67, 0xa2, 0x76, 0xa3, 0x66, 0xa5, 0x55, 0xa4, 0x55, 0xa2,
+    0x67, 0x7e, 0x7e, 0x6f, 0x7e, 0x36, 0x3e, 0x6e, 0x7f, 0x17, 0x7e, 0x7e, 0x6e, 0x6f, 0x7a, 0xc0,
+    0x9b, 0xcb, 0x9b, 0xcc, 0x65, 0xa4, 0x55, 0xa7, 0x33, 0xa2, 0x77, 0x7a, 0xc3, 0x66, 0x69, 0xc1,
+    0x66, 0x9b, 0xcc, 0xfe, 0xb4, 0x37, 0x9d, 0xaa, 0x5a, 0x66, 0xc0, 0x66, 0x5a, 0x27, 0xfe, 0xdd,
+    0xfb, 0xa6, 0x53, 0x56, 0x1a, 0x65, 0x66, 0x66, 0x66, 0x65, 0xc0, 0x6e, 0x04, 0x96, 0xcf, 0xfe,
+    0x7b, 0x14, 0x6b, 0x6e, 0x3a, 0x6e, 0x5a, 0xc0, 0x66, 0x5a, 0xc0, 0x66, 0xc1, 0x6f, 0x7e, 0x66,
+    0xc0, 0x3b, 0xfe, 0x18, 0xe6, 0x99, 0xc9, 0xc5, 0xa3, 0x67, 0xfe, 0x6b, 0xf7, 0xa7, 0x53, 0xa6,
+    0x64, 0xfe, 0x7c, 0x18, 0x66, 0xc0, 0x7a, 0x6e, 0x7a, 0xa3, 0x85, 0x5a, 0x66, 0x56, 0xc0, 0x0b,
+    0xa3, 0x66, 0xa3, 0x66, 0xa4, 0x55, 0x6e, 0xa2, 0x77, 0xa2, 0x66, 0x6e, 0x7a, 0x6b, 0x12, 0xc0,
+    0x7e, 0x6e, 0x7e, 0xa2, 0x67, 0x05, 0x6e, 0x6f, 0xc2, 0x66, 0xc1, 0x5a, 0xc4, 0x66, 0x99, 0xec,
+    0xfe, 0xb5, 0x19, 0xfe, 0xce, 0xfd, 0x6f, 0x1f, 0x9c, 0xcb, 0x9d, 0xaa, 0x9d, 0xaa, 0x01, 0x52,
+    0x51, 0x62, 0x56, 0xc0, 0x55, 0x66, 0x5a, 0x66, 0x56, 0x65, 0x52, 0x98, 0xdd, 0x51, 0xa3, 0x67,
+    0xa4, 0x55, 0x2d, 0x64, 0x51, 0x64, 0x51, 0x50, 0x98, 0xda, 0x7f, 0x7f, 0x38, 0x66, 0x55, 0x55,
+    0x55, 0x55, 0xc0, 0xa2, 0x77, 0xa6, 0x55, 0xa3, 0x8d, 0x9d, 0x9c, 0x68, 0xa1, 0x83, 0xc0, 0x6b,
+    0x67, 0xc3, 0x6f, 0x6f, 0xc0, 0xa4, 0x66, 0xa8, 0x33, 0x96, 0xdf, 0xc0, 0x6f, 0xa2, 0x77, 0xa2,
+    0x67, 0xa3, 0x66, 0xa3, 0x66, 0xa4, 0x55, 0xa3, 0x66, 0x7e, 0x6f, 0x7e, 0xa3, 0x66, 0xa2, 0x66,
+    0x7e, 0x7f, 0x6e, 0xa2, 0x76, 0x6f, 0x7e, 0x6e, 0x7e, 0x7f, 0x6e, 0x7e, 0x6e, 0x7a, 0x6e, 0x7f,
+    0xc0, 0x6e, 0x7a, 0xc0, 0x9b, 0xcb, 0x98, 0xee, 0x9d, 0xaa, 0xa7, 0x33, 0xa8, 0x32, 0xa5, 0x55,
+    0x9c, 0xbb, 0x69, 0xc2, 0x66, 0xc1, 0x9a, 0xdd, 0xfe, 0xab, 0xd6, 0x56, 0xc0, 0x66, 0xc0, 0x5a,
+    0x65, 0xc0, 0xfe, 0xcd, 0x39, 0xaa, 0x21, 0x65, 0x66, 0x66, 0x66, 0x69, 0x66, 0xc0, 0x3f, 0x09,
+    0xfe, 0x93, 0x95, 0x31, 0x6f, 0xc0, 0x5e, 0xc1, 0x5a, 0xc0, 0x56, 0xc1, 0x21, 0x3e, 0xa6, 0x63,
+    0xfe, 0x94, 0x78, 0x97, 0xcf, 0x66, 0x40, 0xfe, 0x00, 0x21, 0x65, 0xc5, 0xfe, 0x4a, 0xf1, 0xa9,
+    0x36, 0xa4, 0x75, 0x9c, 0xab, 0x66, 0x7a, 0xc0, 0x7a, 0x6e, 0xc0, 0x7a, 0xc0, 0xa2, 0x76, 0x7e,
+    0xa2, 0x77, 0xa2, 0x77, 0x6e, 0xa2, 0x76, 0x1b, 0x6e, 0xa2, 0x67, 0x7e, 0x6e, 0xc1, 0x7e, 0x6b,
+    0x12, 0x7e, 0x6e, 0xa2, 0x77, 0xa2, 0x66, 0x7e, 0x6f, 0x6e, 0xc1, 0x11, 0xc1, 0x5a, 0xc3, 0x66,
+    0xfe, 0xc5, 0xfb, 0xc0, 0xfe, 0xcf, 0x3e, 0xc0, 0x66, 0x1f, 0x9d, 0xba, 0x30, 0x9d, 0xaa, 0x62,
+    0x9d, 0xaa, 0x56, 0x61, 0x56, 0xc0, 0x56, 0x66, 0x0b, 0x10, 0x9c, 0xbb, 0x9b, 0xbb, 0x99, 0xcd,
+    0xa4, 0x55, 0xa4, 0x56, 0x66, 0x55, 0x56, 0x61, 0x54, 0x61, 0x54, 0x9a, 0xca, 0x9c, 0xb9, 0x7f,
+    0xc0, 0x38, 0x55, 0x55, 0x51, 0x37, 0xc1, 0xa4, 0x66, 0xa7, 0x67, 0xfe, 0x49, 0x71, 0xc1, 0xa1,
+    0x82, 0x69, 0xc1, 0x2e, 0xc1, 0x7f, 0x6b, 0x6e, 0x1c, 0xa2, 0x67, 0xa2, 0x68, 0xa3, 0x56, 0x2a,
+    0xa2, 0x67, 0x6e, 0x14, 0x7e, 0x6e, 0xa2, 0x77, 0x6e, 0xa2, 0x77, 0x6e, 0x7e, 0x7e, 0xa4, 0x75,
+    0x9b, 0xac, 0x01, 0xa2, 0x77, 0x7e, 0xa2, 0x66, 0x31, 0x36, 0xa2, 0x76, 0xc0, 0x12, 0x6e, 0x7e,
+    0x6e, 0x7e, 0xc0, 0x7e, 0xc1, 0x7f, 0xc0, 0x7a, 0x65, 0x98, 0xde, 0x97, 0xff, 0xa4, 0x55, 0xa9,
+    0x21, 0x02, 0xc0, 0x66, 0xc2, 0x66, 0x99, 0xcd, 0xfe, 0xab, 0xb6, 0x5a, 0xc0, 0x22, 0xc0, 0x55,
+    0xc0, 0x66, 0x5a, 0xa7, 0x53, 0xfe, 0xe6, 0x1b, 0x7e, 0x66, 0x66, 0x65, 0xc0, 0x3f, 0x04, 0xa2,
+    0x66, 0xfe, 0x83, 0x35, 0x5a, 0xc0, 0x6e, 0x5a, 0xc1, 0x3c, 0xc1, 0x67, 0xa6, 0x43, 0xfe, 0xdf,
+    0x5e, 0x9a, 0xcc, 0xfe, 0x7b, 0x97, 0x32, 0x59, 0x9b, 0xba, 0x92, 0xe9, 0x9b, 0xb9, 0xc5, 0xad,
+    0x04, 0xfe, 0x64, 0x17, 0x2f, 0xc0, 0x7a, 0x66, 0xc0, 0x7a, 0xc0, 0x7e, 0xa1, 0x97, 0x7e, 0xa2,
+    0x76, 0x6b, 0xc0, 0x6e, 0xa2, 0x76, 0x6f, 0x6e, 0xa2, 0x77, 0x6e, 0xa2, 0x66, 0x7f, 0x39, 0xc1,
+    0x6e, 0x7a, 0x6f, 0x12, 0x7e, 0xa2, 0x76, 0xa2, 0x67, 0x05, 0x6e, 0x11, 0x6e, 0xc0, 0x11, 0xc1,
+    0x5a, 0xc2, 0x9a, 0xdc, 0x2b, 0xa9, 0x02, 0xa3, 0x65, 0xc0, 0x56, 0x66, 0x61, 0x9d, 0xba, 0x9d,
+    0xaa, 0x9d, 0xab, 0x61, 0x51, 0x62, 0x56, 0x65, 0x18, 0x66, 0x10, 0x3e, 0xa7, 0x43, 0xfe, 0x7b,
+    0x14, 0x6b, 0xa6, 0x34, 0xc0, 0x65, 0x52, 0x56, 0x65, 0x51, 0x55, 0x60, 0x65, 0x96, 0xda, 0xa0,
+    0xa9, 0x6e, 0x55, 0x55, 0x51, 0x55, 0x65, 0x37, 0xc0, 0x0b, 0xa6, 0x65, 0xa2, 0x7e, 0x52, 0xc0,
+    0x6b, 0x7d, 0xa0, 0x83, 0xc0, 0x6e, 0x6b, 0x7a, 0x6b, 0xc0, 0x6f, 0x6e, 0xa1, 0x79, 0xa2, 0x67,
+    0xa2, 0x68, 0xa3, 0x67, 0x6e, 0x6f, 0x6e, 0x7f, 0xa2, 0x66, 0x7e, 0x2d, 0xa2, 0x76, 0x7e, 0xa2,
+    0x67, 0x7e, 0xa5, 0x54, 0xa9, 0x41, 0xfe, 0x95, 0x3a, 0x9d, 0xba, 0x65, 0xa2, 0x77, 0x1d, 0xa2,
+    0x67, 0x7e, 0x6e, 0x7e, 0x0b, 0x6f, 0x1f, 0xc0, 0x7e, 0x6e, 0x7a, 0x6e, 0xc0, 0x7a, 0x6e, 0x6b,
+    0x79, 0xc0, 0x6b, 0x1c, 0xfe, 0xc5, 0x19, 0xc0, 0xfe, 0xee, 0xfd, 0xa3, 0x66, 0x61, 0xc0, 0x66,
+    0xfe, 0xc4, 0xf9, 0x97, 0xee, 0x66, 0x5a, 0x22, 0xc0, 0x69, 0x56, 0xc0, 0x66, 0x5a, 0x66, 0x13,
+    0xfe, 0xdd, 0x7a, 0x04, 0x66, 0x69, 0x3f, 0x04, 0x6e, 0x5e, 0xfe, 0x83, 0x35, 0x5e, 0xc0, 0x6b,
+    0x5e, 0xc3, 0x56, 0xc0, 0xfe, 0xc6, 0x7c, 0xa8, 0x42, 0xfe, 0x73, 0x75, 0xfe, 0x10, 0xa4, 0x9b,
+    0xb9, 0xc9, 0xfe, 0x4b, 0x53, 0xa6, 0x56, 0x6b, 0x7a, 0xc0, 0x7a, 0x2d, 0x7a, 0xc0, 0xa2, 0x86,
+    0xa2, 0x96, 0x6f, 0xc2, 0x6e, 0x7e, 0x6f, 0xa2, 0x66, 0xa2, 0x76, 0x6f, 0x6e, 0x6f, 0x7a, 0x6e,
+    0xc0, 0x6e, 0x6e, 0x7a, 0xc0, 0x66, 0x7a, 0x6e, 0x6e, 0xa2, 0x77, 0xa2, 0x76, 0xa3, 0x56, 0x11,
+    0xc2, 0x5a, 0x61, 0x9a, 0xec, 0x04, 0xa4, 0x55, 0x0e, 0x66, 0xc0, 0x69, 0x56, 0xc0, 0x61, 0x9d,
+    0xbb, 0x01, 0x9d, 0xba, 0x51, 0xa9, 0x32, 0xa8, 0x32, 0xfe, 0xd6, 0x3c, 0xfe, 0xac, 0xd9, 0x5a,
+    0x17, 0x11, 0xfe, 0x93, 0xf7, 0x9b, 0xbb, 0xa5, 0x45, 0xa2, 0x77, 0x55, 0x56, 0x66, 0x51, 0x66,
+    0x56, 0x51, 0x60, 0x55, 0x9c, 0xb8, 0x98, 0xda, 0x0c, 0xc0, 0x51, 0x55, 0x55, 0x51, 0x55, 0xc0,
+    0x6e, 0xa4, 0x76, 0xa6, 0x69, 0x9d, 0x9f, 0xc0, 0xa2, 0x73, 0x09, 0x7e, 0x68, 0xa1, 0x73, 0x7b,
+    0xc1, 0x02, 0xc0, 0x6b, 0x6f, 0x6f, 0xa2, 0x77, 0xa2, 0x68, 0xa2, 0x67, 0xa2, 0x67, 0x6f, 0x6e,
+    0x7e, 0x19, 0x7e, 0x2d, 0xa2, 0x76, 0x6e, 0xa2, 0x77, 0x6e, 0x7e, 0x7f, 0xa2, 0x66, 0x7e, 0x6f,
+    0xa9, 0x51, 0xa5, 0x74, 0xfe, 0xad, 0x39, 0xa3, 0x56, 0xa5, 0x45, 0x7e, 0x6e, 0x7e, 0x6f, 0x7a,
+    0x6e, 0x7a, 0x6e, 0x7e, 0xc1, 0x7a, 0xc0, 0x6e, 0x7a, 0xc2, 0x9b, 0xcc, 0xfe, 0xc5, 0x19, 0x7e,
+    0xfe, 0xee, 0xdc, 0xa5, 0x45, 0xfe, 0xe6, 0x3b, 0xfe, 0xab, 0xd6, 0xc0, 0x56, 0xc0, 0x66, 0x69,
+    0x66, 0x5a, 0xc0, 0xa8, 0x42, 0x07, 0x7e, 0x9c, 0xab, 0x98, 0xce, 0xa7, 0x53, 0xaa, 0x31, 0x6e,
+    0xc0, 0x6e, 0x6f, 0xfe, 0xb4, 0xb8, 0x05, 0x5a, 0x0e, 0xc1, 0x5a, 0xc3, 0x6e, 0xfe, 0xef, 0xbf,
+    0xfe, 0xb5, 0x9a, 0xfe, 0x21, 0x07, 0x98, 0xc9, 0xca, 0xfe, 0x32, 0x6d, 0xad, 0x15, 0xc0, 0xa2,
+    0x77, 0x62, 0x7a, 0xc0, 0x2d, 0x30, 0xc0, 0x7e, 0xa3, 0x85, 0xa1, 0x98, 0x5a, 0x6e, 0x7a, 0x5e,
+    0x7e, 0x6f, 0xa2, 0x66, 0xa2, 0x77, 0x6e, 0xc1, 0x6e, 0x20, 0x9d, 0xba, 0x61, 0x62, 0x7e, 0xa9,
+    0x22, 0xfe, 0xff, 0xbf, 0x96, 0xef, 0x42, 0x7a, 0xc0, 0x9d, 0xaa, 0x66, 0xc0, 0x2e, 0x7a, 0x9c,
+    0xbb, 0x61, 0x07, 0xa8, 0x02, 0xa2, 0x67, 0x66, 0xc1, 0x69, 0x56, 0xc0, 0x66, 0x9d, 0xba, 0x9d,
+    0xaa, 0x61, 0x52, 0xfe, 0xff, 0xff, 0xc0, 0x52, 0xfe, 0xad, 0x19, 0x66, 0x10, 0x9a, 0xcc, 0xa4,
+    0x55, 0xa3, 0x67, 0x55, 0x66, 0x56, 0x66, 0x55, 0x52, 0x65, 0x52, 0x65, 0x26, 0x65, 0x97, 0xd9,
+    0x9d, 0xb9, 0x6e, 0x55, 0x51, 0x55, 0x61, 0x55, 0x56, 0xc0, 0xa3, 0x76, 0xa8, 0x45, 0x9f, 0x9e,
+    0x9f, 0x9b, 0xc0, 0xa3, 0x52, 0x6b, 0x11, 0xc0, 0x68, 0xa1, 0x84, 0x6e, 0xc0, 0x6b, 0x7e, 0x6b,
+    0x6f, 0x6f, 0x6f, 0xa2, 0x67, 0xa2, 0x68, 0xa2, 0x77, 0x6f, 0x6e, 0x6e, 0x6f, 0xa2, 0x76, 0x6e,
+    0x7f, 0xa2, 0x66, 0x7e, 0x18, 0x7e, 0x6f, 0x7e, 0xa2, 0x66, 0x7e, 0xfe, 0xf7, 0x9f, 0xa3, 0x65,
+    0xfe, 0xc6, 0x9d, 0x96, 0xef, 0x9b, 0xdb, 0xa6, 0x34, 0xa7, 0x33, 0x7e, 0x17, 0x7e, 0x6e, 0x7a,
+    0x6e, 0xc0, 0x7e, 0xc1, 0x7a, 0x6e, 0xc0, 0x7a, 0xc0, 0x66, 0xc1, 0x9a, 0xdd, 0xfe, 0xbc, 0xb8,
+    0xa7, 0x43, 0xa9, 0x21, 0xfe, 0xab, 0xd6, 0xc0, 0x56, 0xc0, 0x66, 0x69, 0x16, 0x27, 0xfe, 0xe5,
+    0xfa, 0xa4, 0x66, 0x65, 0x5a, 0xc0, 0x66, 0x97, 0xde, 0xfe, 0x9b, 0x95, 0xa4, 0x65, 0xa3, 0x66,
+    0x56, 0x9a, 0xbc, 0x05, 0xc0, 0x6f, 0x5a, 0xc5, 0x5a, 0x6e, 0xfe, 0xe7, 0x3e, 0xfe, 0x6b, 0x34,
+    0xfe, 0x00, 0x00, 0xcc, 0xfe, 0x3a, 0x8e, 0xac, 0x15, 0xfe, 0xa5, 0xdb, 0x7a, 0xfe, 0x74, 0x38,
+    0x66, 0x2d, 0x7a, 0xc0, 0x7a, 0x7e, 0xa5, 0x74, 0xc2, 0x6e, 0x6e, 0x6f, 0x6e, 0xa2, 0x77, 0x6e,
+    0x16, 0x3d, 0x27, 0x66, 0xa4, 0x55, 0xa9, 0x21, 0x56, 0xc0, 0x03, 0xa6, 0x53, 0x9c, 0xac, 0x9d,
+    0x9a, 0x6e, 0xa3, 0x76, 0x56, 0x56, 0xa4, 0x74, 0x9c, 0xab, 0x9b, 0xbc, 0x9c, 0xcb, 0x9b, 0xcb,
+    0x9b, 0xdc, 0xc0, 0xa2, 0x67, 0xa5, 0x34, 0xa4, 0x45, 0xa4, 0x46, 0xa4, 0x44, 0x66, 0xc0, 0x66,
+    0x61, 0x9d, 0xaa, 0x62, 0x51, 0xab, 0x30, 0x31, 0x07, 0xfe, 0x9b, 0xf6, 0x52, 0xa5, 0x45, 0xa5,
+    0x44, 0xc0, 0x56, 0x66, 0x55, 0x0d, 0x52, 0x55, 0x62, 0x55, 0x52, 0x66, 0x51, 0x65, 0x94, 0xf9,
+    0xa0, 0xa9, 0x59, 0x51, 0x55, 0x51, 0x55, 0x65, 0x5a, 0x0b, 0xa7, 0x55, 0xa4, 0x68, 0x57, 0x9d,
+    0xbe, 0xc0, 0xa2, 0x65, 0xa3, 0x64, 0x6b, 0x9c, 0xbd, 0x11, 0x6d, 0xa1, 0x84, 0x6e, 0x7a, 0x6f,
+    0xc0, 0x6f, 0x6b, 0x7f, 0xa2, 0x67, 0xa2, 0x68, 0x32, 0x6f, 0xa2, 0x66, 0xc0, 0x7f, 0xa2, 0x66,
+    0x6e, 0x7f, 0xa2, 0x66, 0x7e, 0x6f, 0xa2, 0x76, 0x6e, 0x7f, 0xa2, 0x66, 0x7e, 0xa4, 0x65, 0xa4,
+    0x75, 0x9b, 0xac, 0x27, 0x7f, 0x9d, 0xa9, 0x9a, 0xed, 0xa3, 0x66, 0x0b, 0xa2, 0x77, 0xc0, 0x24,
+    0x7e, 0xc0, 0x7a, 0x6e, 0xc0, 0x7a, 0xc0, 0x6e, 0xc0, 0x76, 0xc3, 0x66, 0x96, 0xff, 0x96, 0xff,
+    0x9b, 0xbc, 0x5a, 0x66, 0xc0, 0x66, 0x69, 0x66, 0xfe, 0xd5, 0x9a, 0xa7, 0x53, 0xc1, 0x65, 0x5a,
+    0x66, 0xc0, 0x52, 0xfe, 0xac, 0x37, 0x98, 0xcd, 0x6b, 0x5e, 0x6e, 0x6b, 0xc0, 0x5a, 0xc0, 0xa3,
+    0x66, 0xfe, 0xad, 0x7a, 0xa5, 0x64, 0xfe, 0x9c, 0xb9, 0x97, 0xde, 0xc0, 0x0e, 0xa4, 0x55, 0xfe,
+    0x31, 0x8a, 0x94, 0xea, 0xcd, 0xfe, 0x3a, 0x4d, 0xfe, 0x84, 0xf9, 0x24, 0x98, 0xde, 0xfe, 0x74,
+    0x18, 0xc0, 0x66, 0x30, 0xc0, 0x33, 0xa4, 0x75, 0xa3, 0x75, 0x66, 0x2c, 0xc0, 0x31, 0x6b, 0xa2,
+    0x66, 0xc0, 0x9c, 0xbb, 0x9d, 0xba, 0x2c, 0xa4, 0x55, 0xa3, 0x56, 0xc0, 0xa8, 0x42, 0x9b, 0xbc,
+    0x56, 0x01, 0xa5, 0x64, 0x5a, 0x6f, 0x3b, 0x6e, 0xc1, 0x6e, 0x6b, 0x5a, 0xc0, 0xfe, 0xd5, 0xfb,
+    0x9c, 0xbb, 0xa9, 0x02, 0x51, 0x9c, 0xcb, 0x9c, 0xbb, 0x9c, 0xbb, 0x9d, 0xba, 0xa2, 0x66, 0xa2,
+    0x57, 0x6e, 0xc0, 0x34, 0x9d, 0xaa, 0x9d, 0xaa, 0x9c, 0xbb, 0xa2, 0x66, 0xa2, 0x67, 0xa6, 0x34,
+    0xa4, 0x55, 0x66, 0x56, 0x66, 0x55, 0x66, 0x56, 0x66, 0x51, 0x66, 0x51, 0x56, 0x13, 0x56, 0x61,
+    0x9c, 0xa9, 0x96, 0xf9, 0x7f, 0x51, 0x3d, 0x55, 0x1a, 0x55, 0x65, 0x0b, 0xa6, 0x65, 0xa6, 0x48,
+    0xc0, 0x6b, 0x63, 0x53, 0x7e, 0xa4, 0x53, 0x6e, 0x6b, 0x16, 0xc1, 0x7c, 0xa2, 0x74, 0x6b, 0x7f,
+    0x6e, 0x6b, 0x6f, 0x6f, 0xa2, 0x67, 0xa1, 0x89, 0xa2, 0x67, 0xa2, 0x66, 0x6e, 0x6f, 0x6e, 0x7e,
+    0x6f, 0xa2, 0x66, 0x7e, 0x6f, 0xa2, 0x76, 0x6e, 0x7f, 0x6e, 0x06, 0x6f, 0x7e, 0x7e, 0x6e, 0x7f,
+    0x6e, 0xa2, 0x76, 0x9d, 0xba, 0x97, 0xff, 0xa5, 0x54, 0xa8, 0x22, 0xa2, 0x67, 0x7e, 0xc0, 0x6e,
+    0x7a, 0xc1, 0x37, 0xc2, 0x7a, 0xc2, 0x66, 0xc0, 0x9c, 0xbb, 0xfe, 0xb4, 0x77, 0x9a, 0xcd, 0xc1,
+    0x66, 0x69, 0x22, 0xfe, 0xf6, 0x9c, 0x66, 0xc1, 0x65, 0x5a, 0xc2, 0x6f, 0x23, 0xfe, 0x8b, 0x55,
+    0x6e, 0x5b, 0x6e, 0xc1, 0xa6, 0x44, 0xfe, 0xe7, 0x5e, 0x9c, 0xbb, 0xfe, 0x9c, 0x78, 0x99, 0xbd,
+    0x6b, 0x13, 0x0b, 0x96, 0xda, 0xfe, 0x00, 0x00, 0xce, 0x6f, 0xfe, 0x64, 0x17, 0xfe, 0xce, 0xfd,
+    0x9b, 0xdc, 0xfe, 0x8c, 0xb9, 0x9b, 0xac, 0x2d, 0x7a, 0xc0, 0x7a, 0xa2, 0x86, 0xa5, 0x74, 0x5a,
+    0xc2, 0x56, 0x10, 0x6b, 0xa4, 0x64, 0xa3, 0x56, 0xfe, 0xef, 0x5e, 0xfe, 0xb5, 0x9b, 0xc1, 0x6e,
+    0x28, 0x6f, 0x3c, 0xa2, 0x77, 0xa3, 0x65, 0xa2, 0x67, 0x7e, 0xc2, 0x6e, 0x5a, 0x22, 0x9b, 0xcc,
+    0x22, 0xa5, 0x35, 0xc4, 0x5a, 0x61, 0x9c, 0xbb, 0xfe, 0xbd, 0x39, 0xfe, 0xab, 0xf6, 0x56, 0xa6,
+    0x34, 0xa7, 0x23, 0xa6, 0x34, 0x66, 0x55, 0x66, 0x52, 0xc0, 0x56, 0x65, 0x52, 0x66, 0x55, 0x66,
+    0x05, 0x66, 0x56, 0x65, 0x52, 0x13, 0x52, 0x97, 0xe9, 0x9b, 0xc9, 0xc0, 0x51, 0x54, 0x51, 0x56,
+    0x55, 0xc0, 0xa5, 0x66, 0xa8, 0x46, 0x5b, 0xc0, 0x6b, 0x2e, 0x9b, 0xce, 0x5a, 0xfe, 0x8b, 0xf5,
+    0xa2, 0x77, 0xfe, 0x62, 0xb3, 0xc0, 0x99, 0xee, 0x16, 0x19, 0x6e, 0xa2, 0x74, 0xa2, 0x76, 0x6b,
+    0x6e, 0x6f, 0x7f, 0xa1, 0x79, 0xa2, 0x67, 0x6e, 0xa2, 0x77, 0x13, 0xa2, 0x67, 0xc0, 0x6e, 0x6f,
+    0xa2, 0x76, 0x6e, 0x6f, 0xa2, 0x76, 0x6e, 0x7f, 0x6e, 0xa2, 0x76, 0x6f, 0x7e, 0x6e, 0x7e, 0x6e,
+    0x7f, 0xa4, 0x75, 0xa4, 0x65, 0x9b, 0xab, 0x9c, 0xbb, 0x99, 0xed, 0xa5, 0x55, 0xa8, 0x22, 0x6e,
+    0x6e, 0x7a, 0xc1, 0x7a, 0xc3, 0x7a, 0xc1, 0x66, 0xc1, 0x61, 0xfe, 0xb4, 0x37, 0x9c, 0xab, 0xc0,
+    0x66, 0x69, 0xa2, 0x77, 0xfe, 0xf6, 0x9c, 0xc0, 0x66, 0xc1, 0x65, 0xc0, 0x6e, 0x1d, 0xa2, 0x66,
+    0x6f, 0xfe, 0xac, 0xb8, 0x97, 0xdf, 0xc0, 0x5a, 0xc0, 0xa2, 0x77, 0xfe, 0xe7, 0x5e, 0x9a, 0xcd,
+    0xfe, 0x83, 0xb6, 0x92, 0xec, 0x97, 0xc9, 0x9c, 0xaa, 0x69, 0x51, 0xd1, 0xfe, 0x4b, 0x32, 0xfe,
+    0xb6, 0x5c, 0xa0, 0xb8, 0xfe, 0x9d, 0x1a, 0x98, 0xbe, 0xc0, 0x2d, 0x30, 0xc0, 0x7a, 0xa3, 0x75,
+    0xa3, 0x76, 0xc0, 0x51, 0x08, 0xa2, 0x77, 0xa3, 0x66, 0xa2, 0x76, 0x6e, 0xc1, 0x6f, 0x7a, 0x6e,
+    0x6e, 0xc0, 0x7f, 0x3c, 0x09, 0xa3, 0x66, 0x6f, 0x6e, 0xc1, 0x6e, 0x1d, 0x3f, 0x1d, 0x3d, 0xc0,
+    0x6b, 0x6e, 0xc3, 0x56, 0xfe, 0xc5, 0xfb, 0xfe, 0xb4, 0x58, 0x69, 0xfe, 0xbd, 0x9a, 0xa9, 0x02,
+    0x6e, 0x1c, 0x62, 0x55, 0x66, 0x56, 0x65, 0x56, 0x62, 0x56, 0x65, 0x56, 0x62, 0x23, 0x9b, 0xcc,
+    0xa2, 0x66, 0x00, 0x55, 0x62, 0x55, 0x0e, 0xfe, 0x51, 0xcb, 0x65, 0x66, 0x50, 0x55, 0x55, 0x52,
+    0x69, 0xa3, 0x67, 0xa9, 0x46, 0xa1, 0x7a, 0xc0, 0x6e, 0xc1, 0x9c, 0xbc, 0x1e, 0xab, 0x10, 0xa2,
+    0x67, 0x9b, 0xbc, 0x6f, 0xc0, 0x98, 0xed, 0x1e, 0x2a, 0x1e, 0x7e, 0xa3, 0x64, 0xa2, 0x77, 0x6f,
+    0x6f, 0x6f, 0x7f, 0x6e, 0x0e, 0x18, 0x7f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0xa2, 0x77, 0x6e, 0x6e,
+    0x7f, 0x39, 0x06, 0x6f, 0x7e, 0x6e, 0x7e, 0x6e, 0x3b, 0x6e, 0x7e, 0x6e, 0x1c, 0x7e, 0x9c, 0xcb,
+    0x97, 0xee, 0xaa, 0x11, 0xa5, 0x44, 0xc0, 0x7a, 0xc1, 0x7a, 0xc3, 0x7a, 0xc0, 0x66, 0xc1, 0x66,
+    0xfe, 0xc5, 0x39, 0xfe, 0xa3, 0xb6, 0xc0, 0x66, 0x69, 0x22, 0xfe, 0xee, 0x9c, 0x7a, 0xc0, 0x66,
+    0xc2, 0x22, 0x6e, 0x6f, 0x6e, 0x9a, 0xac, 0xfe, 0x93, 0xd7, 0x55, 0xc0, 0x5a, 0x17, 0xfe, 0xf7,
+    0x9f, 0xfe, 0x8b, 0xf7, 0xfe, 0x21, 0x06, 0x98, 0xca, 0xd5, 0xfe, 0x4b, 0x32, 0xfe, 0xa5, 0x9b,
+    0x09, 0x3c, 0x97, 0xbf, 0x7a, 0x66, 0x7a, 0xc0, 0x7a, 0x6e, 0xc0, 0xa2, 0x86, 0xa3, 0x76, 0xa2,
+    0x77, 0x5a, 0x6e, 0x7e, 0xc1, 0x6e, 0xc0, 0x6f, 0x7a, 0x6e, 0x7e, 0x6f, 0xa2, 0x76, 0xa2, 0x77,
+    0xa3, 0x65, 0x6e, 0x2e, 0xc0, 0x09, 0x9b, 0xdc, 0x09, 0xa5, 0x45, 0x6e, 0xc2, 0x5e, 0x7b, 0x6e,
+    0xc0, 0x9c, 0xba, 0xfe, 0xc4, 0xf9, 0x9d, 0xaa, 0xfe, 0xc5, 0xfb, 0xa9, 0x02, 0x6e, 0x35, 0x65,
+    0x56, 0x1c, 0x56, 0x65, 0x62, 0x56, 0x66, 0x55, 0x66, 0x52, 0x65, 0x52, 0x9b, 0xcb, 0x6f, 0xc0,
+    0x0a, 0x62, 0x65, 0x52, 0x51, 0xfe, 0x51, 0xaa, 0x7b, 0x55, 0x54, 0x51, 0x55, 0x56, 0x7f, 0xa9,
+    0x35, 0xa4, 0x59, 0xc2, 0x6b, 0x7a, 0x52, 0x9b, 0xcb, 0x08, 0xa3, 0x66, 0x6f, 0x7e, 0x6f, 0x35,
+    0x2a, 0x7e, 0xaa, 0x01, 0x98, 0xee, 0x9d, 0xba, 0xa2, 0x75, 0xa3, 0x66, 0xa2, 0x77, 0x6f, 0xa2,
+    0x67, 0x7f, 0x6e, 0xa2, 0x66, 0x6f, 0x34, 0x00, 0x6e, 0x6e, 0x6f, 0x6e, 0x6e, 0x7e, 0x6f, 0xa2,
+    0x66, 0x06, 0x6e, 0x1a, 0x6e, 0x7e, 0x6e, 0x3b, 0x6e, 0x7e, 0x6e, 0x1c, 0xa3, 0x75, 0xa2, 0x87,
+    0x24, 0x99, 0xfd, 0x17, 0xab, 0x00, 0x7e, 0xc0, 0x6e, 0xc0, 0x7a, 0x66, 0xc2, 0x7a, 0x66, 0xc1,
+    0x9d, 0xaa, 0xfe, 0xac, 0x17, 0x9d, 0xaa, 0xc0, 0x66, 0xc0, 0x59, 0xfe, 0xd5, 0x7a, 0xa9, 0x31,
+    0xc3, 0x6e, 0xc0, 0x56, 0xfe, 0xc5, 0x39, 0xfe, 0x9b, 0xd7, 0x45, 0xc0, 0x6b, 0xc1, 0xfe, 0xd6,
+    0x9d, 0x9b, 0xbb, 0xfe, 0x4a, 0x2d, 0xfe, 0x00, 0x00, 0xd6, 0xfe, 0x53, 0xd5, 0x3e, 0xa8, 0x72,
+    0x20, 0x9a, 0xad, 0xc0, 0x7a, 0x66, 0x7a, 0xc0, 0x7a, 0xa6, 0x63, 0xa2, 0x77, 0xc1, 0x5a, 0x6e,
+    0xc1, 0x6e, 0xc0, 0x7e, 0x6b, 0x6e, 0x7e, 0xa2, 0x76, 0x7f, 0xa2, 0x66, 0xa2, 0x77, 0x1d, 0x6e,
+    0x9c, 0xbb, 0x99, 0xed, 0xa6, 0x34, 0xa6, 0x33, 0x6b, 0x6e, 0x5a, 0xc1, 0x6e, 0xc0, 0x6e, 0x7b,
+    0x09, 0xfe, 0xc4, 0xd8, 0xa6, 0x25, 0x35, 0xa2, 0x67, 0x3a, 0xc0, 0x35, 0xc0, 0x55, 0x66, 0x66,
+    0x51, 0x66, 0x3b, 0x66, 0x66, 0x55, 0x62, 0x56, 0x9d, 0xba, 0x9a, 0xcc, 0xa4, 0x55, 0x56, 0x65,
+    0x66, 0x52, 0x51, 0x98, 0xec, 0x97, 0xe8, 0x6b, 0x50, 0x55, 0x51, 0x56, 0x6e, 0xa7, 0x56, 0xa7,
+    0x38, 0x6b, 0xc4, 0x66, 0x2a, 0xa4, 0x65, 0xa5, 0x45, 0xc0, 0x6e, 0x7f, 0x6e, 0x35, 0x97, 0xfe,
+    0xa8, 0x23, 0x00, 0x9b, 0xbb, 0xfe, 0x6a, 0x53, 0x51, 0xa3, 0x65, 0xa4, 0x66, 0x3d, 0x0c, 0xa2,
+    0x66, 0x25, 0xa2, 0x66, 0x6e, 0x7f, 0x0d, 0x12, 0x1e, 0x6e, 0x6e, 0x6e, 0x6f, 0x7e, 0x6e, 0x6e,
+    0x1a, 0x6e, 0x7e, 0x6e, 0x3b, 0x6e, 0x7e, 0x6e, 0x1c, 0xc0, 0x7e, 0xa3, 0x76, 0xa6, 0x63, 0x97,
+    0xcf, 0x17, 0xa5, 0x54, 0xa8, 0x22, 0xc1, 0x3c, 0xc0, 0x66, 0xc2, 0x7a, 0x66, 0xc0, 0xfe, 0xb4,
+    0x78, 0x9b, 0xbb, 0x66, 0xc0, 0x66, 0x5a, 0x69, 0x27, 0xfe, 0xe6, 0x3b, 0xa4, 0x65, 0xc2, 0x52,
+    0xfe, 0xc4, 0xf8, 0x1f, 0x5a, 0x6e, 0xc0, 0x5f, 0xc1, 0x25, 0xfe, 0xcd, 0xfb, 0xfe, 0x8b, 0xd6,
+    0xfe, 0x08, 0x41, 0x51, 0xd5, 0xa8, 0x26, 0xfe, 0x5c, 0x37, 0xaa, 0x61, 0xa5, 0x85, 0xfe, 0x6c,
+    0x38, 0x66, 0xc0, 0x7a, 0x66, 0x7a, 0xc0, 0xa5, 0x74, 0xa4, 0x75, 0x5a, 0x38, 0x5a, 0xc1, 0x5a,
+    0x7e, 0xc0, 0x6e, 0x02, 0x6f, 0x1b, 0x6e, 0x7e, 0x7f, 0xa2, 0x76, 0x15, 0x2b, 0x9b, 0xcc, 0xa4,
+    0x55, 0x1d, 0x6e, 0xc0, 0x6e, 0x24, 0x6b, 0xc1, 0x6e, 0xc1, 0xfe, 0xcd, 0xdb, 0x99, 0xfd, 0xfe,
+    0xce, 0x5c, 0xa8, 0x03, 0xc1, 0x65, 0xc0, 0x66, 0xc0, 0x56, 0x65, 0x9d, 0xba, 0x56, 0x6f, 0x03,
+    0x3b, 0x66, 0x62, 0x55, 0x66, 0x96, 0xff, 0x3f, 0x56, 0x61, 0x66, 0x12, 0x08, 0x98, 0xdd, 0x96,
+    0xfd, 0x9f, 0x84, 0x66, 0x50, 0x0a, 0x56, 0x69, 0x34, 0xaa, 0x17, 0x6f, 0xc0, 0x5a, 0xc0, 0x3a,
+    0xc2, 0xfe, 0x61, 0xf2, 0xa5, 0x44, 0x3a, 0x7a, 0x6e, 0x6f, 0x16, 0x6f, 0x98, 0xed, 0x9b, 0xbb,
+    0xfe, 0x8c, 0x38, 0xa3, 0x66, 0x1e, 0x99, 0xdd, 0x97, 0xfd, 0x9c, 0xbb, 0xa3, 0x66, 0xa5, 0x55,
+    0xa3, 0x66, 0x2a, 0x7e, 0x6f, 0x08, 0x7e, 0x1c, 0x26, 0xc0, 0x6e, 0x6f, 0x6e, 0x01, 0x6e, 0x7e,
+    0x6f, 0x6e, 0x7e, 0x6e, 0x7f, 0x6e, 0x7e, 0x0d, 0x7f, 0x6e, 0xc0, 0x29, 0xa2, 0x76, 0x66, 0xc0,
+    0x99, 0xed, 0x9a, 0xcd, 0xab, 0x00, 0xa3, 0x65, 0xc0, 0x7a, 0xc0, 0x66, 0xc2, 0x76, 0xc0, 0xfe,
+    0xa3, 0xd6, 0xc0, 0x66, 0xc1, 0x56, 0xc0, 0x69, 0x2c, 0xfe, 0xd5, 0x7a, 0xa9, 0x21, 0x51, 0xfe,
+    0xc4, 0xf8, 0xfe, 0x9b, 0x96, 0xc0, 0x5a, 0x6e, 0xc0, 0xa5, 0x45, 0x7e, 0x9b, 0xbc, 0x2a, 0xc1,
+    0x90, 0xfc, 0x92, 0xeb, 0xd6, 0xfe, 0x43, 0x52, 0xa7, 0x46, 0xfe, 0xb5, 0xfb, 0xfe, 0x74, 0x78,
+    0x9d, 0x9a, 0x2f, 0xc1, 0x7a, 0x66, 0xa5, 0x84, 0xa5, 0x64, 0x66, 0x38, 0x5a, 0xc0, 0x56, 0xc0,
+    0x6e, 0xc0, 0x7e, 0x3f, 0x07, 0x6f, 0x7e, 0x7e, 0x7e, 0xa2, 0x67, 0x9c, 0xbb, 0x9a, 0xdc, 0xa5,
+    0x54, 0xa8, 0x13, 0x7e, 0xc1, 0x6e, 0xc0, 0x5a, 0xc1, 0x6b, 0x6e, 0xc0, 0xfe, 0xcd, 0x9a, 0x9c,
+    0xcb, 0xfe, 0xce, 0x9d, 0xa5, 0x35, 0xc0, 0x6e, 0xc1, 0x65, 0xc0, 0x66, 0xc0, 0x9c, 0xbb, 0x9d,
+    0xaa, 0xa4, 0x55, 0x17, 0x0f, 0x3e, 0x56, 0x66, 0x65, 0x3f, 0x9c, 0xbb, 0x07, 0x3f, 0x66, 0x65,
+    0x21, 0x98, 0xed, 0xfe, 0x6a, 0x32, 0xa0, 0x85, 0x9f, 0x86, 0x55, 0x51, 0x55, 0xc0, 0xa2, 0x87,
+    0xab, 0x07, 0xa2, 0x68, 0xc2, 0x66, 0xc2, 0x7a, 0x97, 0xed, 0xa4, 0x56, 0xa7, 0x43, 0x09, 0x6e,
+    0x16, 0x6e, 0x7f, 0xc0, 0xfe, 0x6a, 0x52, 0x09, 0xab, 0x00, 0x6e, 0xa2, 0x77, 0x7e, 0x9a, 0xcc,
+    0x96, 0xff, 0x99, 0xdd, 0xa2, 0x76, 0xa6, 0x44, 0xa5, 0x55, 0xa2, 0x67, 0x7e, 0xa2, 0x67, 0x7e,
+    0x6e, 0x2e, 0x6f, 0x3f, 0x6e, 0x6e, 0x6e, 0x6f, 0x6e, 0x7e, 0xc0, 0x6e, 0xa2, 0x77, 0xc0, 0x7e,
+    0x6e, 0x7f, 0x6e, 0xc0, 0x7e, 0x6e, 0x7a, 0xc1, 0x66, 0xfe, 0xbd, 0x59, 0xa7, 0x33, 0xa8, 0x22,
+    0x7a, 0xc1, 0x66, 0xc1, 0x7a, 0x66, 0xfe, 0xb4, 0x98, 0x9a, 0xcc, 0xc0, 0x66, 0x5a, 0x66, 0xc1,
+    0x69, 0x66, 0x1f, 0x13, 0xc0, 0x1f, 0xc0, 0x24, 0xa4, 0x55, 0xfe, 0xe6, 0xdd, 0xa7, 0x33, 0x9a,
+    0xcc, 0xfe, 0xb5, 0x5a, 0x2a, 0xc0, 0x95, 0xdb, 0xfe, 0x00, 0x00, 0xd6, 0xfe, 0x2a, 0x4c, 0xfe,
+    0x54, 0x37, 0x7b, 0xc0, 0x69, 0x76, 0xc0, 0x7b, 0xc0, 0x7a, 0xa3, 0x85, 0xa5, 0x85, 0xc0, 0x5a,
+    0x56, 0x65, 0x5a, 0x57, 0x6e, 0x7a, 0x6e, 0x7e, 0x3f, 0x07, 0x7f, 0x7e, 0x6e, 0x9d, 0xba, 0x9b,
+    0xbc, 0xa4, 0x65, 0xa8, 0x22, 0xa2, 0x77, 0xc1, 0x15, 0xc0, 0x6e, 0xc2, 0x17, 0xc1, 0xfe, 0xcd,
+    0x5a, 0x61, 0xfe, 0xd6, 0xde, 0x30, 0x6e, 0x01, 0xc0, 0x6e, 0xc0, 0x01, 0x69, 0xc0, 0x17, 0x61,
+    0xa4, 0x46, 0x1c, 0xc0, 0x17, 0x51, 0x3e, 0x66, 0x56, 0xfe, 0x9c, 0x37, 0x20, 0x56, 0x65, 0x62,
+    0x56, 0x9a, 0xcc, 0xfe, 0x72, 0x73, 0x50, 0xa0, 0x83, 0x56, 0x55, 0x55, 0xc0, 0x39, 0xa7, 0x49,
+    0xa7, 0x24, 0xc0, 0x66, 0xc6, 0x97, 0xfe, 0x05, 0xfe, 0xff, 0xff, 0xfe, 0xac, 0xd9, 0x11, 0x6e,
+    0x7e, 0x6f, 0xa2, 0x76, 0x11, 0x0b, 0xfe, 0x94, 0xda, 0xa2, 0x76, 0x6e, 0x7e, 0x6f, 0x7e, 0x0c,
+    0x96, 0xff, 0xfe, 0x7a, 0xd4, 0x65, 0xa6, 0x45, 0xa7, 0x33, 0xa2, 0x77, 0x29, 0x6e, 0x3d, 0x02,
+    0x07, 0x0c, 0x18, 0xc0, 0x6e, 0x6e, 0x6e, 0x6e, 0x3b, 0x6e, 0x6e, 0x7a, 0xa2, 0x66, 0x1c, 0x21,
+    0x7e, 0xc0, 0x6e, 0x7a, 0xc0, 0x6e, 0x7a, 0xc0, 0xfe, 0xc5, 0xda, 0x9d, 0xab, 0xfe, 0xdf, 0x1d,
+    0x7e, 0xc1, 0x66, 0xc1, 0x7a, 0x9a, 0xcc, 0xfe, 0xa3, 0xd6, 0xc0, 0x66, 0xc0, 0x56, 0xc7, 0x6e,
+    0xa2, 0x67, 0xfe, 0xe6, 0xdd, 0x0d, 0xfe, 0x83, 0x95, 0x95, 0xdb, 0x9a, 0xa9, 0x66, 0x9c, 0x98,
+    0x9a, 0xba, 0xd6, 0xa6, 0x36, 0xfe, 0x4c, 0x37, 0xc0, 0x7a, 0x7a, 0xc0, 0x76, 0xc0, 0x2f, 0xc0,
+    0x7a, 0xc0, 0x66, 0xa1, 0x97, 0xa3, 0x76, 0xa3, 0x75, 0x56, 0x5a, 0xc0, 0x6b, 0x7e, 0x6e, 0x7e,
+    0x02, 0x7e, 0x6f, 0x0a, 0x9b, 0xcc, 0xa3, 0x66, 0xa7, 0x32, 0xa2, 0x77, 0x6e, 0x7a, 0x09, 0x6e,
+    0x15, 0xc1, 0x1a, 0x15, 0x5a, 0xc1, 0xfe, 0xc5, 0x3a, 0x65, 0x12, 0xa7, 0x42, 0x9d, 0x9b, 0x2b,
+    0xa2, 0x66, 0x6f, 0x6e, 0xc1, 0x65, 0x12, 0xc0, 0x30, 0xc0, 0x28, 0x1c, 0x17, 0x12, 0x65, 0x3e,
+    0xfe, 0xa4, 0xb8, 0xa7, 0x33, 0xa2, 0x77, 0x20, 0x66, 0x55, 0x9c, 0xbb, 0xfe, 0x7a, 0x93, 0x51,
+    0x9f, 0x84, 0x69, 0x5a, 0x65, 0xc0, 0xa0, 0x8a, 0xa0, 0x8c, 0xaa, 0x13, 0xa5, 0x44, 0x66, 0xc1,
+    0x5a, 0x27, 0xc1, 0x66, 0xc0, 0x97, 0xfd, 0xa4, 0x56, 0xfe, 0xad, 0x19, 0xfe, 0x8b, 0xd7, 0x19,
+    0x6e, 0x2a, 0x6e, 0x7e, 0xa3, 0x56, 0x13, 0xfe, 0x94, 0x79, 0xa6, 0x33, 0x7e, 0x6f, 0x18, 0xa2,
+    0x76, 0x6e, 0x6f, 0x7a, 0x29, 0xfe, 0x83, 0x14, 0x9d, 0xab, 0xa9, 0x21, 0xa8, 0x33, 0x6e, 0x6f,
+    0x0a, 0x6e, 0x1b, 0xc0, 0x20, 0x25, 0x2a, 0xc0, 0x6e, 0x3b, 0x6e, 0x6e, 0x7e, 0x6e, 0x1c, 0x6e,
+    0x7e, 0xc0, 0x6e, 0x7e, 0xc1, 0x6b, 0x7a, 0xa3, 0x75, 0x99, 0xdd, 0xfe, 0xb4, 0xf9, 0xfe, 0xde,
+    0xdc, 0xa3, 0x66, 0xc1, 0x66, 0xc1, 0x76, 0xfe, 0xc5, 0x7a, 0xfe, 0xa3, 0xd6, 0x66, 0x5a, 0xc1,
+    0x1f, 0xc4, 0x24, 0xc0, 0xfe, 0xcd, 0xdb, 0x34, 0xfe, 0x52, 0x2d, 0x8f, 0xfc, 0xdb, 0xfe, 0x19,
+    0xca, 0xfe, 0x4c, 0x57, 0x66, 0x7a, 0xc0, 0x7a, 0xc0, 0x76, 0xc0, 0x7b, 0xc0, 0x7a, 0x66, 0x7a,
+    0xc0, 0x7e, 0xa4, 0x65, 0xc1, 0x6e, 0x7f, 0x6e, 0x7e, 0x7e, 0x7a, 0x9d, 0xaa, 0x31, 0xa6, 0x54,
+    0xa2, 0x66, 0x7f, 0x6e, 0xc1, 0x6e, 0xc2, 0x6f, 0xc0, 0x56, 0xc1, 0x0b, 0x65, 0xfe, 0xc6, 0x3c,
+    0xa2, 0x67, 0x6e, 0xc0, 0x6f, 0x6e, 0xa2, 0x76, 0x6f, 0x6e, 0xc0, 0x98, 0xfd, 0xc0, 0xa7, 0x23,
+    0x35, 0x66, 0xc0, 0x66, 0x65, 0x17, 0x12, 0x9b, 0xcb, 0x96, 0xff, 0xfe, 0xc6, 0x3c, 0x66, 0x55,
+    0x62, 0x0f, 0xfe, 0x83, 0x15, 0x9b, 0xbb, 0x9d, 0x95, 0x69, 0x6e, 0x7a, 0x0d, 0x10, 0xa0, 0x8e,
+    0xc0, 0xfe, 0x8c, 0x17, 0x6f, 0x66, 0x59, 0xc3, 0x66, 0xc0, 0x7a, 0x97, 0xee, 0xa4, 0x65, 0xa3,
+    0x66, 0xc1, 0x6e, 0x7b, 0xa2, 0x66, 0x6f, 0xa2, 0x76, 0x9b, 0xbc, 0xc0, 0xfe, 0xa5, 0x5b, 0x6e,
+    0xa2, 0x76, 0x6e, 0x7e, 0x6f, 0x3e, 0x6e, 0x7e, 0x17, 0x07, 0xfe, 0x8b, 0x96, 0x9b, 0xcb, 0xaa,
+    0x11, 0xa8, 0x33, 0x0a, 0x6e, 0xc0, 0xa2, 0x77, 0x28, 0x6e, 0x39, 0xc0, 0x3e, 0x5a, 0x03, 0x6e,
+    0x6e, 0x6e, 0x7f, 0xc0, 0x29, 0x6e, 0xc0, 0x7e, 0xc0, 0x3d, 0xc0, 0x7e, 0xa4, 0x75, 0x51, 0x9b,
+    0xac, 0xfe, 0xb4, 0xf9, 0xfe, 0xd6, 0x7c, 0xa6, 0x43, 0xc1, 0x66, 0xc0, 0x66, 0xc0, 0xfe, 0xb4,
+    0x98, 0x99, 0xcd, 0xc1, 0x66, 0xc5, 0x24, 0x6e, 0xfe, 0xd6, 0x3c, 0xfe, 0x5a, 0x6e, 0xfe, 0x00,
+    0x00, 0xdc, 0xa4, 0x57, 0xfe, 0x44, 0x16, 0x7f, 0xc0, 0xa1, 0x98, 0xa4, 0x75, 0x66, 0x9c, 0xaa,
+    0x25, 0x7b, 0xc1, 0x7a, 0x66, 0x7a, 0xc0, 0xa2, 0x76, 0xa2, 0x77, 0x7e, 0x6e, 0x7f, 0x7e, 0x7e,
+    0x9d, 0xaa, 0x7e, 0xa5, 0x54, 0x26, 0x6e, 0x7e, 0x6f, 0xc1, 0x04, 0xc1, 0x09, 0xc2, 0x06, 0x01,
+    0xfe, 0xc5, 0x19, 0xc0, 0x3e, 0x6f, 0xc0, 0x6e, 0xc0, 0x7e, 0x6f, 0xa2, 0x76, 0x6e, 0x6f, 0x06,
+    0x62, 0x01, 0xc0, 0x35, 0xc0, 0x30, 0xc0, 0x66, 0x65, 0x1a, 0xfe, 0xa4, 0x17, 0x09, 0xc0, 0x56,
+    0x3c, 0x28, 0xfe, 0x93, 0xd6, 0x16, 0x9c, 0x97, 0x9f, 0x96, 0x6f, 0xc0, 0x6e, 0xc0, 0xa0, 0x9a,
+    0xa1, 0x7b, 0xa4, 0x66, 0xfe, 0x94, 0x78, 0xc0, 0x66, 0x5a, 0xc0, 0x66, 0xc3, 0x65, 0x97, 0xfe,
+    0xa5, 0x55, 0xa2, 0x67, 0xc0, 0x7a, 0xc0, 0x6e, 0x6e, 0x7f, 0xa3, 0x55, 0xa2, 0x67, 0xfe, 0x83,
+    0x76, 0x10, 0x1d, 0x6e, 0x7f, 0x6e, 0x3e, 0x03, 0x0b, 0x1a, 0xa2, 0x66, 0x7a, 0x6e, 0x99, 0xdd,
+    0xfe, 0x93, 0xf6, 0x9b, 0xcc, 0xac, 0x00, 0xa6, 0x44, 0x6e, 0x9a, 0xdc, 0x2c, 0x23, 0x01, 0xc0,
+    0x6e, 0x03, 0x6e, 0x6e, 0xc0, 0x1c, 0x6e, 0x6e, 0x7a, 0x2e, 0x6e, 0x7a, 0xc0, 0x6b, 0x6e, 0x7a,
+    0xc2, 0x65, 0xfe, 0xbd, 0x39, 0xa9, 0x21, 0xa7, 0x33, 0x66, 0xc1, 0x66, 0xc0, 0x9a, 0xcc, 0xfe,
+    0x9b, 0xb6, 0xc1, 0x66, 0xc4, 0x24, 0xc0, 0x6f, 0xaa, 0x10, 0xfe, 0x10, 0x62, 0x9d, 0x99, 0xdd,
+    0xa8, 0x25, 0xfe, 0x3b, 0xb4, 0xa4, 0x67, 0xa9, 0x52, 0xfe, 0xd7, 0x1e, 0x76, 0x06, 0xfe, 0x7c,
+    0x99, 0x25, 0x2f, 0xc0, 0x7a, 0x66, 0xc0, 0x7a, 0xc0, 0xa3, 0x75, 0xa2, 0x77, 0x6e, 0x7e, 0x62,
+    0xc0, 0xa4, 0x75, 0x12, 0x7f, 0x6e, 0xc0, 0x7e, 0x6e, 0xc0, 0x6f, 0xc1, 0x04, 0xc1, 0x09, 0x56,
+    0x66, 0xfe, 0xbc, 0xf9, 0xa2, 0x67, 0xa7, 0x13, 0x3e, 0xc0, 0x6b, 0xc0, 0x0a, 0xc0, 0x17, 0x6f,
+    0xa2, 0x76, 0x04, 0x52, 0xfe, 0xcf, 0x5f, 0x66, 0xc1, 0x65, 0xc0, 0x30, 0x7a, 0x66, 0xfe, 0xb5,
+    0x19, 0xa5, 0x54, 0xa8, 0x23, 0x66, 0x09, 0x56, 0xfe, 0xa4, 0xb8, 0xfe, 0x7a, 0xb3, 0x9d, 0xa9,
+    0x9b, 0x96, 0xa2, 0x87, 0x6e, 0x6b, 0xc1, 0xa1, 0x8b, 0xa1, 0x8a, 0xfe, 0x8b, 0xd6, 0xa7, 0x34,
+    0xc0, 0x19, 0xc0, 0x14, 0x51, 0xa2, 0x66, 0x7a, 0xc0, 0x66, 0xc0, 0x97, 0xfe, 0xa6, 0x44, 0xc3,
+    0x6e, 0x7e, 0x6f, 0x18, 0xa3, 0x56, 0x96, 0xff, 0xfe, 0xad, 0x9b, 0xa2, 0x76, 0x31, 0x6e, 0x3e,
+    0x03, 0x7e, 0x1a, 0xa2, 0x66, 0x7e, 0x38, 0x7e, 0xc0, 0x6e, 0x97, 0xfe, 0xfe, 0x9b, 0xf6, 0xc0,
+    0x12, 0xa4, 0x55, 0xc0, 0x9b, 0xcc, 0x39, 0x26, 0xa6, 0x33, 0x0b, 0x17, 0xc0, 0x6e, 0xc0, 0x6e,
+    0x6e, 0x29, 0x6e, 0x6e, 0x7a, 0x6b, 0xc0, 0x02, 0x05, 0xc3, 0x65, 0xfe, 0xbd, 0x59, 0xa5, 0x55,
+    0xa9, 0x21, 0xc0, 0x66, 0xc1, 0x66, 0xfe, 0x9b, 0xb6, 0xc1, 0x66, 0xc3, 0x24, 0xc0, 0x6f, 0x6e,
+    0x9b, 0xa9, 0xfe, 0x00, 0x00, 0xdf, 0x6e, 0xfe, 0x22, 0x0b, 0xfe, 0x4c, 0x16, 0xa7, 0x64, 0xfe,
+    0xd6, 0xfe, 0x7a, 0x9d, 0xaa, 0xfe, 0x74, 0x78, 0x2f, 0xc1, 0x7a, 0x66, 0x7a, 0xc0, 0x7a, 0x6e,
+    0x7e, 0xc0, 0xa4, 0x75, 0xa3, 0x76, 0x6e, 0x0d, 0x7e, 0x6f, 0x6e, 0x7e, 0xc0, 0x6e, 0xc1, 0x6f,
+    0xc0, 0x04, 0xc1, 0x52, 0x98, 0xfd, 0xfe, 0xee, 0xdd, 0xa4, 0x45, 0xfe, 0xbe, 0x1c, 0xc0, 0x5a,
+    0xc2, 0x7f, 0x0f, 0xa2, 0x77, 0x9c, 0xca, 0x72, 0xfe, 0xcf, 0x3f, 0xc4, 0x65, 0x7a, 0xc0, 0x9a,
+    0xdc, 0xfe, 0xac, 0x98, 0xfe, 0xde, 0xfd, 0x66, 0x22, 0x0e, 0x99, 0xdd, 0xfe, 0x82, 0xf4, 0x51,
+    0x97, 0xc8, 0x6e, 0xa2, 0x77, 0x3c, 0x6e, 0x6b, 0xc0, 0xa3, 0x7b, 0x6b, 0xfe, 0xa4, 0xd9, 0x6e,
+    0xc0, 0x56, 0x56, 0x65, 0x66, 0x1e, 0xc0, 0x19, 0xc0, 0x0d, 0x97, 0xfe, 0xfe, 0xd6, 0x7c, 0xfe,
+    0xb5, 0x19, 0x98, 0xce, 0x76, 0xc0, 0x6e, 0x6e, 0x7f, 0xa2, 0x66, 0xa3, 0x66, 0x3a, 0xfe, 0xb5,
+    0x9b, 0xa3, 0x56, 0x7e, 0x3e, 0x03, 0x7f, 0x6e, 0x7e, 0x27, 0x38, 0x7e, 0xc0, 0x7e, 0x6e, 0xc0,
+    0x6e, 0xfe, 0xce, 0x1b, 0xfe, 0x9b, 0xd6, 0xa8, 0x23, 0xaa, 0x21, 0x04, 0x09, 0x9b, 0xcc, 0x9c,
+    0xba, 0xa7, 0x23, 0x1f, 0xc0, 0x6e, 0xc1, 0x6e, 0x6e, 0xc0, 0x6e, 0x7a, 0x3d, 0x02, 0x7a, 0xc4,
+    0x00, 0x69, 0xfe, 0xbd, 0x7a, 0x7e, 0xab, 0x10, 0xc1, 0x66, 0xc0, 0xfe, 0xa3, 0xf6, 0x52, 0x66,
+    0xc3, 0x24, 0xc0, 0x6f, 0x6e, 0x3a, 0x92, 0xec, 0x8e, 0xfd, 0xe1, 0xa2, 0x68, 0xfe, 0x3b, 0x11,
+    0xad, 0x12, 0xfe, 0xce, 0xdd, 0x2a, 0x98, 0xbe, 0xfe, 0x64, 0x17, 0x7b, 0xc0, 0x7a, 0x66, 0xc0,
+    0x7a, 0xc0, 0x7a, 0xa2, 0x76, 0xa4, 0x75, 0xa2, 0x77, 0x7e, 0x7e, 0x6e, 0x15, 0x21, 0x26, 0x7a,
+    0xc0, 0x6e, 0xc0, 0x6e, 0xc0, 0x3f, 0xc1, 0x51, 0x99, 0xed, 0x2b, 0xfe, 0xff, 0xff, 0xc0, 0xfe,
+    0xbe, 0x1c, 0x52, 0xc2, 0x6e, 0x6e, 0xa2, 0x77, 0x71, 0x76, 0xfe, 0xcf, 0x1e, 0x6f, 0xc3, 0x7a,
+    0xc0, 0x79, 0x62, 0xfe, 0xac, 0x37, 0xfe, 0xde, 0xbd, 0xa3, 0x66, 0x55, 0x2a, 0x9b, 0xbc, 0xfe,
+    0x8b, 0x55, 0x9c, 0xbb, 0x9b, 0xa8, 0x98, 0xb9, 0xa4, 0x76, 0x6f, 0x7e, 0xc0, 0x6e, 0x25, 0xa2,
+    0x7a, 0xa7, 0x33, 0xfe, 0xad, 0x3a, 0xc0, 0x56, 0x5a, 0x66, 0x9b, 0xcb, 0xa5, 0x44, 0xc0, 0x66,
+    0xc0, 0x66, 0xc0, 0x97, 0xfe, 0xa7, 0x33, 0x66, 0x65, 0x66, 0xc0, 0x3f, 0x7a, 0x6f, 0xa2, 0x76,
+    0xa3, 0x56, 0x9d, 0xaa, 0xa7, 0x33, 0xa4, 0x56, 0x03, 0x7e, 0x17, 0x7e, 0xc0, 0x27, 0x6f, 0x6e,
+    0x00, 0x6e, 0x7e, 0x6e, 0x7b, 0x6e, 0xc0, 0x65, 0xfe, 0xbd, 0x7a, 0xfe, 0xa4, 0x17, 0xfe, 0xc5,
+    0xdb, 0x11, 0x1d, 0xc0, 0x2b, 0x9b, 0xcc, 0x04, 0xa6, 0x33, 0xc0, 0x5a, 0x6e, 0xc0, 0x6e, 0x7a,
+    0x6b, 0x6e, 0xc0, 0x05, 0xc4, 0x00, 0x66, 0x69, 0x12, 0x9b, 0xcc, 0xfe, 0xde, 0xbd, 0x6e, 0xc0,
+    0x11, 0xfe, 0x9b, 0xb6, 0xc0, 0x66, 0xc3, 0xa2, 0x66, 0xac, 0x10, 0xa9, 0x21, 0x1a, 0xfe, 0x9b,
+    0xf7, 0xfe, 0x20, 0xc5, 0x9a, 0xa9, 0xe3, 0xfe, 0x43, 0x52, 0xac, 0x23, 0xfe, 0xd6, 0xfe, 0x22,
+    0xfe, 0x64, 0x18, 0x7a, 0xc1, 0x7a, 0x2d, 0x30, 0xc0, 0x7e, 0xa4, 0x75, 0xa2, 0x76, 0x31, 0x7f,
+    0x08, 0x6e, 0x7e, 0xc0, 0x6f, 0x7e, 0xc1, 0x6e, 0xc0, 0x6e, 0xc0, 0x5b, 0x9d, 0xaa, 0x9b, 0xdb,
+    0xa7, 0x13, 0x6b, 0xa4, 0x65, 0xc0, 0x9b, 0xab, 0xc0, 0x5a, 0x66, 0x1d, 0x7f, 0xa2, 0x66, 0x76,
+    0x76, 0xa8, 0x02, 0x7e, 0x6f, 0x6e, 0xc0, 0x7a, 0xc1, 0x7e, 0x7a, 0xfe, 0xbd, 0x19, 0x33, 0xab,
+    0x10, 0x56, 0x65, 0x27, 0x3a, 0x97, 0xfe, 0x40, 0x92, 0xdb, 0xa4, 0x76, 0xa2, 0x77, 0x7f, 0x6e,
+    0xc0, 0x7a, 0xa5, 0x6a, 0x6b, 0xfe, 0x9c, 0x98, 0xa7, 0x44, 0x59, 0x66, 0x56, 0x9c, 0xbb, 0xc0,
+    0xa4, 0x45, 0xc0, 0x66, 0xc0, 0x65, 0x66, 0x98, 0xed, 0xfe, 0xc5, 0xfb, 0x99, 0xdd, 0x0e, 0xc0,
+    0x65, 0xc0, 0x0e, 0x6e, 0xa2, 0x76, 0xa2, 0x77, 0x31, 0x6e, 0xa8, 0x33, 0xa3, 0x55, 0x7f, 0x6e,
+    0x6e, 0x7e, 0x6b, 0x6e, 0x3d, 0x7a, 0x05, 0xc0, 0x7f, 0x7e, 0x6e, 0x7e, 0xc1, 0x9a, 0xcc, 0x02,
+    0xa7, 0x43, 0xfe, 0xd6, 0x9d, 0x7e, 0x2a, 0xc0, 0x97, 0xef, 0x9c, 0xba, 0x1d, 0x38, 0x69, 0x6e,
+    0x3d, 0xc1, 0x6e, 0xc0, 0x05, 0xc3, 0x00, 0xc0, 0x3b, 0x65, 0xc0, 0xfe, 0xb4, 0xd8, 0x9a, 0xcd,
+    0x0d, 0x26, 0xfe, 0xac, 0x58, 0x9b, 0xbb, 0x66, 0xc1, 0x5a, 0x1f, 0x3d, 0x25, 0x9d, 0xaa, 0x1b,
+    0x92, 0xee, 0x92, 0xdb, 0x98, 0xcb, 0xe4, 0xaa, 0x15, 0xfe, 0x54, 0x37, 0xac, 0x50, 0x27, 0xfe,
+    0x64, 0x38, 0x65, 0x7b, 0xc0, 0x7a, 0x2d, 0xc0, 0x7a, 0xa4, 0x74, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e,
+    0x08, 0x7e, 0x6e, 0x6e, 0x7a, 0x6f, 0xc1, 0x2e, 0xc0, 0x5a, 0x08, 0x03, 0x2b, 0x5a, 0x56, 0xc0,
+    0x66, 0x18, 0xc0, 0x66, 0xc0, 0x18, 0xa2, 0x77, 0x75, 0x2b, 0xa7, 0x14, 0x6e, 0x7e, 0x6f, 0x6e,
+    0x04, 0x6e, 0xc0, 0x7a, 0x14, 0xfe, 0xd6, 0x3c, 0xfe, 0xbc, 0xd9, 0xfe, 0xf7, 0x7e, 0x5a, 0x52,
+    0x56, 0xfe, 0xac, 0xf9, 0xfe, 0x8b, 0x14, 0xc0, 0x91, 0xdb, 0x61, 0xa4, 0x76, 0xa2, 0x67, 0x7e,
+    0x6b, 0x6e, 0xa3, 0x79, 0xa3, 0x79, 0xa2, 0x77, 0xfe, 0xb5, 0x9b, 0x20, 0x1b, 0x18, 0x66, 0x96,
+    0xfe, 0xaa, 0x02, 0x65, 0xc1, 0x3f, 0x66, 0x69, 0x97, 0xff, 0xfe, 0xb5, 0x7a, 0x31, 0x9d, 0xaa,
+    0x66, 0x0e, 0xc0, 0x7e, 0x6e, 0x6f, 0xa2, 0x76, 0x6e, 0x98, 0xde, 0xfe, 0xc6, 0x1c, 0xa4, 0x55,
+    0x6e, 0x6e, 0x7f, 0x38, 0xc0, 0x6e, 0x7a, 0x6e, 0xc0, 0x0c, 0x6e, 0xc0, 0x7e, 0x21, 0x7e, 0xc0,
+    0x7e, 0x52, 0xfe, 0xc5, 0x5a, 0x98, 0xdd, 0xfe, 0xd6, 0x7c, 0xa3, 0x66, 0x7e, 0x3e, 0x9d, 0xaa,
+    0x10, 0xa2, 0x66, 0xfe, 0xd6, 0xfd, 0x3d, 0xc1, 0x02, 0xc1, 0x05, 0xc2, 0x00, 0xc0, 0x3b, 0x66,
+    0x69, 0x2a, 0x9c, 0xab, 0xfe, 0x9b, 0xd6, 0x66, 0xc1, 0x66, 0xc0, 0x5a, 0xc1, 0x24, 0xfe, 0xde,
+    0x7c, 0x1a, 0xfe, 0x93, 0xb5, 0xfe, 0x29, 0x06, 0x98, 0xba, 0xe6, 0xa7, 0x35, 0xfe, 0x54, 0x37,
+    0xa6, 0x64, 0xac, 0x50, 0xfe, 0x64, 0x17, 0xc0, 0x7b, 0xc1, 0x7a, 0x66, 0xa1, 0x97, 0xa2, 0x86,
+    0xa2, 0x77, 0x7e, 0x7e, 0x34, 0x6f, 0x7e, 0x10, 0xc0, 0x15, 0x1d, 0x6b, 0x6e, 0xc1, 0x26, 0x34,
+    0x08, 0xfe, 0xf7, 0xbf, 0xfe, 0xc5, 0xfc, 0x55, 0x52, 0x5a, 0x66, 0xc0, 0x66, 0xc0, 0x13, 0x18,
+    0x1b, 0xa0, 0xa8, 0xfe, 0xbe, 0x9d, 0x23, 0xa2, 0x66, 0x30, 0x6e, 0x01, 0x7e, 0xc0, 0x7e, 0x19,
+    0x3e, 0xfe, 0xb4, 0x57, 0xfe, 0xef, 0x5e, 0xa2, 0x77, 0x55, 0x56, 0xfe, 0xc5, 0xba, 0xfe, 0x93,
+    0x55, 0x56, 0x94, 0xca, 0x96, 0xca, 0xa6, 0x77, 0xa2, 0x87, 0x6f, 0x7e, 0x6e, 0x55, 0xa7, 0x6a,
+    0x7f, 0x3a, 0xfe, 0xc5, 0xfb, 0x5a, 0x66, 0x56, 0x99, 0xdd, 0x3f, 0x18, 0xc1, 0x5a, 0x66, 0x04,
+    0x3f, 0x99, 0xec, 0xa2, 0x77, 0x2c, 0x27, 0x65, 0xc0, 0x16, 0x1b, 0x6e, 0x7f, 0xa2, 0x76, 0xa2,
+    0x67, 0x34, 0x9c, 0xab, 0xfe, 0xce, 0x9d, 0xa2, 0x76, 0x7e, 0x9d, 0x9a, 0xa4, 0x56, 0x7e, 0x6e,
+    0xc1, 0x0c, 0x11, 0xc2, 0x19, 0x7e, 0x7e, 0x7a, 0x31, 0x2c, 0xfe, 0xd6, 0x7c, 0xfe, 0xac, 0x37,
+    0xfe, 0xd6, 0x3b, 0xa6, 0x44, 0x3e, 0x6e, 0xc0, 0x9a, 0xdc, 0xfe, 0xc5, 0x19, 0xa9, 0x02, 0xa9,
+    0x11, 0x02, 0xc2, 0x05, 0xc1, 0x66, 0xc0, 0x38, 0x33, 0x69, 0x27, 0xc0, 0x22, 0xfe, 0xa4, 0x37,
+    0x9c, 0xab, 0x66, 0x7e, 0x1c, 0xc3, 0x39, 0x07, 0xfe, 0x9b, 0xd6, 0xfe, 0x18, 0xa3, 0x9b, 0xaa,
+    0xe7, 0xfe, 0x19, 0x88, 0xfe, 0x54, 0x37, 0xa7, 0x63, 0x66, 0x9a, 0xac, 0x25, 0xc0, 0x7b, 0xc0,
+    0x7a, 0x66, 0x7a, 0xa2, 0x96, 0xa2, 0x76, 0x7f, 0x7e, 0x7e, 0x34, 0x7f, 0x6e, 0x7e, 0x6e, 0x7a,
+    0x1d, 0x6b, 0x6e, 0x55, 0x27, 0x12, 0x2b, 0xc0, 0x28, 0x56, 0x66, 0x56, 0x0e, 0xc2, 0x13, 0x7a,
+    0x7e, 0xa7, 0x13, 0x6f, 0xa2, 0x76, 0x7e, 0xc0, 0x35, 0x7f, 0x0c, 0x6e, 0x19, 0x7a, 0xfe, 0xbc,
+    0xd9, 0xfe, 0xe6, 0x9c, 0xa9, 0x12, 0xc0, 0x51, 0x97, 0xef, 0xfe, 0x9b, 0x95, 0x0b, 0x92, 0xcb,
+    0x94, 0xdb, 0xa5, 0x88, 0xa4, 0x77, 0xa2, 0x76, 0x6f, 0x7e, 0x6e, 0x9b, 0x9a, 0xad, 0x48, 0xc0,
+    0x1e, 0xa5, 0x44, 0xc0, 0x66, 0x56, 0xfe, 0x9c, 0x57, 0xfe, 0xb5, 0xdb, 0xc0, 0x5a, 0xc1, 0x66,
+    0x66, 0x65, 0x9a, 0xdc, 0x9c, 0xbb, 0xa7, 0x33, 0x66, 0x66, 0x27, 0x69, 0x7b, 0x2f, 0xa2, 0x76,
+    0x0d, 0xc1, 0x9d, 0xaa, 0x39, 0xfe, 0xd6, 0xfd, 0xa5, 0x65, 0x05, 0x9a, 0xcc, 0xc0, 0x05, 0xc1,
+    0x11, 0xc4, 0x6e, 0xa1, 0x97, 0x7e, 0xc0, 0x7e, 0xc0, 0x9b, 0xbc, 0xfe, 0xb4, 0x98, 0xa9, 0x21,
+    0xfe, 0xe7, 0x3e, 0xc0, 0x0b, 0xc0, 0x03, 0xfe, 0xcd, 0xbb, 0x9d, 0xaa, 0x2c, 0x05, 0x5a, 0xc2,
+    0x66, 0xc0, 0x38, 0x66, 0x2c, 0x66, 0x66, 0xc0, 0x66, 0x20, 0x98, 0xde, 0x66, 0xc4, 0x21, 0xfe,
+    0xd6, 0x3c, 0x2a, 0xfe, 0x39, 0x89, 0x00, 0xe8, 0xfe, 0x32, 0xd0, 0xab, 0x04, 0x7a, 0x7a, 0xc0,
+    0x76, 0xc0, 0x7b, 0xc1, 0x7a, 0x66, 0xa1, 0x97, 0xa2, 0x86, 0x7e, 0xa2, 0x77, 0x7e, 0x34, 0x7f,
+    0x6e, 0x7a, 0x6e, 0x7e, 0x6e, 0x6b, 0x08, 0x9b, 0xbc, 0x07, 0xa6, 0x43, 0x26, 0x5a, 0xc0, 0x56,
+    0x56, 0xc0, 0x0e, 0xc1, 0x13, 0x75, 0x7f, 0xa7, 0x13, 0x0f, 0xa2, 0x77, 0x6e, 0x7e, 0x35, 0x7a,
+    0x3d, 0x7f, 0x7e, 0x7e, 0xfe, 0xcd, 0xba, 0x7a, 0xfe, 0xff, 0xdf, 0x5a, 0x66, 0x97, 0xee, 0xfe,
+    0xa3, 0xb6, 0x9d, 0x99, 0x8e, 0xec, 0x00, 0xa2, 0x99, 0xa5, 0x77, 0xa3, 0x77, 0x7e, 0x6f, 0x7e,
+    0x9d, 0x88, 0xa4, 0x69, 0xa9, 0x57, 0xa6, 0x44, 0xfe, 0xce, 0x5c, 0x6e, 0x09, 0x01, 0x96, 0xff,
+    0xa3, 0x56, 0xa6, 0x34, 0xc0, 0x66, 0xc2, 0x65, 0x52, 0x9d, 0xba, 0x21, 0xfe, 0xef, 0x3e, 0xa6,
+    0x43, 0xfe, 0xd6, 0x5c, 0x34, 0xc1, 0x3c, 0x08, 0xa2, 0x76, 0x12, 0x6e, 0x0e, 0x39, 0xa2, 0x67,
+    0xfe, 0xdf, 0x3e, 0x05, 0x7e, 0x7a, 0xfe, 0xc5, 0xfb, 0xa8, 0x22, 0x11, 0xc7, 0xa2, 0x86, 0x7e,
+    0xc0, 0x31, 0xc0, 0x29, 0x15, 0x66, 0x06, 0x6e, 0x6e, 0xc0, 0x6e, 0x19, 0xfe, 0xbc, 0xf9, 0xaa,
+    0x00, 0xa9, 0x02, 0xc1, 0x66, 0xc0, 0x66, 0x33, 0x65, 0xc0, 0x66, 0x5a, 0x66, 0xc0, 0xfe, 0xac,
+    0xb8, 0x97, 0xef, 0xc5, 0x6e, 0xfe, 0xce, 0x3c, 0xfe, 0x93, 0xb5, 0xfe, 0x00, 0x00, 0xe8, 0x6f,
+    0xfe, 0x44, 0x16, 0x7f, 0x7a, 0xc0, 0x7a, 0xc0, 0x76, 0xc0, 0x7b, 0xc0, 0x7a, 0x2d, 0xc0, 0x7a,
+    0xa2, 0x96, 0xa3, 0x75, 0x7f, 0x7e, 0x34, 0x7f, 0x08, 0x7e, 0xc0, 0x7e, 0x34, 0x9d, 0xab, 0xa8,
+    0x31, 0x26, 0xc0, 0x5a, 0xc0, 0x1b, 0xc0, 0x13, 0xc0, 0x66, 0xc0, 0x13, 0x71, 0x7e, 0xa7, 0x04,
+    0x0f, 0x7e, 0x6f, 0x7e, 0x6e, 0x38, 0xc0, 0x7e, 0x7f, 0xa2, 0x76, 0x97, 0xfe, 0xfe, 0xc4, 0xf9,
+    0xfe, 0xff, 0xbf, 0x6e, 0x29, 0xfe, 0xde, 0x5c, 0xfe, 0xa3, 0xf6, 0x98, 0xcb, 0x8d, 0xed, 0x9c,
+    0x99, 0x7a, 0xa5, 0x78, 0xa3, 0x88, 0xa2, 0x77, 0x7e, 0x6f, 0x69, 0x96, 0xab, 0xfe, 0x82, 0xf3,
+    0x7f, 0x39, 0xac, 0x00, 0xc1, 0x09, 0x3f, 0x01, 0x5a, 0xc0, 0x5a, 0xc1, 0x36, 0xc0, 0x65, 0x62,
+    0xfe, 0xa4, 0x17, 0xfe, 0xff, 0xff, 0xc0, 0x9d, 0xab, 0x05, 0xc0, 0x0d, 0xc0, 0xa2, 0x76, 0x26,
+    0x51, 0xa3, 0x66, 0x1d, 0xa2, 0x66, 0x96, 0xff, 0xc0, 0xfe, 0xdf, 0x5e, 0xc0, 0x11, 0x69, 0x01,
+    0x61, 0x0a, 0x11, 0xc2, 0x56, 0xc1, 0x11, 0x7e, 0x7e, 0x29, 0x31, 0xc1, 0xfe, 0xd6, 0x3b, 0xfe,
+    0xbc, 0xf9, 0x06, 0xa2, 0x66, 0x1c, 0xc1, 0x9d, 0xaa, 0xfe, 0xc5, 0x39, 0x0d, 0xfe, 0xd7, 0x1d,
+    0x6f, 0x66, 0xc0, 0x33, 0x27, 0xc0, 0x56, 0xc0, 0x66, 0x66, 0xc0, 0x3f, 0x9b, 0xcc, 0xc1, 0x5a,
+    0xc0, 0x1c, 0x6e, 0xc0, 0xa8, 0x33, 0xfe, 0x62, 0x6e, 0x8d, 0xfd, 0xe8, 0xa9, 0x15, 0xfe, 0x44,
+    0x57, 0x7a, 0x66, 0x24, 0x7a, 0xc0, 0x76, 0xc0, 0x7b, 0xc1, 0x7a, 0x2d, 0x7a, 0xc0, 0xa1, 0x97,
+    0x22, 0x6e, 0x7e, 0x37, 0x6f, 0x7e, 0xc0, 0x9b, 0x9b, 0x22, 0xa8, 0x31, 0x6b, 0x6e, 0xc0, 0x5a,
+    0x66, 0x1b, 0x66, 0xc0, 0x13, 0xc1, 0x71, 0x03, 0xa7, 0x03, 0xa3, 0x66, 0x6e, 0x7e, 0x7f, 0x6e,
+    0x6e, 0x33, 0x7e, 0x6e, 0xa2, 0x76, 0x9d, 0xbb, 0xfe, 0xc4, 0xd9, 0xfe, 0xf7, 0x7e, 0xa4, 0x55,
+    0x2c, 0xfe, 0xd6, 0x1b, 0xfe, 0xab, 0xf6, 0x91, 0xdd, 0x90, 0xdc, 0xc1, 0xa2, 0x99, 0xa5, 0x77,
+    0xa2, 0x77, 0x0c, 0x14, 0x6f, 0x99, 0x99, 0xa2, 0x78, 0xb1, 0x35, 0x6f, 0xfe, 0xce, 0x7c, 0xa3,
+    0x76, 0xc0, 0x56, 0x39, 0x1e, 0xa7, 0x23, 0x65, 0x5a, 0xc4, 0x66, 0x65, 0xfe, 0xa4, 0x57, 0xfe,
+    0xde, 0xbd, 0x31, 0xfe, 0xd6, 0x9c, 0x98, 0xde, 0xc1, 0x7f, 0x6e, 0xa2, 0x77, 0x9b, 0xbb, 0xa5,
+    0x44, 0x22, 0x6e, 0x38, 0x97, 0xfe, 0x51, 0xfe, 0xdf, 0x7e, 0xc1, 0x11, 0x9d, 0xc9, 0xfe, 0xbd,
+    0x5a, 0xfe, 0xd6, 0xfd, 0x11, 0x5a, 0x09, 0xc3, 0x11, 0x7e, 0x7e, 0x7e, 0x7a, 0x31, 0xc0, 0xfe,
+    0xde, 0x9c, 0xfe, 0xbc, 0xb8, 0xfe, 0xef, 0x3e, 0xa3, 0x66, 0xc0, 0x6e, 0x56, 0x10, 0xfe, 0xc5,
+    0xba, 0x98, 0xee, 0xfe, 0xce, 0x9c, 0x38, 0x33, 0x55, 0x66, 0xc0, 0x66, 0xc0, 0x15, 0xc0, 0x51,
+    0xfe, 0x93, 0x96, 0x5a, 0xc0, 0x66, 0x19, 0xc0, 0x1c, 0x6e, 0x6e, 0x7f, 0x8f, 0xec, 0x00, 0xe8,
+    0xfe, 0x19, 0xa9, 0xfe, 0x44, 0x57, 0x7a, 0x66, 0xa2, 0x87, 0xa5, 0x74, 0x66, 0x9a, 0xbd, 0x65,
+    0xc0, 0x7b, 0xc0, 0x7a, 0x2d, 0xc0, 0x7a, 0xc0, 0xa3, 0x95, 0xa3, 0x76, 0x7e, 0x6e, 0x3c, 0x34,
+    0x0b, 0xa6, 0x54, 0xa3, 0x85, 0x6f, 0x5a, 0x6e, 0x21, 0x1e, 0xc0, 0x1b, 0x66, 0xc2, 0x65, 0x34,
+    0xa6, 0x25, 0xa3, 0x65, 0xa2, 0x67, 0xa2, 0x76, 0x6e, 0x7b, 0x6e, 0x7a, 0x33, 0x7e, 0xa2, 0x76,
+    0x7a, 0xfe, 0xcd, 0x39, 0xfe, 0xee, 0xdd, 0xa9, 0x11, 0x2c, 0xfe, 0xd5, 0xba, 0xfe, 0x9b, 0xb4,
+    0xfe, 0x31, 0x06, 0x98, 0xaa, 0xc2, 0xa4, 0x99, 0xa4, 0x77, 0x7e, 0x0c, 0x7e, 0x40, 0x97, 0x9a,
+    0xad, 0x46, 0xac, 0x56, 0xaa, 0x11, 0xfe, 0xde, 0xfd, 0x7a, 0xc0, 0x52, 0xfe, 0xa4, 0x57, 0xfe,
+    0xce, 0xbd, 0x1a, 0x17, 0xc1, 0x0f, 0xc0, 0x03, 0x0f, 0x69, 0x03, 0x99, 0xed, 0xfe, 0xa4, 0x37,
+    0xfe, 0xbd, 0xfb, 0xc0, 0x66, 0x7e, 0xc0, 0x6f, 0x7e, 0xa2, 0x66, 0x0d, 0x0e, 0xa3, 0x66, 0x33,
+    0x6e, 0x6e, 0xfe, 0xc5, 0xdb, 0x66, 0xfe, 0xdf, 0x7e, 0x11, 0xa2, 0x76, 0x31, 0x52, 0x34, 0x30,
+    0xfe, 0xd7, 0x5f, 0xc1, 0x66, 0xc0, 0x09, 0xc0, 0x11, 0x7e, 0x7e, 0x7e, 0x2c, 0x31, 0xc0, 0xfe,
+    0xde, 0x9c, 0xfe, 0xbc, 0xb8, 0xfe, 0xef, 0x1d, 0xa4, 0x56, 0x24, 0xc1, 0x56, 0xfe, 0xce, 0x1b,
+    0x16, 0x30, 0xa7, 0x23, 0x66, 0x1a, 0xc0, 0x15, 0x5a, 0x66, 0x69, 0xfe, 0xad, 0x1a, 0xfe, 0x8b,
+    0x96, 0x66, 0xc1, 0x19, 0xc0, 0x7a, 0x6e, 0x6f, 0xa2, 0x86, 0xfe, 0x31, 0x26, 0x00, 0xe8, 0xa4,
+    0x57, 0xfe, 0x3c, 0x16, 0x23, 0x7a, 0xfe, 0x9e, 0x1c, 0x09, 0x65, 0x3e, 0xfe, 0x7c, 0x98, 0x9c,
+    0x9b, 0x6b, 0x7a, 0xc0, 0x7a, 0x66, 0x7a, 0xc0, 0xa2, 0x86, 0xa3, 0x96, 0x7e, 0x6e, 0x42, 0x9d,
+    0x9a, 0xfe, 0xcd, 0xfb, 0x31, 0x97, 0xef, 0x96, 0xff, 0x6b, 0x5e, 0x66, 0x5a, 0xc0, 0x1b, 0x66,
+    0xc1, 0x65, 0x2f, 0x1b, 0xa2, 0x67, 0x39, 0x0d, 0x12, 0x1a, 0x6e, 0x7a, 0x2e, 0x7e, 0x7e, 0x0b,
+    0xfe, 0xd5, 0x7a, 0xa8, 0x22, 0x31, 0x62, 0xfe, 0xcd, 0x5a, 0xfe, 0x7a, 0xf0, 0x8b, 0xfe, 0x51,
+    0xc2, 0xa2, 0x99, 0xa4, 0x88, 0xa2, 0x77, 0x7e, 0xa2, 0x67, 0xc0, 0x96, 0xaa, 0x55, 0xb2, 0x24,
+    0xa8, 0x67, 0xfe, 0xc5, 0xfb, 0x3e, 0x6e, 0xc0, 0xfe, 0xc5, 0x7a, 0x1e, 0xaa, 0x01, 0x1f, 0xc0,
+    0x5a, 0xc1, 0x66, 0x51, 0x1c, 0xc0, 0x17, 0x03, 0xfe, 0x9b, 0x96, 0xfe, 0xbd, 0xdb, 0x01, 0xc1,
+    0x06, 0x0e, 0x1a, 0xa2, 0x66, 0x0a, 0xfe, 0xce, 0xfd, 0x6f, 0x6e, 0xc1, 0x6e, 0xfe, 0xbd, 0x7a,
+    0x28, 0xfe, 0xd7, 0x7f, 0x7a, 0xa3, 0x85, 0x42, 0x42, 0xfe, 0xbd, 0x9a, 0x34, 0x35, 0x6f, 0x3a,
+    0xc0, 0x01, 0x04, 0x09, 0x11, 0x19, 0x7e, 0x29, 0x7a, 0x31, 0xc0, 0xfe, 0xd6, 0x3b, 0x99, 0xdd,
+    0xfe, 0xe6, 0xfd, 0xa5, 0x55, 0x6e, 0x29, 0x24, 0x56, 0x98, 0xdd, 0xfe, 0xac, 0x78, 0x0a, 0x1a,
+    0x5a, 0x66, 0x0d, 0xc0, 0x06, 0x9d, 0xab, 0xfe, 0x93, 0xb6, 0x52, 0xc2, 0x6e, 0x7a, 0x21, 0xc0,
+    0x7f, 0xa2, 0x76, 0xfe, 0x08, 0x42, 0x50, 0xe9, 0xa4, 0x56, 0xfe, 0x22, 0x2c, 0xaa, 0x15, 0xa6,
+    0x46, 0xaa, 0x51, 0x04, 0x17, 0x97, 0xff, 0x96, 0xaf, 0x45, 0x7b, 0xc0, 0x7a, 0x66, 0xc0, 0x7a,
+    0x7e, 0xa3, 0xa5, 0x6e, 0x9d, 0x8b, 0x56, 0xa5, 0x74, 0xfe, 0xde, 0x3c, 0x31, 0xfe, 0xe6, 0x9d,
+    0x18, 0xa2, 0x67, 0x26, 0x66, 0x1e, 0xc1, 0x5a, 0xc0, 0x65, 0x2a, 0x1e, 0x28, 0x34, 0x39, 0x0d,
+    0x7e, 0x1a, 0xc0, 0x22, 0xc0, 0x36, 0xa3, 0x75, 0xfe, 0xdd, 0xdb, 0x6e, 0x31, 0x9c, 0xbb, 0xfe,
+    0xc4, 0xf8, 0xfe, 0x49, 0xa9, 0x00, 0xc4, 0xa4, 0x99, 0xa3, 0x77, 0xa2, 0x77, 0x7e, 0x7f, 0x9a,
+    0x89, 0x00, 0xc0, 0xfe, 0x7a, 0xd1, 0xa7, 0x56, 0xfe, 0xe7, 0x3e, 0x0b, 0xc0, 0x3e, 0xfe, 0xac,
+    0x37, 0xfe, 0xd6, 0xfe, 0xc0, 0x2b, 0xc1, 0x5a, 0x69, 0x9b, 0xcc, 0x21, 0xc2, 0x66, 0x02, 0xa3,
+    0x66, 0x17, 0xc0, 0x7e, 0x6e, 0x6e, 0x6f, 0xc0, 0xfe, 0xb5, 0x39, 0x3a, 0xc2, 0x3f, 0xc1, 0x3e,
+    0xa6, 0x44, 0xfe, 0xd7, 0x5e, 0xc3, 0x98, 0xee, 0xfe, 0xb4, 0xb8, 0x1c, 0x35, 0xc1, 0x6b, 0x04,
+    0x6e, 0x11, 0x7e, 0x7e, 0x7e, 0x2c, 0x31, 0xc0, 0xfe, 0xc5, 0x7a, 0xa2, 0x66, 0xa7, 0x44, 0xa8,
+    0x32, 0x29, 0x2c, 0x56, 0x56, 0x9a, 0xcc, 0x16, 0x1b, 0xfe, 0xbd, 0xfb, 0x0d, 0x06, 0x66, 0x9d,
+    0xaa, 0xfe, 0x94, 0x17, 0x9c, 0xbb, 0x66, 0xc1, 0x19, 0xaa, 0x21, 0xaa, 0x11, 0x22, 0x99, 0xdd,
+    0xfe, 0x9b, 0xf7, 0x97, 0xb9, 0x00, 0xed, 0xa7, 0x36, 0xfe, 0x43, 0x94, 0xae, 0x10, 0xab, 0x71,
+    0x98, 0xdd, 0x97, 0xdf, 0x25, 0x6b, 0x2f, 0xc0, 0x32, 0x66, 0x7a, 0x7a, 0xa2, 0x86, 0x38, 0x3b,
+    0x27, 0xa3, 0x75, 0x7b, 0xa2, 0x66, 0xc0, 0x18, 0xa2, 0x67, 0x5a, 0xc0, 0x66, 0x1e, 0xc2, 0x99,
+    0xed, 0xa5, 0x44, 0x28, 0x6e, 0x7b, 0x01, 0x7e, 0xc0, 0x6f, 0x7e, 0xc0, 0xa2, 0x76, 0xa3, 0x66,
+    0xfe, 0xde, 0x1b, 0x9c, 0xbb, 0xfe, 0xff, 0xdf, 0x9b, 0xcc, 0xfe, 0x9b, 0xf3, 0xfe, 0x10, 0x82,
+    0x00, 0xc4, 0xa2, 0x98, 0xa4, 0x89, 0xa2, 0x77, 0x3d, 0x7f, 0x40, 0x00, 0xc1, 0xfe, 0x93, 0x54,
+    0xac, 0x00, 0xfe, 0xef, 0x7e, 0xc0, 0x13, 0xfe, 0xcd, 0xdb, 0x9d, 0xaa, 0xfe, 0xdf, 0x3e, 0x56,
+    0x56, 0xc2, 0x5a, 0x9a, 0xdc, 0x2d, 0xc0, 0x69, 0x7a, 0xc0, 0xfe, 0xb4, 0xf9, 0xfe, 0xa3, 0xb6,
+    0x01, 0x29, 0x6f, 0xc0, 0x3a, 0xc1, 0xfe, 0xb5, 0x39, 0x3a, 0xc0, 0x3f, 0xc2, 0x02, 0x3a, 0x23,
+    0xfe, 0xc6, 0x5c, 0x3f, 0xc1, 0x3a, 0xa5, 0x84, 0x98, 0xbe, 0xfe, 0xb4, 0x98, 0xfe, 0xbe, 0x3c,
+    0xa7, 0x23, 0xc1, 0x7b, 0x7e, 0x6e, 0x11, 0x7e, 0x7e, 0x29, 0x31, 0xc0, 0x9d, 0xaa, 0xfe, 0xbc,
+    0xf9, 0x96, 0xaa, 0xfe, 0xce, 0x1b, 0x1c, 0x2c, 0xc0, 0x29, 0x1c, 0x2a, 0xfe, 0xac, 0x58, 0x9d,
+    0xaa, 0xa3, 0x56, 0xa2, 0x66, 0x9d, 0xaa, 0x9b, 0xbc, 0x14, 0xc2, 0x19, 0xfe, 0xb5, 0x5a, 0xa9,
+    0x22, 0xc0, 0xfe, 0xac, 0xd9, 0x98, 0xdc, 0x95, 0xdb, 0x8e, 0xfe, 0x55, 0xee, 0xa2, 0x67, 0xfe,
+    0x43, 0xb4, 0xfe, 0xa5, 0xfc, 0xa0, 0xb8, 0x97, 0xee, 0x25, 0xc0, 0x2f, 0xc0, 0x7a, 0x66, 0xc0,
+    0x7a, 0xc0, 0x33, 0xa2, 0x86, 0xa5, 0x84, 0x37, 0x7e, 0x6f, 0x6e, 0x7e, 0xa2, 0x67, 0xc0, 0x5a,
+    0xc1, 0x5a, 0xc0, 0x99, 0xed, 0xa2, 0x67, 0xa6, 0x43, 0x6e, 0x6b, 0x6e, 0x7e, 0x6e, 0x7a, 0x6e,
+    0x6b, 0xa2, 0x76, 0xa3, 0x66, 0x99, 0xed, 0x9a, 0xdc, 0xfe, 0xff, 0xdf, 0xfe, 0xde, 0x7c, 0xfe,
+    0x5a, 0x4b, 0x8e, 0xff, 0xc6, 0xa4, 0x99, 0xa3, 0x77, 0x7f, 0x7e, 0x6e, 0x0f, 0x55, 0xc1, 0x27,
+    0x2e, 0x1c, 0x7a, 0xc0, 0xfe, 0xb4, 0x77, 0xfe, 0xdf, 0x1e, 0x6e, 0x56, 0x5a, 0xc3, 0x01, 0x35,
+    0xc3, 0xfe, 0xbd, 0x9a, 0xfe, 0xac, 0x57, 0x7f, 0xfe, 0xce, 0xfe, 0x3a, 0xc3, 0x0d, 0xfe, 0xcf,
+    0x5e, 0xc2, 0x02, 0xc2, 0x35, 0xfe, 0xb4, 0xb8, 0xfe, 0xc6, 0xbd, 0x3a, 0xc2, 0x56, 0x62, 0xfe,
+    0xb4, 0xf9, 0xa7, 0x23, 0xa9, 0x02, 0xc0, 0x32, 0x7b, 0x6e, 0x7e, 0x7e, 0x7e, 0x21, 0x7e, 0x31,
+    0xc0, 0xfe, 0xe6, 0x9c, 0xfe, 0xac, 0xb6, 0xfe, 0x39, 0x88, 0xfe, 0xb5, 0x18, 0xfe, 0xef, 0x7e,
+    0x2c, 0x31, 0x29, 0x1f, 0xfe, 0xd6, 0x3c, 0xfe, 0xac, 0x37, 0x56, 0x52, 0x55, 0x56, 0x66, 0xc1,
+    0x19, 0xaa, 0x21, 0x15, 0x65, 0xfe, 0x8b, 0xd4, 0x91, 0xec, 0x92, 0xed, 0x66, 0xf1, 0xfe, 0x22,
+    0x0b, 0xfe, 0x74, 0xf9, 0xaa, 0x71, 0x97, 0xff, 0x99, 0x7d, 0x55, 0x6b, 0x7a, 0xc0, 0x7a, 0x66,
+    0x7a, 0xc0, 0x33, 0x7e, 0xa6, 0x83, 0x6e, 0x7e, 0x0b, 0x7e, 0x6e, 0xa2, 0x67, 0xc1, 0x26, 0xc1,
+    0x9a, 0xcc, 0x62, 0x2b, 0x6e, 0x6b, 0x7e, 0x04, 0xc0, 0x0c, 0x6e, 0x6b, 0xa2, 0x76, 0xa4, 0x55,
+    0x98, 0xfe, 0x1b, 0x1f, 0xfe, 0xac, 0xf6, 0xfe, 0x18, 0xa3, 0x00, 0xc6, 0xa2, 0x88, 0xa4, 0x88,
+    0xa1, 0x98, 0x6f, 0x7e, 0x9c, 0x78, 0x9b, 0x99, 0xc1, 0xa2, 0x78, 0xfe, 0xa3, 0xd6, 0xfe, 0xde,
+    0x9c, 0xa9, 0x22, 0xc0, 0x96, 0xff, 0x96, 0xff, 0xfe, 0xe7, 0x7f, 0x52, 0x5a, 0x3c, 0xc0, 0x35,
+    0x3a, 0x35, 0x9a, 0xdc, 0x3a, 0x35, 0xc0, 0x3a, 0xc0, 0x98, 0xfe, 0xfe, 0xb4, 0x57, 0x2b, 0x9b,
+    0xcc, 0x3a, 0xc1, 0x6e, 0xc0, 0x17, 0x3f, 0xc0, 0x02, 0x3f, 0x7b, 0x02, 0xc1, 0x3f, 0x9b, 0xdc,
+    0xfe, 0xbc, 0xb8, 0xfe, 0xce, 0xfe, 0x3a, 0x56, 0xc0, 0x66, 0xc0, 0x56, 0xfe, 0xbd, 0x1a, 0xa3,
+    0x55, 0x25, 0x2d, 0xc0, 0x3c, 0x6e, 0x09, 0x7d, 0x7a, 0x7e, 0xa2, 0x76, 0x31, 0xc0, 0x20, 0x8d,
+    0xef, 0xfe, 0x10, 0x62, 0xfe, 0x93, 0xf4, 0xfe, 0xe7, 0x1e, 0xa6, 0x53, 0x31, 0x2c, 0x24, 0x26,
+    0x9c, 0xab, 0x56, 0x56, 0x65, 0x21, 0xc1, 0x7f, 0xfe, 0xd6, 0xbd, 0x7e, 0xfe, 0x93, 0xb4, 0xfe,
+    0x08, 0x41, 0x00, 0xf3, 0xfe, 0x22, 0x0b, 0xfe, 0x5c, 0x78, 0xfe, 0xc6, 0x7d, 0x97, 0xee, 0x97,
+    0x8e, 0x66, 0xc0, 0x2f, 0xc0, 0x7a, 0x66, 0xc0, 0x7a, 0xc0, 0x33, 0xa2, 0x86, 0xa5, 0x74, 0xa2,
+    0x86, 0x0b, 0x7e, 0x6e, 0xa2, 0x67, 0x2e, 0xc1, 0x2b, 0x9b, 0xbc, 0x16, 0xaa, 0x11, 0xa2, 0x76,
+    0x6f, 0xc0, 0x6e, 0x7a, 0x0c, 0x6f, 0x6e, 0xa2, 0x76, 0xa4, 0x65, 0x96, 0xff, 0x9c, 0xbb, 0xa5,
+    0x44, 0xfe, 0x5a, 0x8b, 0xfe, 0x00, 0x00, 0xc8, 0xa4, 0x99, 0xa3, 0x77, 0x7e, 0x6f, 0x55, 0x00,
+    0xc2, 0x37, 0xfe, 0xab, 0xf7, 0x0b, 0x2c, 0xc0, 0xfe, 0xbc, 0xd8, 0x2a, 0xa5, 0x45, 0x09, 0x66,
+    0x01, 0xc2, 0x99, 0xec, 0xa5, 0x45, 0x3a, 0xc3, 0x9b, 0xdc, 0xfe, 0xb4, 0x37, 0x3a, 0xfe, 0xbd,
+    0x19, 0xa8, 0x12, 0xfe, 0xcf, 0x5f, 0xc2, 0xfe, 0xc5, 0xfb, 0x09, 0xc1, 0x3a, 0x66, 0x09, 0x02,
+    0x5a, 0xc0, 0x3a, 0x98, 0xfe, 0x3c, 0xfe, 0xc7, 0x1e, 0xc0, 0x66, 0x5a, 0x66, 0xc0, 0xa6, 0x73,
+    0xfe, 0xbd, 0x7a, 0x66, 0x25, 0x2d, 0xc0, 0x7f, 0x3a, 0x02, 0x0a, 0x69, 0x7e, 0x7f, 0xa2, 0x87,
+    0x62, 0xfe, 0xc5, 0x19, 0xfe, 0x18, 0xe3, 0x0f, 0xfe, 0x6a, 0xcf, 0xfe, 0xce, 0x1b, 0x24, 0x31,
+    0x2c, 0xfe, 0xcd, 0x7a, 0x98, 0xde, 0x56, 0x65, 0x66, 0x5a, 0xc1, 0x2f, 0xfe, 0xf7, 0x9f, 0xfe,
+    0xbc, 0xf8, 0xfe, 0x08, 0x62, 0x9d, 0xa9, 0xf4, 0xfe, 0x32, 0xf0, 0xaa, 0x15, 0xfe, 0xb6, 0x3c,
+    0x96, 0xcf, 0x9a, 0x9c, 0x76, 0xc0, 0x6b, 0x7a, 0xc0, 0x7a, 0x66, 0x7a, 0xc0, 0x7a, 0x6e, 0x7a,
+    0xa6, 0x73, 0xa3, 0x76, 0x13, 0x18, 0xa2, 0x67, 0x6e, 0xc1, 0x0d, 0x99, 0xcd, 0x12, 0xa4, 0x65,
+    0x6f, 0xc0, 0x07, 0x0c, 0x6e, 0xa2, 0x67, 0x7f, 0xa3, 0x65, 0xa2, 0x66, 0xfe, 0xcd, 0x9b, 0x9b,
+    0xcb, 0x98, 0xaa, 0xfe, 0x18, 0x83, 0x00, 0xc8, 0x1e, 0xa4, 0x88, 0x7f, 0x7f, 0x6e, 0x0f, 0x00,
+    0xc2, 0xa7, 0x66, 0xfe, 0xb4, 0x57, 0xfe, 0xff, 0xdf, 0xc0, 0x9a, 0xcc, 0x2b, 0xfe, 0xef, 0x9f,
+    0x14, 0x09, 0x04, 0x5a, 0xc2, 0xfe, 0xc5, 0xdb, 0x01, 0xc2, 0x06, 0xc0, 0x9c, 0xca, 0xfe, 0xbc,
+    0x57, 0xfe, 0xcf, 0x3e, 0x66, 0xfe, 0xbc, 0xb8, 0xfe, 0xce, 0x7d, 0x06, 0x09, 0xc0, 0xfe, 0xc6,
+    0x1c, 0x09, 0xc2, 0x35, 0xc0, 0x04, 0x3a, 0xc2, 0xfe, 0xc5, 0x9b, 0x6e, 0xfe, 0xc7, 0x1e, 0x2a,
+    0xc0, 0x66, 0x66, 0xa2, 0x76, 0x42, 0x12, 0x76, 0x25, 0xc0, 0x2d, 0x35, 0x3a, 0x02, 0x7d, 0x69,
+    0x7e, 0x7f, 0xa2, 0x88, 0x97, 0xff, 0xfe, 0x83, 0x91, 0x00, 0xc0, 0xab, 0x45, 0xfe, 0xac, 0x97,
+    0xfe, 0xde, 0x9c, 0x30, 0xfe, 0xc4, 0xd9, 0x51, 0xc0, 0x56, 0xc0, 0x66, 0xc1, 0xa3, 0x65, 0xaa,
+    0x11, 0xfe, 0x5a, 0x4c, 0x00, 0xf5, 0xfe, 0x44, 0x16, 0x7f, 0xa3, 0x76, 0x9d, 0xaa, 0x27, 0xc0,
+    0x76, 0xc0, 0x7b, 0xc0, 0x7a, 0x66, 0xc0, 0x7a, 0xc0, 0x7a, 0x6e, 0x7e, 0x0b, 0x7e, 0xa2, 0x66,
+    0x7f, 0x36, 0x5a, 0x9d, 0xab, 0x0e, 0xa7, 0x33, 0x3f, 0xc0, 0x07, 0xc0, 0x11, 0x22, 0xa2, 0x67,
+    0xa3, 0x66, 0x7e, 0x9b, 0xbb, 0xfe, 0xc5, 0x1a, 0x98, 0xcb, 0x8d, 0xfe, 0x93, 0xdd, 0xca, 0xa4,
+    0x99, 0xa2, 0x88, 0x7e, 0x6f, 0x9c, 0x88, 0x00, 0xc3, 0xaa, 0x55, 0xfe, 0xc5, 0x19, 0x31, 0xc0,
+    0xfe, 0xd5, 0xba, 0xa5, 0x45, 0x1c, 0x46, 0x09, 0xc0, 0x01, 0xc1, 0x6e, 0x2b, 0x06, 0xc4, 0x9c,
+    0xcb, 0xfe, 0xbc, 0x78, 0x3a, 0x06, 0x9b, 0xdb, 0xfe, 0xc4, 0xb8, 0x1f, 0x09, 0xc0, 0xfe, 0xce,
+    0x1c, 0x01, 0xc3, 0x1f, 0x3a, 0xc3, 0x66, 0xfe, 0xc5, 0x39, 0xfe, 0xc6, 0x5c, 0x2a, 0x66, 0x20,
+    0x5a, 0x66, 0xc1, 0xfe, 0xc5, 0x7a, 0xc0, 0x20, 0xa2, 0x76, 0x6e, 0x35, 0x7d, 0x6e, 0x6d, 0x79,
+    0x7e, 0x7f, 0x31, 0xfe, 0xd5, 0xba, 0xfe, 0x21, 0x04, 0x00, 0xc0, 0x23, 0xb1, 0x24, 0xad, 0x33,
+    0xa3, 0x76, 0x7a, 0x21, 0xc1, 0x19, 0xc2, 0x0d, 0x23, 0x00, 0xf4, 0xa6, 0x36, 0xfe, 0x44, 0x57,
+    0x7a, 0x66, 0x7a, 0xc0, 0x7a, 0x76, 0xc0, 0x6b, 0x7a, 0xc0, 0x7a, 0x66, 0x30, 0xc0, 0x7a, 0x6e,
+    0xc0, 0xa5, 0x84, 0xa6, 0x63, 0x6e, 0xa2, 0x77, 0x6e, 0x2e, 0xfe, 0xa4, 0x78, 0xa3, 0x66, 0x3f,
+    0x7a, 0x07, 0x6e, 0x22, 0xa3, 0x56, 0xa2, 0x77, 0x38, 0x9b, 0xcc, 0x99, 0xec, 0xfe, 0x9b, 0xf5,
+    0x8f, 0xfd, 0x00, 0xcb, 0xa1, 0x99, 0xa5, 0x77, 0x7f, 0x7e, 0x55, 0x00, 0xc4, 0xad, 0x34, 0xfe,
+    0xd5, 0xdb, 0xfe, 0xff, 0xff, 0x62, 0xfe, 0xc4, 0xb8, 0xfe, 0xef, 0x7e, 0x14, 0x0c, 0x09, 0x01,
+    0xc2, 0x2b, 0x9a, 0xdc, 0x01, 0xc0, 0x6e, 0xc2, 0x1f, 0x29, 0x06, 0xc1, 0xfe, 0xce, 0x3c, 0xfe,
+    0xc4, 0xd9, 0x1f, 0x01, 0x04, 0x01, 0xc2, 0x3a, 0xc0, 0x15, 0x3a, 0xc3, 0x9d, 0xba, 0xfe, 0xcd,
+    0x19, 0xfe, 0xbe, 0xbd, 0x6f, 0x56, 0x66, 0xc3, 0xfe, 0xc5, 0x5a, 0xa2, 0x67, 0x25, 0x7e, 0x6e,
+    0x7d, 0x3b, 0x69, 0x69, 0x7e, 0x79, 0xa2, 0x78, 0x9d, 0xcd, 0xfe, 0x83, 0x50, 0x00, 0xc2, 0xa7,
+    0x56, 0xb0, 0x34, 0x05, 0xa2, 0x77, 0x7e, 0xc2, 0x1c, 0x19, 0x20, 0x00, 0xf5, 0xa5, 0x46, 0x23,
+    0xc0, 0x76, 0x7a, 0xc0, 0xa1, 0x98, 0xa4, 0x95, 0x9f, 0xc9, 0x9c, 0xbb, 0x9d, 0xaa, 0x46, 0xa3,
+    0x36, 0x66, 0xc0, 0x30, 0xc0, 0x7a, 0x6e, 0xa3, 0x85, 0xa8, 0x62, 0xa2, 0x77, 0x6e, 0x2e, 0x10,
+    0x7f, 0x3f, 0x07, 0x51, 0x9c, 0xab, 0x52, 0x66, 0x65, 0x62, 0x98, 0xcb, 0x97, 0xba, 0x95, 0xcc,
+    0x97, 0xcb, 0xcd, 0xa4, 0x98, 0xa2, 0x89, 0x6e, 0x7e, 0x99, 0x89, 0x00, 0xc4, 0xb0, 0x22, 0xfe,
+    0xe6, 0x9c, 0xab, 0x00, 0x1c, 0x2c, 0xfe, 0xef, 0x9f, 0x14, 0x56, 0x56, 0x01, 0xc2, 0xfe, 0xce,
+    0x1c, 0xa5, 0x34, 0xa3, 0x57, 0xc0, 0x01, 0xc2, 0x15, 0x02, 0x01, 0xc2, 0x33, 0xfe, 0xcc, 0xf9,
+    0x1f, 0x9c, 0xcb, 0x01, 0xc0, 0x3a, 0xc2, 0x2b, 0x61, 0x3a, 0xc2, 0x66, 0x04, 0x99, 0xfd, 0xfe,
+    0xbe, 0xbe, 0x1d, 0x66, 0x5a, 0x66, 0xc0, 0x15, 0x76, 0x0b, 0xa5, 0x34, 0xfe, 0xbe, 0xfe, 0x7e,
+    0x79, 0x6e, 0x7d, 0x69, 0xc0, 0x7d, 0x69, 0xa3, 0x89, 0xfe, 0xd5, 0x59, 0x37, 0x00, 0xc3, 0xa6,
+    0x67, 0xac, 0x34, 0xaa, 0x45, 0xa4, 0x77, 0x6e, 0x7a, 0x51, 0x90, 0xdc, 0x00, 0xf7, 0xfe, 0x33,
+    0x73, 0xa7, 0x35, 0x7a, 0x21, 0x7a, 0xa5, 0x75, 0xa8, 0x62, 0xa1, 0xa7, 0x9b, 0xcc, 0x9a, 0xcc,
+    0x99, 0xee, 0x59, 0xa2, 0x28, 0xc0, 0x30, 0xc0, 0x7a, 0x38, 0x7a, 0xa2, 0x76, 0x7e, 0xa4, 0x65,
+    0x9d, 0xab, 0x9d, 0x9a, 0xfe, 0xcd, 0xdb, 0x12, 0x9a, 0xcd, 0x9d, 0xaa, 0xc0, 0x99, 0xba, 0x97,
+    0xba, 0x97, 0xcb, 0x98, 0xcb, 0x00, 0xcf, 0x0f, 0xa4, 0x99, 0x7f, 0x7e, 0x9d, 0x77, 0x00, 0xc5,
+    0xb3, 0x11, 0xfe, 0xf7, 0x3e, 0xa6, 0x33, 0xfe, 0xd5, 0x5a, 0xfe, 0xe6, 0xdd, 0x14, 0x56, 0x56,
+    0xc0, 0x56, 0xc0, 0x69, 0xc0, 0xfe, 0xcd, 0xbb, 0xfe, 0xc6, 0xfe, 0xc1, 0x7a, 0xc0, 0x35, 0xc0,
+    0x3f, 0x9b, 0xdb, 0x35, 0xc1, 0x3c, 0xc0, 0xfe, 0xcd, 0x19, 0x66, 0xa5, 0x34, 0x35, 0xc5, 0x99,
+    0xfd, 0x35, 0xc1, 0x3a, 0x35, 0x32, 0x1d, 0x5f, 0xfe, 0xb6, 0xbe, 0x56, 0x66, 0xc2, 0x7e, 0xa2,
+    0x96, 0x02, 0xfe, 0xc6, 0x1c, 0xa7, 0x12, 0x6e, 0x7e, 0x6d, 0x79, 0xc0, 0x7d, 0x69, 0x7f, 0xfe,
+    0xde, 0x3b, 0xfe, 0x7b, 0x0f, 0x00, 0xc6, 0xa3, 0x67, 0x0d, 0x6e, 0x0f, 0x00, 0xf8, 0xa4, 0x57,
+    0xfe, 0x33, 0x72, 0x23, 0x76, 0x7a, 0xc0, 0x7a, 0x7b, 0xa4, 0x75, 0xa1, 0xa7, 0x9e, 0xc9, 0x9a,
+    0xed, 0x4a, 0xa1, 0x38, 0xc0, 0x7a, 0xc0, 0x7a, 0x38, 0x3b, 0xc1, 0x7e, 0xa4, 0x65, 0x1f, 0x06,
+    0xc0, 0x91, 0xec, 0x91, 0xfc, 0x00, 0xd3, 0xa3, 0x99, 0xa3, 0x87, 0x6f, 0x55, 0x00, 0xc6, 0xb6,
+    0x00, 0xfe, 0xff, 0xbf, 0x51, 0x02, 0xfe, 0xef, 0x7e, 0x56, 0x56, 0x5a, 0x35, 0xc0, 0x66, 0x5a,
+    0x66, 0xfe, 0xc5, 0xbb, 0xa8, 0x03, 0x66, 0x23, 0xc0, 0x28, 0xc0, 0x30, 0xfe, 0xcd, 0x9b, 0x6e,
+    0x30, 0xc3, 0xfe, 0xcd, 0x5a, 0xa2, 0x66, 0x9b, 0xdc, 0xfe, 0xce, 0x5c, 0x35, 0xc4, 0x30, 0x99,
+    0xfc, 0x35, 0xc0, 0x6e, 0xc0, 0x35, 0x28, 0x02, 0xfe, 0xbe, 0x1c, 0xa4, 0x36, 0x56, 0xc2, 0xa2,
+    0x76, 0xa5, 0x74, 0x98, 0xde, 0x02, 0xfe, 0xc6, 0x7c, 0x2b, 0x7e, 0x69, 0x7d, 0xc0, 0x6d, 0x79,
+    0xc0, 0xfe, 0xde, 0x9a, 0xfe, 0xc4, 0xd8, 0xfe, 0x18, 0xa3, 0x9b, 0xaa, 0xfd, 0xc7, 0xa9, 0x15,
+    0xaa, 0x15, 0xa3, 0x67, 0x61, 0x61, 0xc0, 0xa3, 0x67, 0xa9, 0x36, 0xa3, 0x87, 0xa2, 0xc6, 0x9d,
+    0xca, 0xa0, 0x39, 0x46, 0x7a, 0xc0, 0x7a, 0x38, 0xc0, 0x3b, 0xc0, 0x03, 0xc1, 0x65, 0xfe, 0x29,
+    0x47, 0x96, 0xdb, 0xd5, 0xa5, 0x99, 0x7f, 0x6e, 0x0f, 0x00, 0xc6, 0xfe, 0x83, 0x50, 0xfe, 0xff,
+    0xff, 0xfe, 0xe6, 0x7c, 0x9d, 0xaa, 0xaa, 0x01, 0x46, 0x66, 0x5a, 0x35, 0x66, 0x5a, 0x28, 0x9d,
+    0xba, 0x9c, 0xca, 0xa4, 0x36, 0x0a, 0x0f, 0x12, 0x6e, 0xa3, 0x66, 0x1c, 0xfe, 0xcd, 0x39, 0x3f,
+    0xa6, 0x24, 0xc2, 0x30, 0xfe, 0xcd, 0xdb, 0x30, 0xfe, 0xcd, 0xbb, 0x65, 0x30, 0xc4, 0x35, 0x04,
+    0xa3, 0x56, 0x35, 0x3a, 0xc1, 0x35, 0x9a, 0xec, 0x3d, 0xfe, 0xb6, 0x5d, 0x10, 0xc2, 0x6e, 0x7a,
+    0x6e, 0x9c, 0xda, 0x02, 0xfe, 0xc6, 0xdd, 0xa2, 0x66, 0x2c, 0x6e, 0x79, 0x69, 0x6d, 0x7a, 0x9a,
+    0xee, 0x3d, 0x90, 0xdd, 0xfe, 0x00, 0x00, 0xfd, 0xce, 0x6e, 0xfe, 0x32, 0x0c, 0xfe, 0x6c, 0x38,
+    0xa3, 0xd5, 0x03, 0x9e, 0x6a, 0xc0, 0x7a, 0xc0, 0x7e, 0xa2, 0x86, 0xc0, 0x52, 0xc0, 0x03, 0x51,
+    0xfe, 0x29, 0x26, 0x00, 0xd5, 0xa3, 0x88, 0xa3, 0x99, 0x6e, 0x2d, 0x00, 0xc7, 0xfe, 0x94, 0x12,
+    0xfe, 0xff, 0xff, 0xfe, 0xd5, 0x7a, 0xfe, 0xe6, 0xfd, 0xa2, 0x67, 0x56, 0x5a, 0x56, 0xc0, 0x66,
+    0x28, 0x23, 0x99, 0xfc, 0x3e, 0x6b, 0xc1, 0x0a, 0x0f, 0x17, 0x12, 0x3d, 0xfe, 0xc6, 0x5c, 0x23,
+    0xc0, 0x7a, 0x6e, 0xc0, 0x99, 0xfd, 0x2b, 0xc0, 0xfe, 0xcd, 0x9a, 0xa7, 0x14, 0x2b, 0xc0, 0x30,
+    0xc1, 0x35, 0xc0, 0xfe, 0xcd, 0xbb, 0x35, 0x6e, 0xc3, 0x1d, 0x52, 0xfe, 0xae, 0x7e, 0xc2, 0x6e,
+    0x18, 0x6e, 0x25, 0xfe, 0xc5, 0xdb, 0x9d, 0xca, 0xfe, 0xc7, 0x1d, 0x2c, 0x6e, 0x79, 0x69, 0x6e,
+    0x27, 0x9a, 0xde, 0x3d, 0x45, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xcf, 0xfe, 0x3a, 0x4d, 0xb0, 0x03,
+    0xa1, 0x97, 0x9d, 0x8b, 0x66, 0x7a, 0xa5, 0x74, 0x18, 0xa3, 0x66, 0xa2, 0x67, 0x97, 0xce, 0x99,
+    0xbe, 0x50, 0xfe, 0x20, 0xe5, 0x00, 0xd6, 0xa6, 0x88, 0x7f, 0x40, 0x00, 0xc8, 0xfe, 0xa4, 0xb4,
+    0xfe, 0xf7, 0x9f, 0xfe, 0xcd, 0x39, 0xfe, 0xef, 0x5e, 0x42, 0x66, 0x5a, 0x5a, 0x66, 0x28, 0x23,
+    0x55, 0xfe, 0xc5, 0x9b, 0xa4, 0x25, 0x66, 0xc0, 0x36, 0x05, 0x6e, 0x0f, 0x9c, 0xdb, 0x3d, 0xfe,
+    0xc6, 0x7d, 0x17, 0xc1, 0x6e, 0x7a, 0x9b, 0xdc, 0xa5, 0x35, 0x2b, 0x0b, 0xfe, 0xd5, 0x9a, 0xfe,
+    0xce, 0x9d, 0x2b, 0x30, 0xc2, 0x35, 0x9a, 0xec, 0x04, 0x35, 0x3a, 0xc2, 0x30, 0xfe, 0xcd, 0x19,
+    0xfe, 0xbd, 0xfc, 0x10, 0xc2, 0x7e, 0x1d, 0x6e, 0x2a, 0xfe, 0xcd, 0x5a, 0xa5, 0x24, 0xfe, 0xc7,
+    0x3c, 0x7e, 0x69, 0x76, 0x99, 0xfe, 0x9c, 0xbb, 0x66, 0x3d, 0xc0, 0x8c, 0xcd, 0xfe, 0x00, 0x00,
+    0xfd, 0xcf, 0x6f, 0xfe, 0x63, 0xd6, 0xa3, 0x77, 0x32, 0x2d, 0xa5, 0x84, 0xa7, 0x72, 0x7e, 0xa3,
+    0x56, 0xc0, 0x08, 0x9c, 0xaa, 0xfe, 0x18, 0xc5, 0x00, 0xd6, 0xa2, 0x88, 0x24, 0x59, 0x00, 0xc9,
+    0xfe, 0xb5, 0x36, 0xac, 0x33, 0x9a, 0xcc, 0xa9, 0x02, 0x51, 0x5b, 0xc0, 0x5a, 0xc0, 0x23, 0x56,
+    0x61, 0xfe, 0xc5, 0x7a, 0xa3, 0x37, 0x56, 0x2c, 0x6e, 0x7e, 0x6e, 0x0a, 0x9a, 0xfb, 0x9d, 0xcb,
+    0x12, 0xc1, 0x17, 0xc0, 0x7a, 0x9b, 0xdc, 0x1f, 0x26, 0x3b, 0x1f, 0x18, 0x1f, 0xa2, 0x67, 0xc3,
+    0x35, 0x18, 0x30, 0xa2, 0x66, 0xc0, 0x6e, 0xc0, 0x3a, 0x04, 0x02, 0xfe, 0xb6, 0x5d, 0x10, 0xc1,
+    0x7e, 0x1d, 0x22, 0x7e, 0x71, 0x3d, 0xfe, 0xc6, 0x9c, 0xa6, 0x32, 0x9d, 0xba, 0xfe, 0xcd, 0x39,
+    0x3d, 0xc3, 0x9a, 0x78, 0x00, 0xfd, 0xd0, 0xfe, 0x3a, 0x4d, 0xae, 0x05, 0xc0, 0xa0, 0xa8, 0x13,
+    0x7e, 0xa2, 0x67, 0x5e, 0xfe, 0x94, 0x78, 0x98, 0xcc, 0xfe, 0x10, 0x83, 0x00, 0xd7, 0xa5, 0x88,
+    0xa2, 0x88, 0x9a, 0x88, 0x00, 0xc9, 0xfe, 0xb5, 0x77, 0xa4, 0x98, 0xa5, 0x44, 0xa3, 0x46, 0x52,
+    0xc0, 0x2b, 0xc0, 0x23, 0x66, 0x55, 0x9d, 0xba, 0x9b, 0xdc, 0x4e, 0xc0, 0x6e, 0x7f, 0x6e, 0x39,
+    0x3e, 0xfe, 0xc5, 0x3a, 0x21, 0xa6, 0x24, 0x12, 0xc1, 0x1a, 0xc0, 0x9b, 0xdb, 0x1f, 0xc0, 0x26,
+    0x2b, 0x9f, 0xb8, 0x97, 0xfe, 0x2b, 0x30, 0xc3, 0x04, 0x65, 0xa8, 0x03, 0x6e, 0xc0, 0x3f, 0xc0,
+    0x3a, 0x13, 0x21, 0xfe, 0xae, 0x7e, 0xc0, 0x6e, 0xc0, 0x7e, 0x6e, 0x2a, 0x6e, 0xfe, 0xc6, 0x1b,
+    0x07, 0xfe, 0xce, 0xfc, 0x02, 0x66, 0xc4, 0xa3, 0x45, 0x00, 0xfd, 0xd0, 0xa3, 0x67, 0x14, 0xa2,
+    0x78, 0xa3, 0xa5, 0xa8, 0x72, 0xc0, 0x9c, 0x8b, 0x99, 0xae, 0x93, 0xeb, 0x0c, 0x00, 0xd8, 0x29,
+    0x9b, 0x88, 0x00, 0xca, 0xfe, 0xbd, 0x77, 0x07, 0xfe, 0xef, 0x1e, 0x25, 0x56, 0xc0, 0x1f, 0xc0,
+    0x17, 0x5a, 0x62, 0x9a, 0xec, 0x5a, 0x56, 0xc0, 0x6e, 0x2c, 0x6e, 0x39, 0xc0, 0xfe, 0xcc, 0xf9,
+    0xa7, 0x03, 0xa4, 0x46, 0xc0, 0x12, 0x7a, 0x1a, 0xc0, 0x9b, 0xdc, 0x15, 0x1f, 0xc0, 0x7f, 0xa5,
+    0x64, 0x33, 0xc0, 0xa7, 0x14, 0xc2, 0x30, 0xc0, 0xfe, 0xcd, 0x5a, 0x30, 0x6e, 0x6e, 0xc0, 0x3f,
+    0xc0, 0x1f, 0x3d, 0xfe, 0xb6, 0x3d, 0x10, 0x6e, 0xc0, 0x7e, 0x6e, 0x2a, 0xa3, 0x85, 0xa1, 0x97,
+    0xfe, 0xcd, 0x19, 0x3d, 0x66, 0xc5, 0x3d, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xd0, 0xa5, 0x57, 0xfe,
+    0x74, 0x16, 0x2f, 0x32, 0x61, 0x96, 0xda, 0x92, 0xfb, 0x9a, 0xca, 0xd9, 0x7f, 0xa2, 0x98, 0x00,
+    0xcb, 0xfe, 0xbd, 0x38, 0xa0, 0xba, 0x03, 0x9b, 0xbc, 0xc0, 0x1a, 0xc0, 0x5a, 0xc0, 0x56, 0x52,
+    0xfe, 0xc5, 0x5a, 0x18, 0x62, 0xc0, 0x18, 0x7f, 0x2c, 0xa2, 0x76, 0x34, 0x3d, 0x39, 0x7e, 0x6f,
+    0x7e, 0x1a, 0xc1, 0x9c, 0xcb, 0xa2, 0x66, 0x1f, 0x7a, 0xc0, 0x2b, 0x69, 0x13, 0x15, 0x1f, 0xc1,
+    0x24, 0x2b, 0x33, 0xc0, 0x35, 0xc0, 0x6e, 0xc2, 0xfe, 0xcd, 0x9a, 0x0b, 0xfe, 0xae, 0x9e, 0xc1,
+    0x7e, 0x6e, 0x6e, 0x7e, 0x7a, 0xfe, 0xc5, 0x7a, 0x38, 0xc7, 0xfe, 0x18, 0xa3, 0x00, 0xfd, 0xd1,
+    0xa7, 0x55, 0xa5, 0x66, 0x9a, 0xab, 0x00, 0xeb, 0xfe, 0xbc, 0xb7, 0xa9, 0x33, 0xfe, 0xe7, 0x1e,
+    0x9c, 0xab, 0x65, 0x5b, 0xc0, 0x12, 0xc0, 0x05, 0x31, 0x9a, 0xfc, 0xa2, 0x47, 0x0e, 0xc0, 0x13,
+    0xa2, 0x76, 0x0d, 0xfe, 0xff, 0xff, 0x9a, 0xcd, 0xfe, 0xcd, 0x19, 0x01, 0x6e, 0x7b, 0x15, 0xc0,
+    0x1a, 0xc0, 0x3f, 0xc0, 0xa5, 0x34, 0x7a, 0xc1, 0x1f, 0x1d, 0x99, 0xed, 0x1a, 0xc0, 0x1f, 0xc2,
+    0x02, 0x24, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0x1f, 0x3d, 0xfe, 0xbd, 0xfc, 0xa5, 0x15, 0x6e, 0x7a,
+    0x6e, 0x27, 0x2f, 0xc0, 0xfe, 0xc5, 0x7a, 0x38, 0xc7, 0xfe, 0x29, 0x05, 0x00, 0xfd, 0xfd, 0xc3,
+    0xfe, 0xb4, 0x56, 0xfe, 0xde, 0x5c, 0x3e, 0x9c, 0xab, 0x11, 0x09, 0x5a, 0x0d, 0x55, 0x39, 0x1e,
+    0x51, 0x13, 0x0e, 0xc0, 0x13, 0x18, 0x01, 0x31, 0x99, 0xdd, 0xfe, 0xc5, 0x5a, 0x01, 0x09, 0x6f,
+    0xc2, 0x6e, 0x04, 0x33, 0xa6, 0x34, 0xc0, 0x1f, 0xc0, 0xa3, 0x76, 0x31, 0x9a, 0xdd, 0x01, 0x12,
+    0x17, 0xc1, 0x6e, 0xfe, 0xcd, 0x9b, 0x33, 0xa8, 0x03, 0x35, 0xc0, 0x30, 0x69, 0x66, 0xfe, 0xc5,
+    0xbb, 0x9a, 0xec, 0xfe, 0xb6, 0x9e, 0x6e, 0xc0, 0x6e, 0x27, 0x7f, 0x2f, 0x10, 0x38, 0xc4, 0x5a,
+    0xc1, 0xfe, 0x41, 0x88, 0x00, 0xfd, 0xfd, 0xc3, 0xfe, 0xac, 0x15, 0x25, 0x3b, 0x9c, 0xbb, 0x61,
+    0x5a, 0x01, 0x3c, 0x39, 0x2c, 0x9b, 0xfb, 0xa2, 0x47, 0x0e, 0xc1, 0x13, 0x6e, 0x20, 0x34, 0x9c,
+    0xdb, 0x6e, 0x04, 0x09, 0xc0, 0x15, 0xc2, 0x04, 0x9d, 0xba, 0x1d, 0x1a, 0xc0, 0x15, 0xa2, 0x76,
+    0xa9, 0x41, 0x9a, 0xbd, 0x10, 0x0d, 0x12, 0xc1, 0x17, 0x06, 0x02, 0xfe, 0xc6, 0xdd, 0x30, 0x29,
+    0x24, 0x56, 0xc0, 0x12, 0x3a, 0xa5, 0x35, 0xfe, 0xb6, 0xbe, 0xc0, 0x6e, 0x6f, 0x36, 0xc0, 0xfe,
+    0xc5, 0xdb, 0x35, 0xc3, 0x07, 0x3a, 0x35, 0xc0, 0xfe, 0x39, 0x88, 0x00, 0xfd, 0xfd, 0xc3, 0xfe,
+    0x9b, 0xb2, 0xfe, 0xde, 0xdd, 0xa3, 0x56, 0x9b, 0xcc, 0x0c, 0x04, 0x01, 0x34, 0x66, 0x20, 0x9b,
+    0xfb, 0x13, 0x0e, 0xc1, 0x13, 0x1b, 0x20, 0x2f, 0x10, 0xa4, 0x55, 0x04, 0x6e, 0xc1, 0x15, 0xc1,
+    0x04, 0x9b, 0xdc, 0x1a, 0xc0, 0x15, 0x01, 0x3c, 0xc0, 0x01, 0x3f, 0x3c, 0x01, 0x06, 0x0d, 0x12,
+    0x17, 0x0b, 0x3c, 0x1c, 0xc1, 0x17, 0xc0, 0x12, 0x21, 0x35, 0xfe, 0xbe, 0x5d, 0xa3, 0x46, 0x22,
+    0x6b, 0x6e, 0x36, 0x0a, 0x35, 0xc1, 0x0b, 0xfe, 0xcf, 0x1d, 0xa3, 0x66, 0x9d, 0xba, 0x35, 0x99,
+    0xbb, 0xfe, 0x08, 0x41, 0x51, 0xfd, 0xfd, 0xc3, 0xfe, 0x83, 0x10, 0xfe, 0xde, 0xdd, 0xa3, 0x56,
+    0x9b, 0xcc, 0x0c, 0x04, 0x3c, 0x66, 0x55, 0x19, 0x61, 0x16, 0x13, 0xc2, 0x1b, 0x28, 0x37, 0x0b,
+    0xa7, 0x23, 0x04, 0xc0, 0x09, 0xc1, 0x11, 0x6b, 0x09, 0xfe, 0xcd, 0x5a, 0x15, 0x66, 0x01, 0x3c,
+    0x34, 0xc1, 0x9c, 0xda, 0x21, 0x39, 0x6e, 0x06, 0xc0, 0x12, 0x2b, 0x0b, 0x17, 0xc0, 0x12, 0xc0,
+    0x06, 0xc0, 0x01, 0x3a, 0xa3, 0x56, 0xfe, 0xbe, 0x9e, 0x5e, 0x22, 0x6f, 0x7a, 0x26, 0x35, 0xc1,
+    0x1a, 0xa6, 0x23, 0x07, 0xfe, 0xcd, 0xbb, 0xfe, 0xb4, 0x56, 0xfe, 0x10, 0x62, 0x9d, 0x99, 0xfd,
+    0xfd, 0xc4, 0xb2, 0x12, 0x18, 0xa7, 0x23, 0x9a, 0xdc, 0x61, 0x04, 0x3c, 0x65, 0x28, 0x9a, 0xfd,
+    0xa2, 0x56, 0x16, 0x5a, 0x16, 0xc0, 0x6e, 0x7e, 0x28, 0x37, 0x99, 0xfc, 0xa8, 0x13, 0x04, 0xc2,
+    0x09, 0x0c, 0x11, 0x0c, 0x06, 0x09, 0x01, 0x3c, 0x34, 0x2f, 0xc0, 0x2a, 0x11, 0x06, 0x34, 0x39,
+    0x3e, 0xc0, 0x6e, 0x7a, 0x35, 0x3c, 0x03, 0xc0, 0x3e, 0xc2, 0x21, 0x99, 0xfd, 0x34, 0xa5, 0x35,
+    0x5e, 0xc0, 0x10, 0x30, 0xc2, 0xfe, 0xcf, 0x1f, 0xa2, 0x66, 0x79, 0x35, 0xfe, 0x49, 0xea, 0x00,
+    0xfd, 0xfd, 0xc5, 0xa9, 0x55, 0x24, 0xfe, 0xdf, 0x5f, 0x9b, 0xcb, 0x9d, 0xba, 0x04, 0x3f, 0x2b,
+    0x23, 0x35, 0xa6, 0x04, 0x16, 0xc1, 0x1b, 0x20, 0x23, 0x04, 0xa8, 0x42, 0xfe, 0xc5, 0x19, 0xa8,
+    0x13, 0xc2, 0x04, 0xc0, 0x0c, 0xc0, 0x09, 0x3a, 0x04, 0x56, 0x34, 0x28, 0x20, 0xc0, 0x28, 0xc0,
+    0x35, 0x2f, 0x34, 0x39, 0x3e, 0xc0, 0x03, 0x0b, 0xa2, 0x56, 0x39, 0xc2, 0x34, 0x39, 0xc0, 0x3a,
+    0x5a, 0x0a, 0xa2, 0x67, 0x0d, 0x30, 0xc2, 0x5a, 0xfe, 0xc6, 0xbe, 0xa5, 0x44, 0x9c, 0xca, 0xfe,
+    0xb4, 0x77, 0xfe, 0x00, 0x21, 0x00, 0xfd, 0xfd, 0xc6, 0xfe, 0xbc, 0x97, 0xfe, 0xd7, 0x3e, 0x9d,
+    0xba, 0x9c, 0xcb, 0x3f, 0x66, 0x2b, 0x10, 0x61, 0xa4, 0x26, 0xc0, 0x16, 0xc0, 0x1b, 0x7e, 0xc0,
+    0x2b, 0x26, 0x0b, 0x33, 0x6e, 0x6b, 0xc1, 0x04, 0xc0, 0x0c, 0x09, 0x35, 0x3c, 0x66, 0x28, 0x20,
+    0x1b, 0xc1, 0x20, 0x9a, 0xfc, 0x19, 0x2f, 0x34, 0x39, 0xc1, 0x1e, 0x9a, 0xec, 0xfe, 0xbd, 0xfb,
+    0x28, 0xc4, 0x9d, 0xba, 0x9a, 0xed, 0x23, 0xc0, 0xfe, 0xbc, 0xb8, 0x2d, 0xc3, 0x2b, 0x06, 0x09,
+    0xfe, 0x8b, 0x72, 0x00, 0xfd, 0xfd, 0xc7, 0xfe, 0x7b, 0x0f, 0x04, 0xa5, 0x45, 0x9b, 0xdb, 0x3f,
+    0x3a, 0x2b, 0x99, 0xfd, 0x12, 0x1e, 0xc0, 0x1b, 0xc0, 0x1e, 0x23, 0x7a, 0x2b, 0x15, 0x10, 0x33,
+    0xc2, 0x6e, 0x3f, 0x04, 0xc1, 0x35, 0x2b, 0x28, 0x20, 0x1b, 0xc3, 0x9c, 0xdb, 0x08, 0x20, 0x6f,
+    0x34, 0xc0, 0x55, 0x20, 0x2d, 0x12, 0x20, 0xc0, 0x23, 0xc3, 0x32, 0xc1, 0x2d, 0xc1, 0x65, 0xc1,
+    0x32, 0xfe, 0xcf, 0x1e, 0xfe, 0xc5, 0xfc, 0x99, 0xcb, 0x00, 0xfd, 0xfd, 0xc7, 0xaa, 0x55, 0x3a,
+    0x27, 0x07, 0x3f, 0x33, 0x9d, 0xab, 0x9a, 0xec, 0x23, 0x1e, 0xc3, 0x23, 0x26, 0xab, 0x10, 0xfe,
+    0xd5, 0xdb, 0x15, 0xa3, 0x66, 0xc1, 0x33, 0xc1, 0x3f, 0xc1, 0x3a, 0x26, 0x23, 0x1b, 0x13, 0xc1,
+    0x16, 0xa8, 0x32, 0x2e, 0x99, 0xdd, 0x20, 0xc3, 0x1b, 0x37, 0x6e, 0x1b, 0xc4, 0x23, 0x0d, 0x9a,
+    0xec, 0xc7, 0x08, 0x26, 0xa2, 0x56, 0x00, 0xfd, 0xfd, 0xc8, 0xfe, 0xb4, 0x77, 0x2e, 0x07, 0x3f,
+    0x33, 0x99, 0xed, 0x6b, 0x26, 0x23, 0x1e, 0xc1, 0x7a, 0x26, 0xc0, 0x2e, 0x3f, 0x21, 0x2e, 0xc3,
+    0x33, 0xc2, 0x3c, 0x1e, 0x1b, 0x16, 0x56, 0xc0, 0x69, 0xc0, 0x28, 0x19, 0x32, 0x1b, 0xc2, 0x16,
+    0x69, 0x9d, 0xbb, 0x9d, 0xca, 0xa5, 0x24, 0xc0, 0x0f, 0xc2, 0x1b, 0xc0, 0xfe, 0xb4, 0x99, 0x69,
+    0xc8, 0xa3, 0x23, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xc8, 0xfe, 0x83, 0x30, 0x3a, 0x0c, 0x52, 0x33,
+    0x2d, 0xa6, 0x33, 0x26, 0xc1, 0x21, 0xc0, 0x26, 0xc2, 0x32, 0xa7, 0x33, 0xc3, 0x2e, 0xc2, 0x2b,
+    0x3c, 0x19, 0x5a, 0x0e, 0x5a, 0x65, 0x7a, 0x07, 0xc1, 0x1e, 0x16, 0xc0, 0x0f, 0x07, 0xc0, 0x02,
+    0x7a, 0x1e, 0xa4, 0x46, 0x05, 0xc2, 0x0a, 0x0f, 0x1b, 0x9b, 0xdb, 0x1e, 0xc0, 0x66, 0xc0, 0x1e,
+    0xa8, 0x13, 0x17, 0x1f, 0x9a, 0xdd, 0x19, 0x8f, 0xdc, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xc8, 0xb0,
+    0x23, 0x2d, 0xab, 0x00, 0xc0, 0x15, 0x2d, 0x2e, 0x26, 0xc4, 0x21, 0x7a, 0xc0, 0x2d, 0x24, 0xc2,
+    0x29, 0xc2, 0x26, 0xc0, 0x03, 0x0a, 0xc0, 0x07, 0x3f, 0xc1, 0x7a, 0xc0, 0x07, 0x25, 0x02, 0xc1,
+    0x66, 0xc2, 0x25, 0x6e, 0x3d, 0xc2, 0x7e, 0x0a, 0x16, 0x0a, 0x19, 0xc2, 0x23, 0x1c, 0xa2, 0x77,
+    0x65, 0xfe, 0xb5, 0x1a, 0x9a, 0xdc, 0xfe, 0x10, 0x82, 0x9c, 0xaa, 0xfd, 0xfd, 0xc8, 0xab, 0x45,
+    0xfe, 0xbc, 0x98, 0x29, 0xa3, 0x66, 0x97, 0xee, 0x7e, 0x2e, 0xc0, 0x29, 0xc3, 0x66, 0xc0, 0x65,
+    0x2d, 0xa7, 0x32, 0xc3, 0x24, 0x5a, 0xc2, 0x03, 0x05, 0x07, 0x56, 0x66, 0xc2, 0x7e, 0xc0, 0x9c,
+    0xcb, 0xa2, 0x66, 0x6b, 0xc0, 0x31, 0xc0, 0x66, 0xc0, 0x62, 0x69, 0x2c, 0xc0, 0x31, 0x38, 0x3d,
+    0x05, 0x0f, 0x6f, 0xfe, 0xac, 0x78, 0xc1, 0x27, 0xfe, 0xc6, 0x7d, 0x1c, 0x7e, 0x2a, 0x11, 0x8c,
+    0xfd, 0x00, 0xfd, 0xfd, 0xc9, 0x1d, 0xb6, 0x01, 0x15, 0x33, 0x1e, 0xa8, 0x22, 0x2e, 0xc1, 0x29,
+    0xc0, 0x66, 0x18, 0x29, 0xa4, 0x65, 0x06, 0x32, 0x18, 0xc1, 0x15, 0xc4, 0x5a, 0x9d, 0xaa, 0x6b,
+    0x02, 0x3a, 0x56, 0xc1, 0x3a, 0xc0, 0x3d, 0x27, 0xc0, 0x31, 0x2c, 0xc0, 0x56, 0xc1, 0x22, 0x16,
+    0x27, 0xc0, 0x2c, 0xc0, 0x31, 0x27, 0x22, 0x34, 0x11, 0xc1, 0x00, 0xfe, 0xc6, 0x7d, 0x1c, 0xfe,
+    0xbd, 0x9b, 0xfe, 0x9b, 0xf6, 0xfe, 0x18, 0xc4, 0x9a, 0xba, 0xfd, 0xfd, 0xca, 0xb4, 0x02, 0x19,
+    0xa6, 0x44, 0x10, 0x9a, 0xcc, 0xab, 0x10, 0xc0, 0x56, 0x29, 0x66, 0x18, 0xc0, 0x66, 0xfe, 0xef,
+    0x3e, 0xa6, 0x43, 0x36, 0x97, 0xef, 0x10, 0xc5, 0x0d, 0xc1, 0x34, 0x38, 0x3a, 0x56, 0xc0, 0x66,
+    0xc0, 0x7e, 0xc1, 0x2c, 0x22, 0x2c, 0xc0, 0x27, 0xc0, 0x56, 0xc1, 0x11, 0xa2, 0x56, 0x1f, 0x27,
+    0xc0, 0x9d, 0xaa, 0xc5, 0xa6, 0x44, 0x12, 0xa2, 0x76, 0x2c, 0x8e, 0xfc, 0xfe, 0x00, 0x00, 0xfd,
+    0xfd, 0xcb, 0xfe, 0x93, 0xb4, 0x19, 0x08, 0x1e, 0x37, 0x36, 0xc0, 0x62, 0x55, 0x66, 0x66, 0x10,
+    0xc0, 0xa9, 0x21, 0xa9, 0x22, 0x10, 0x9c, 0xab, 0x0b, 0xc2, 0x08, 0xc2, 0x05, 0xc0, 0x9d, 0xaa,
+    0x5a, 0x32, 0x2d, 0x5a, 0xc0, 0x2d, 0x32, 0x35, 0x38, 0x2c, 0x9d, 0xaa, 0x2c, 0xc0, 0x27, 0xc0,
+    0x56, 0xc1, 0x0e, 0xc0, 0x1f, 0x13, 0x62, 0xc6, 0x1f, 0x17, 0x12, 0x98, 0xed, 0xfe, 0x29, 0x66,
+    0x00, 0xfd, 0xfd, 0xca, 0x6f, 0x11, 0x16, 0xc1, 0x10, 0x36, 0x62, 0x1d, 0x18, 0x66, 0x10, 0x0b,
+    0xc0, 0x66, 0x3c, 0x16, 0x2f, 0xa2, 0x77, 0xc5, 0x5a, 0xc0, 0x38, 0x51, 0xc0, 0x5e, 0x56, 0xc1,
+    0x6b, 0x2d, 0x35, 0x38, 0xc0, 0x0e, 0xa4, 0x55, 0xc1, 0x27, 0xc0, 0x1f, 0xc0, 0x0e, 0x56, 0xc9,
+    0x66, 0x23, 0x6e, 0xa4, 0x44, 0xfe, 0x08, 0x41, 0x51, 0xfd, 0xfd, 0xca, 0xa7, 0x56, 0x11, 0xc2,
+    0x16, 0x18, 0x1d, 0x18, 0x13, 0x0b, 0xc0, 0x65, 0xc0, 0x5a, 0x37, 0x09, 0xa4, 0x65, 0x37, 0x34,
+    0xc5, 0x5a, 0x29, 0x1f, 0x56, 0x1e, 0x66, 0xc1, 0x7e, 0x29, 0x35, 0x38, 0x3d, 0x9a, 0xcc, 0x0e,
+    0x2f, 0xc0, 0x27, 0x1f, 0xc1, 0x65, 0x01, 0xc6, 0x0b, 0x06, 0x56, 0xc0, 0x06, 0x29, 0x90, 0xea,
+    0x00, 0xfd, 0xfd, 0xcb, 0xb1, 0x13, 0x09, 0xc3, 0x16, 0x18, 0x52, 0x37, 0x66, 0x37, 0xc1, 0x32,
+    0x2a, 0x06, 0x22, 0x2f, 0xc1, 0x2c, 0xc3, 0x29, 0x24, 0x9d, 0xaa, 0x06, 0xa2, 0x57, 0x5a, 0xc0,
+    0x7e, 0x21, 0x29, 0x38, 0x3d, 0x7a, 0x06, 0x01, 0xc0, 0x06, 0x3e, 0xc2, 0x13, 0x3e, 0xc1, 0x69,
+    0xc1, 0x29, 0xa9, 0x21, 0xa3, 0x66, 0x6e, 0x28, 0xfe, 0x94, 0x58, 0x9d, 0xba, 0x98, 0xa9, 0xfe,
+    0x00, 0x00, 0xfd, 0xfd, 0xcc, 0xfe, 0x6a, 0xd0, 0x13, 0xa9, 0x32, 0x13, 0x52, 0xc1, 0x0e, 0x06,
+    0xc2, 0x0e, 0xa2, 0x76, 0xc0, 0x06, 0x01, 0x1b, 0x22, 0xc2, 0x1f, 0xc2, 0x5a, 0xc0, 0x9d, 0xaa,
+    0x3e, 0xc0, 0x03, 0xc0, 0x08, 0x1c, 0xa3, 0x65, 0x3d, 0x7a, 0x27, 0x37, 0x32, 0xc6, 0x5a, 0xc3,
+    0x35, 0xa9, 0x21, 0x0b, 0xa2, 0x77, 0xc0, 0x39, 0xfe, 0x9c, 0xb9, 0x98, 0xdd, 0xfe, 0x18, 0xa4,
+    0x9b, 0xa9, 0xfd, 0xfd, 0xcc, 0xfe, 0x83, 0x73, 0xae, 0x11, 0xa7, 0x42, 0x1d, 0x01, 0xc6, 0x5a,
+    0xc3, 0x13, 0x0e, 0x06, 0x3e, 0xc0, 0xa2, 0x76, 0x6e, 0xc1, 0x5a, 0x66, 0x32, 0xc4, 0x2f, 0x03,
+    0xa7, 0x53, 0x7e, 0x0b, 0x2f, 0xcb, 0xa3, 0x66, 0x2d, 0xa3, 0x66, 0x99, 0xcd, 0x19, 0x96, 0xed,
+    0x99, 0xb9, 0x9b, 0xba, 0x96, 0xca, 0x9c, 0xa9, 0xfd, 0xfd, 0xcd, 0xfe, 0x8b, 0xb6, 0xfe, 0xcd,
+    0x9b, 0x36, 0x62, 0xfe, 0x9c, 0x38, 0x3e, 0x37, 0xc3, 0x32, 0xc4, 0x3e, 0x32, 0x5a, 0xc2, 0x3e,
+    0x03, 0xc0, 0x5a, 0x66, 0x2f, 0xc6, 0x3e, 0xa9, 0x31, 0x3e, 0x51, 0xc0, 0x5a, 0xc9, 0x3a, 0x20,
+    0x3b, 0x9b, 0xaa, 0xfe, 0x21, 0x27, 0x97, 0xda, 0xfd, 0xfd, 0xd1, 0x1b, 0xfe, 0xcd, 0xbb, 0x2c,
+    0x61, 0x0b, 0x2f, 0xd0, 0x66, 0xc2, 0x27, 0xc8, 0x3b, 0x27, 0xc6, 0x5a, 0xc4, 0xab, 0x20, 0x96,
+    0xef, 0x9a, 0xbb, 0xfe, 0x08, 0x62, 0x00, 0xfd, 0xfd, 0xd2, 0x38, 0x18, 0x7e, 0x52, 0x3e, 0x2f,
+    0xc2, 0x2a, 0xc1, 0x27, 0xd1, 0x24, 0xc5, 0x66, 0xc5, 0x0d, 0x26, 0x19, 0x24, 0x56, 0xc0, 0x66,
+    0x1c, 0x51, 0xfe, 0x10, 0x83, 0x00, 0xfd, 0xfd, 0xd3, 0xfe, 0x5a, 0x8f, 0x34, 0x18, 0x9b, 0xac,
+    0x27, 0xcb, 0x24, 0xc4, 0x1f, 0xc6, 0x1c, 0xc3, 0x17, 0xc5, 0xa5, 0x54, 0x28, 0xa4, 0x65, 0xa2,
+    0x67, 0x6e, 0x56, 0xfe, 0x84, 0x58, 0x99, 0xce, 0xc1, 0x96, 0xd9, 0x00, 0xfd, 0xfd, 0xd4, 0xaa,
+    0x35, 0x3b, 0xa8, 0x71, 0x97, 0xaf, 0x24, 0xc0, 0x27, 0xa2, 0x96, 0x76, 0x56, 0x56, 0x4a, 0x5a,
+    0xc3, 0x1c, 0xc2, 0x66, 0xc7, 0x5a, 0xc3, 0x66, 0xc5, 0xa4, 0x65, 0xfe, 0xce, 0x1c, 0xa3, 0x55,
+    0xa2, 0x67, 0x9b, 0xac, 0x99, 0xbd, 0x98, 0xde, 0x14, 0x56, 0xc1, 0xfe, 0x10, 0xa4, 0x00, 0xfd,
+    0xfd, 0xd4, 0x6e, 0xfe, 0x7b, 0xb5, 0xa0, 0x8a, 0x1c, 0xc0, 0x1f, 0xa7, 0x62, 0x66, 0x16, 0x61,
+    0x9d, 0xab, 0x51, 0x4a, 0x17, 0xc1, 0x14, 0xc2, 0x0f, 0xc9, 0x0c, 0xc0, 0x14, 0xc0, 0x0c, 0xc3,
+    0x66, 0xc0, 0xfe, 0xb5, 0x9b, 0x09, 0xfe, 0x94, 0xfa, 0x96, 0xdf, 0x98, 0xcb, 0x98, 0xc9, 0x61,
+    0xa7, 0x47, 0xa7, 0x47, 0x6f, 0x95, 0xe9, 0x00, 0xfd, 0xfd, 0xd6, 0xad, 0x23, 0xaa, 0x38, 0x08,
+    0x14, 0x08, 0x9d, 0x99, 0x65, 0x08, 0x24, 0x10, 0xa3, 0x76, 0x9c, 0xbb, 0x9b, 0x9c, 0x0f, 0xc0,
+    0x5a, 0xc7, 0x07, 0xc3, 0x04, 0xa4, 0x75, 0xfe, 0xb5, 0xdb, 0xa7, 0x63, 0xc0, 0x56, 0x96, 0xdf,
+    0xfe, 0x63, 0x97, 0x04, 0xc2, 0xfe, 0xbe, 0x1c, 0xfe, 0x6b, 0xd7, 0x9b, 0xac, 0xfe, 0x21, 0x69,
+    0x00, 0xc2, 0x6f, 0xa2, 0x78, 0x00, 0xfd, 0xfd, 0xda, 0xa2, 0x78, 0x00, 0xc1, 0x0c, 0xae, 0x15,
+    0xab, 0x28, 0xaa, 0x30, 0xa8, 0x51, 0x99, 0xee, 0xfe, 0x63, 0x77, 0x04, 0xc3, 0x24, 0xa4, 0x75,
+    0x21, 0x5e, 0x9a, 0xad, 0x04, 0xc2, 0x5a, 0xa3, 0x75, 0x1a, 0xa3, 0x76, 0xc0, 0x6e, 0x36, 0xc0,
+    0x9a, 0xbc, 0xfe, 0x53, 0x57, 0x66, 0xc0, 0x35, 0xa5, 0x65, 0x35, 0xfe, 0x19, 0x28, 0x00, 0xfd,
+    0xfd, 0xe7, 0x02, 0x04, 0xfe, 0x8c, 0xb9, 0xa9, 0x51, 0xfe, 0x73, 0xf8, 0x01, 0x3c, 0xc0, 0x04,
+    0xaa, 0x60, 0xa5, 0x54, 0xa3, 0x66, 0xa3, 0x66, 0xa3, 0x66, 0x1a, 0xfe, 0x95, 0x5b, 0x3c, 0xc2,
+    0xfe, 0x8d, 0x1a, 0x9c, 0xbb, 0x97, 0xcf, 0x01, 0xa4, 0x65, 0xa8, 0x41, 0xa9, 0x52, 0xa9, 0x31,
+    0x13, 0x3c, 0xc2, 0x98, 0xc8, 0x00, 0xfd, 0xfd, 0xe9, 0xfe, 0x3a, 0x50, 0x3c, 0x13, 0x9d, 0x9a,
+    0x3c, 0xc1, 0xfe, 0x8c, 0xb9, 0x34, 0xa2, 0x67, 0x6e, 0xc0, 0xa5, 0x54, 0xa3, 0x66, 0xc0, 0xfe,
+    0x6c, 0x38, 0x3c, 0xc1, 0xa2, 0x66, 0x3c, 0x54, 0x96, 0xe9, 0x9c, 0xb9, 0xa5, 0x57, 0x26, 0xa3,
+    0x77, 0x22, 0x3c, 0xc2, 0xfe, 0x10, 0xc5, 0x00, 0xfd, 0xfd, 0xe9, 0xa4, 0x57, 0x35, 0x3c, 0x35,
+    0x3c, 0xc0, 0x35, 0xfe, 0x9d, 0x7b, 0x66, 0xfe, 0x6b, 0xf8, 0x35, 0x51, 0xa3, 0x66, 0x37, 0xab,
+    0x20, 0x9d, 0xaa, 0x3c, 0xc2, 0x9d, 0x97, 0xfe, 0x08, 0x63, 0x00, 0xc1, 0x6f, 0x29, 0x35, 0x3c,
+    0xc1, 0x9c, 0xa8, 0x00, 0xfd, 0xfd, 0xeb, 0xfe, 0x32, 0x0e, 0x3c, 0xc5, 0x9b, 0xb8, 0x27, 0x00,
+    0xa2, 0x78, 0xac, 0x07, 0x35, 0x01, 0x3c, 0xc1, 0x21, 0x27, 0x00, 0xc4, 0x27, 0x04, 0xa7, 0x47,
+    0x06, 0xfe, 0x10, 0xa4, 0x00, 0xfd, 0xfd, 0xeb, 0xa2, 0x67, 0xfe, 0x42, 0xd4, 0x3c, 0xc3, 0x9b,
+    0xa7, 0x0c, 0x00, 0xc2, 0xa7, 0x48, 0xfe, 0x4b, 0x16, 0x3c, 0xc0, 0x26, 0xfe, 0x10, 0xa5, 0x00,
+    0xfd, 0xfd, 0xf8, 0xa3, 0x67, 0x3a, 0x3c, 0xc1, 0x9b, 0xb7, 0x0c, 0x00, 0xc4, 0x3b, 0xfe, 0x3a,
+    0x71, 0xc0, 0x3b, 0x00, 0xfd, 0xfd, 0xfb, 0xa6, 0x48, 0xa6, 0x57, 0x9c, 0xa8, 0x00, 0xfd, 0xec,
+};
+
+#endif  // BUTTERFLY_QOI_H
@@ -0,0 +1,190 @@
+#ifndef ILI9341_SPI_H
+#define ILI9341_SPI_H
+
+// A minimal ILI9341 driver for band rendering (panel-band.h): initialize
+// the controller and write rectangles of RGB565 straight to it over SPI,
+// with no screen buffer.
+//
+// It drives the bus with the Arduino SPI library. The xpt2046 touchscreen
+// shares the bus and is read with Xpt2046Spi, on the task that writes the
+// bands: the loop in tft-office-low-ram.yaml, the render task in
+// tft-office-render-task.yaml. Both leave out ESPHome's spi: and
+// touchscreen: components, so only that task drives the bus and the two CS
+// lines are never low together.
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "panel-band.h"
+
+#define ILI9341_SWRESET (0x01)
+#define ILI9341_SLPOUT (0x11)
+#define ILI9341_DISPON (0x29)
+#define ILI9341_CASET (0x2A)
+#define ILI9341_PASET (0x2B)
+#define ILI9341_RAMWR (0x2C)
+#define ILI9341_MADCTL (0x36)
+#define ILI9341_COLMOD (0x3A)
+
+#define XPT2046_Z1 (0xB1)
+#define XPT2046_Z2 (0xC1)
+#define XPT2046_X (0xD1)
+#define XPT2046_Y (0x91)
+#define XPT2046_POWER_DOWN (0xD0)
+
+// Memory access control for a 320x240 landscape screen, the picture the
+// ili9xxx "rotation: 270" in tft-office.yaml gives. ili9xxx initializes
+// the ILI9341 portrait (MX and BGR, 0x48) and rotates 270 degrees by
+// drawing (x, y) at (y, 319 - x). The same picture in hardware is row/column
+// exchange (MV) with both address orders reversed (MX, MY) and BGR, as
+// Adafruit_ILI9341's rotation 3. MV and BGR alone (0x28) is its rotation 1,
+// upside down.
+#ifndef ILI9341_MADCTL_LANDSCAPE
+#define ILI9341_MADCTL_LANDSCAPE (0xE8)
+#endif
+
+class Ili9341Spi : public PanelBandOutput {
+    public:
+    Ili9341Spi(int clkPin_, int misoPin_, int mosiPin_, int csPin_, int dcPin_, int resetPin_, uint32_t frequency)
+        : clkPin(clkPin_), misoPin(misoPin_), mosiPin(mosiPin_), csPin(csPin_), dcPin(dcPin_), resetPin(resetPin_),
+          settings(frequency, MSBFIRST, SPI_MODE0) {}
+
+    void begin() {
+        pinMode(csPin, OUTPUT);
+        pinMode(dcPin, OUTPUT);
+        pinMode(resetPin, OUTPUT);
+        digitalWrite(csPin, HIGH);
+        SPI.begin(clkPin, misoPin, mosiPin);
+
+        digitalWrite(resetPin, LOW);
+        delay(10);
+        digitalWrite(resetPin, HIGH);
+        delay(120);
+
+        const uint8_t pixelFormat = 0x55;  // 16 bits per pixel.
+        const uint8_t madctl = ILI9341_MADCTL_LANDSCAPE;
+        command(ILI9341_SWRESET, NULL, 0);
+        delay(150);
+        command(ILI9341_SLPOUT, NULL, 0);
+        delay(120);
+        command(ILI9341_COLMOD, &pixelFormat, 1);
+        command(ILI9341_MADCTL, &madctl, 1);
+        command(ILI9341_DISPON, NULL, 0);
+        delay(20);
+    }
+
+    void write(int x, int y, int w, int h, const uint8_t* pixels, int stride) override {
+        const uint8_t columns[4] = {(uint8_t) (x >> 8), (uint8_t) x, (uint8_t) ((x + w - 1) >> 8), (uint8_t) (x + w - 1)};
+        const uint8_t pages[4] = {(uint8_t) (y >> 8), (uint8_t) y, (uint8_t) ((y + h - 1) >> 8), (uint8_t) (y + h - 1)};
+        SPI.beginTransaction(settings);
+        digitalWrite(csPin, LOW);
+        sendCommand(ILI9341_CASET, columns, sizeof(columns));
+        sendCommand(ILI9341_PASET, pages, sizeof(pages));
+        sendCommand(ILI9341_RAMWR, NULL, 0);
+        for (int row = 0; row < h; row++) {
+            SPI.writeBytes(pixels + row * stride, w * 2);
+        }
+        digitalWrite(csPin, HIGH);
+        SPI.endTransaction();
+    }
+
+    private:
+    int clkPin;
+    int misoPin;
+    int mosiPin;
+    int csPin;
+    int dcPin;
+    int resetPin;
+    SPISettings settings;
+
+    // A command (DC low) then its parameters (DC high). CS must be low.
+    void sendCommand(uint8_t cmd, const uint8_t* data, int length) {
+        digitalWrite(dcPin, LOW);
+        SPI.write(cmd);
+        digitalWrite(dcPin, HIGH);
+        if (length > 0) {
+            SPI.writeBytes(data, length);
+        }
+    }
+
+    void command(uint8_t cmd, const uint8_t* data, int length) {
+        SPI.beginTransaction(settings);
+        digitalWrite(csPin, LOW);
+        sendCommand(cmd, data, length);
+        digitalWrite(csPin, HIGH);
+        SPI.endTransaction();
+    }
+};
+
+// The xpt2046 touchscreen, read as ESPHome's xpt2046 component reads it:
+// the pressure, then three samples of each axis, keeping the average of
+// the closest two. threshold is the touchscreen's threshold:. It is not
+// pressed until begin(), which must follow Ili9341Spi::begin() (that starts
+// the bus).
+class Xpt2046Spi : public PanelTouchInput {
+    public:
+    Xpt2046Spi(int csPin_, int threshold_) : csPin(csPin_), threshold(threshold_), settings(2000000, MSBFIRST, SPI_MODE0) {}
+
+    void begin() {
+        pinMode(csPin, OUTPUT);
+        digitalWrite(csPin, HIGH);
+        begun = true;
+    }
+
+    bool read(int &xRaw, int &yRaw) override {
+        if (!begun) {
+            return false;
+        }
+        SPI.beginTransaction(settings);
+        digitalWrite(csPin, LOW);
+        const int z1 = readAdc(XPT2046_Z1);
+        const int z2 = readAdc(XPT2046_Z2);
+        const bool pressed = z1 + 4095 - z2 >= threshold;
+        if (pressed) {
+            int x[3];
+            int y[3];
+            for (int i = 0; i < 3; i++) {
+                x[i] = readAdc(XPT2046_X);
+                y[i] = readAdc(XPT2046_Y);
+            }
+            xRaw = closestTwoAverage(x);
+            yRaw = closestTwoAverage(y);
+        }
+        readAdc(XPT2046_POWER_DOWN);
+        digitalWrite(csPin, HIGH);
+        SPI.endTransaction();
+        return pressed;
+    }
+
+    private:
+    int csPin;
+    int threshold;
+    SPISettings settings;
+    bool begun = false;
+
+    // A 12 bit conversion. CS must be low.
+    int readAdc(uint8_t control) {
+        SPI.transfer(control);
+        const uint8_t high = SPI.transfer(0);
+        const uint8_t low = SPI.transfer(0);
+        return ((high << 8) | low) >> 3;
+    }
+
+    static int closestTwoAverage(const int* samples) {
+        const int ab = abs(samples[0] - samples[1]);
+        const int bc = abs(samples[1] - samples[2]);
+        const int ca = abs(samples[2] - samples[0]);
+        if (ab <= bc && ab <= ca) {
+            return (samples[0] + samples[1]) / 2;
+        }
+        if (bc <= ca) {
+            return (samples[1] + samples[2]) / 2;
+        }
+        return (samples[2] + samples[0]) / 2;
+    }
+};
+
+#endif  // ARDUINO
+
+#endif  // ILI9341_SPI_H
@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+##
+## Convert a PNG to a compressed RGB565 image header for PanelQoiImage.
+##
+## Usage, from tft-office:
+##
+##     images/png-to-qoi565.py images/butterfly.png 200x200 butterfly > butterfly-qoi.h
+##
+## The image is scaled (keeping its aspect ratio, like ESPHome's image
+## resize:) to fit WIDTHxHEIGHT, composited over black, converted to
+## RGB565 and encoded in the QOI-style format described in
+## panel-qoi-image.h. The header defines NAME_QOI (the encoded bytes),
+## NAME_QOI_WIDTH, NAME_QOI_HEIGHT and NAME_QOI_CHECKSUM (FNV-1a of the
+## big-endian RGB565 pixels, to check a decoder against).
+##
+## Only needs the Python standard library, so decoding a large PNG takes a
+## while.
+##
+
+import struct
+import sys
+import zlib
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RGB565 = 0xFE
+MAX_RUN = 62
+
+
+def read_png(path):
+    """Returns (width, height, rows), rows being RGBA bytes per row."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s is not a PNG" % path)
+    offset = 8
+    idat = []
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        body = data[offset + 8:offset + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat.append(body)
+        offset += 12 + length
+    channels = {2: 3, 6: 4}.get(color_type)
+    if depth != 8 or channels is None or interlace != 0:
+        sys.exit("Only 8 bit, non-interlaced RGB or RGBA PNGs are supported")
+
+    raw = zlib.decompress(b"".join(idat))
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + stride])
+        unfilter(kind, row, previous, channels)
+        rows.append(row if channels == 4 else to_rgba(row))
+        previous = row
+    return width, height, rows
+
+
+def unfilter(kind, row, previous, bpp):
+    n = len(row)
+    if kind == 1:
+        for i in range(bpp, n):
+            row[i] = (row[i] + row[i - bpp]) & 0xFF
+    elif kind == 2:
+        for i in range(n):
+            row[i] = (row[i] + previous[i]) & 0xFF
+    elif kind == 3:
+        for i in range(n):
+            left = row[i - bpp] if i >= bpp else 0
+            row[i] = (row[i] + ((left + previous[i]) >> 1)) & 0xFF
+    elif kind == 4:
+        for i in range(n):
+            if i >= bpp:
+                a = row[i - bpp]
+                c = previous[i - bpp]
+            else:
+                a = c = 0
+            b = previous[i]
+            p = a + b - c
+            pa = abs(p - a)
+            pb = abs(p - b)
+            pc = abs(p - c)
+            row[i] = (row[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+
+
+def to_rgba(row):
+    rgba = bytearray()
+    for i in range(0, len(row), 3):
+        rgba += row[i:i + 3] + b"\xff"
+    return rgba
+
+
+def scale(width, height, rows, max_width, max_height):
+    """Box-filter to fit max_width x max_height, over black, as RGB565."""
+    ratio = min(max_width / width, max_height / height)
+    out_width = max(1, round(width * ratio))
+    out_height = max(1, round(height * ratio))
+    pixels = []
+    for oy in range(out_height):
+        y0 = oy * height // out_height
+        y1 = max(y0 + 1, (oy + 1) * height // out_height)
+        for ox in range(out_width):
+            x0 = ox * width // out_width
+            x1 = max(x0 + 1, (ox + 1) * width // out_width)
+            r = g = b = 0
+            for y in range(y0, y1):
+                row = rows[y]
+                for x in range(x0 * 4, x1 * 4, 4):
+                    alpha = row[x + 3]
+                    r += row[x] * alpha
+                    g += row[x + 1] * alpha
+                    b += row[x + 2] * alpha
+            count = (y1 - y0) * (x1 - x0) * 255
+            r, g, b = r // count, g // count, b // count
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return out_width, out_height, pixels
+
+
+def channels565(pixel):
+    return (pixel >> 11) & 0x1F, (pixel >> 5) & 0x3F, pixel & 0x1F
+
+
+def index_of(pixel):
+    r, g, b = channels565(pixel)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def wrap(value, bits):
+    # -2^(bits-1) .. 2^(bits-1)-1
+    half = 1 << (bits - 1)
+    return ((value + half) % (1 << bits)) - half
+
+
+def encode(pixels):
+    out = bytearray()
+    index = [0] * 64
+    previous = 0
+    run = 0
+    for pixel in pixels:
+        if pixel == previous:
+            run += 1
+            if run == MAX_RUN:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+        slot = index_of(pixel)
+        if index[slot] == pixel:
+            out.append(OP_INDEX | slot)
+        else:
+            index[slot] = pixel
+            r, g, b = channels565(pixel)
+            pr, pg, pb = channels565(previous)
+            dr = wrap(r - pr, 5)
+            dg = wrap(g - pg, 6)
+            db = wrap(b - pb, 5)
+            dr_dg = dr - dg
+            db_dg = db - dg
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            else:
+                out.append(OP_RGB565)
+                out.append(pixel >> 8)
+                out.append(pixel & 0xFF)
+        previous = pixel
+    if run > 0:
+        out.append(OP_RUN | (run - 1))
+    return out
+
+
+def decode(data, count):
+    """The reference decoder, to check encode() round trips."""
+    pixels = []
+    index = [0] * 64
+    previous = 0
+    i = 0
+    while len(pixels) < count:
+        op = data[i]
+        i += 1
+        if op == OP_RGB565:
+            pixel = (data[i] << 8) | data[i + 1]
+            i += 2
+        elif op & 0xC0 == OP_INDEX:
+            pixel = index[op & 0x3F]
+        elif op & 0xC0 == OP_DIFF:
+            r, g, b = channels565(previous)
+            r = (r + ((op >> 4) & 3) - 2) & 0x1F
+            g = (g + ((op >> 2) & 3) - 2) & 0x3F
+            b = (b + (op & 3) - 2) & 0x1F
+            pixel = (r << 11) | (g << 5) | b
+        elif op & 0xC0 == OP_LUMA:
+            dg = (op & 0x3F) - 32
+            second = data[i]
+            i += 1
+            r, g, b = channels565(previous)
+            r = (r + dg + (second >> 4) - 8) & 0x1F
+            g = (g + dg) & 0x3F
+            b = (b + dg + (second & 0x0F) - 8) & 0x1F
+            pixel = (r << 11) | (g << 5) | b
+        else:
+            pixels.extend([previous] * ((op & 0x3F) + 1))
+            continue
+        index[index_of(pixel)] = pixel
+        pixels.append(pixel)
+        previous = pixel
+    return pixels
+
+
+def checksum(pixels):
+    value = 2166136261
+    for pixel in pixels:
+        for byte in (pixel >> 8, pixel & 0xFF):
+            value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit("Usage: png-to-qoi565.py image.png WIDTHxHEIGHT NAME > name-qoi.h")
+    path, size, name = sys.argv[1], sys.argv[2], sys.argv[3].upper()
+    max_width, max_height = (int(v) for v in size.lower().split("x"))
+
+    width, height, rows = read_png(path)
+    width, height, pixels = scale(width, height, rows, max_width, max_height)
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        sys.exit("Round trip failed")
+
+    raw_bytes = len(pixels) * 2
+    print("// Generated by images/png-to-qoi565.py from %s. Don't edit." % path)
+    print("// %dx%d RGB565, %d bytes (%d raw, %.1fx smaller). See panel-qoi-image.h."
+          % (width, height, len(data), raw_bytes, raw_bytes / len(data)))
+    print()
+    print("#ifndef %s_QOI_H" % name)
+    print("#define %s_QOI_H" % name)
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("#define %s_QOI_WIDTH (%d)" % (name, width))
+    print("#define %s_QOI_HEIGHT (%d)" % (name, height))
+    print("#define %s_QOI_CHECKSUM (0x%08xu)" % (name, checksum(pixels)))
+    print()
+    print("static const uint8_t %s_QOI[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        print("    " + " ".join("0x%02x," % byte for byte in data[i:i + 16]))
+    print("};")
+    print()
+    print("#endif  // %s_QOI_H" % name)
+    sys.stderr.write("%dx%d: %d bytes, %d raw (%.1fx smaller)\n"
+                     % (width, height, len(data), raw_bytes, raw_bytes / len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,184 @@
+#ifndef PANEL_BAND_H
+#define PANEL_BAND_H
+
+// Low-RAM rendering: draw the panels a band of rows at a time.
+//
+// ESPHome's ili9xxx display keeps a buffer of the whole screen (320x240),
+// which leaves too little RAM on an ESP32 for bluetooth_proxy. Instead,
+// PanelBands keeps one band of PANEL_BAND_ROWS full-width rows of RGB565
+// (320 * 20 * 2 = 12.8KB by default, a twelfth of a 16 bit screen buffer).
+// For each band that overlaps the area PanelDamage found changed, it
+// clears the band, draws every visible panel that crosses it (pixels
+// outside the band are dropped) and sends the changed columns of the band
+// to the display through a PanelBandOutput (see ili9341-spi.h).
+//
+// Panels crossing several bands are drawn once per band, so this works
+// best with the bitmap cache (panel-bitmap-cache.h): each band is then a
+// clipped blit rather than another pass through the font renderer.
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <display-panel.h>
+#include "panel-damage.h"
+
+#ifndef PANEL_BAND_ROWS
+#define PANEL_BAND_ROWS (20)
+#endif
+
+// Where finished bands are sent.
+class PanelBandOutput {
+    public:
+    virtual ~PanelBandOutput() {}
+
+    /**
+     * Write a w x h rectangle at (x, y). pixels is big-endian RGB565 with
+     * stride bytes between the starts of rows.
+     */
+    virtual void write(int x, int y, int w, int h, const uint8_t* pixels, int stride) = 0;
+};
+
+// A touchscreen on the same bus as the PanelBandOutput (see Xpt2046Spi in
+// ili9341-spi.h). It is read on the task that writes the bands, the loop
+// or the render task (panel-render-task.h), so only one task drives the
+// bus.
+class PanelTouchInput {
+    public:
+    virtual ~PanelTouchInput() {}
+
+    /**
+     * Read the touchscreen. Returns true, with the raw position, while it
+     * is pressed.
+     */
+    virtual bool read(int &xRaw, int &yRaw) = 0;
+};
+
+// A Display whose pixels land in the current band. Anything outside the
+// band is dropped.
+class PanelBandDisplay : public esphome::display::Display {
+    public:
+    PanelBandOutput* output = NULL;
+    int width;
+    int height;
+    // The screen rows the band holds: [top, top + rows).
+    int top = 0;
+    int rows = 0;
+    // Big-endian RGB565, PANEL_BAND_ROWS rows of width pixels.
+    std::vector<uint8_t> band;
+
+    PanelBandDisplay(int width_, int height_) : width(width_), height(height_) {}
+
+    // Allocate the band. Separate from the constructor so the memory is
+    // only taken on devices that render this way.
+    void allocate() {
+        band.assign(width * PANEL_BAND_ROWS * 2, 0);
+    }
+
+    void beginBand(int top_, int rows_, Color background) {
+        top = top_;
+        rows = rows_;
+        const uint16_t pixel = PanelBlitter::toRgb565(background);
+        for (int i = 0; i < width * rows; i++) {
+            band[i * 2] = pixel >> 8;
+            band[i * 2 + 1] = pixel & 0xFF;
+        }
+    }
+
+    void draw_pixel_at(int x, int y, Color color) override {
+        if (x < 0 || x >= width || y < top || y >= top + rows) {
+            return;
+        }
+        const uint16_t pixel = PanelBlitter::toRgb565(color);
+        uint8_t* out = &band[((y - top) * width + x) * 2];
+        out[0] = pixel >> 8;
+        out[1] = pixel & 0xFF;
+    }
+
+    // Copy the rows of a big-endian RGB565 block that fall in the band.
+    void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t* ptr,
+            esphome::display::ColorOrder order, esphome::display::ColorBitness bitness,
+            bool big_endian, int x_offset, int y_offset, int x_pad) override {
+        if (bitness != esphome::display::COLOR_BITNESS_565 || !big_endian || order != esphome::display::COLOR_ORDER_RGB) {
+            esphome::display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset, x_pad);
+            return;
+        }
+        const int stride = (x_offset + w + x_pad) * 2;
+        const int left = std::max(x_start, 0);
+        const int right = std::min(x_start + w, width);
+        const int first = std::max(y_start, top);
+        const int last = std::min(y_start + h, top + rows);
+        for (int y = first; y < last && left < right; y++) {
+            const uint8_t* in = ptr + (y_offset + y - y_start) * stride + (x_offset + left - x_start) * 2;
+            memcpy(&band[((y - top) * width + left) * 2], in, (right - left) * 2);
+        }
+    }
+
+    // Fill the whole screen, a band at a time.
+    void fill(Color color) override {
+        for (int y = 0; y < height; y += PANEL_BAND_ROWS) {
+            const int bandRows = std::min(PANEL_BAND_ROWS, height - y);
+            beginBand(y, bandRows, color);
+            output->write(0, y, width, bandRows, band.data(), width * 2);
+        }
+    }
+
+    int get_width() override {
+        return width;
+    }
+
+    int get_height() override {
+        return height;
+    }
+
+    esphome::display::DisplayType get_display_type() override {
+        return esphome::display::DISPLAY_TYPE_COLOR;
+    }
+
+    void update() override {
+    }
+};
+
+class PanelBands {
+    public:
+    PanelBandDisplay display;
+
+    // Diagnostics. Bands sent to the display.
+    uint32_t bandsWritten = 0;
+
+    PanelBands(int width, int height) : display(width, height) {}
+
+    void begin(PanelBandOutput* output) {
+        display.output = output;
+        display.allocate();
+    }
+
+    /**
+     * Draw what changed since the last frame, band by band.
+     * Use instead of PanelDamage::draw().
+     */
+    void draw(PanelDamage &damage, std::vector<DisplayPanel*> &panels) {
+        if (!damage.plan(panels)) {
+            damage.commit(panels);
+            return;
+        }
+        const panel_rect_t area = damage.damagedBounds();
+        PANEL_TIMING_START(drawStart);
+        for (int top = area.y; top < area.y + area.h; top += PANEL_BAND_ROWS) {
+            const int rows = std::min(PANEL_BAND_ROWS, area.y + area.h - top);
+            const panel_rect_t bandArea = panel_rect_t{0, top, display.width, rows};
+            display.beginBand(top, rows, damage.background);
+            for (int i = 0; i < (int) panels.size(); i++) {
+                if (PanelDamage::isVisible(panels[i]) && PanelDamage::intersects(bandArea, PanelDamage::rectOf(panels[i]))) {
+                    damage.drawPanel(display, panels, i);
+                }
+            }
+            display.output->write(area.x, top, area.w, rows, &display.band[area.x * 2], display.width * 2);
+            bandsWritten++;
+        }
+        PANEL_TIMING_PHASE(PANEL_PHASE_DRAW, drawStart);
+        damage.commit(panels);
+    }
+};
+
+#endif  // PANEL_BAND_H
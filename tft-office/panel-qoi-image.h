@@ -0,0 +1,172 @@
+#ifndef PANEL_QOI_IMAGE_H
+#define PANEL_QOI_IMAGE_H
+
+// A compressed RGB565 image, decoded a line at a time as it is drawn.
+//
+// An ESPHome RGB565 image is stored raw (a 200x190 image is 76,000 bytes
+// of flash) and drawn a draw_pixel_at() per pixel. PanelQoiImage stores
+// the pixels in a QOI-style format (https://qoiformat.org, adapted to
+// RGB565) and, when drawn, decodes each line into a line buffer and hands
+// it to Display::draw_pixels_at() in one call: on the ili9xxx display, one
+// address window per line. The whole image is never in RAM. Only the part
+// of each line on the display is drawn.
+//
+// The flash and display calls are saved at the cost of CPU: decoding is
+// slower than reading raw pixels. measure-image (panel-host) draws about
+// 20-30% fewer pixels per ms with it than raw.
+//
+// Set it as a DisplayPanel's image like any other image. Make the data
+// with images/png-to-qoi565.py.
+//
+// The format: pixels in rows, top to bottom, each an op, with runs that
+// may cross rows. The decoder keeps the previous pixel (starting black)
+// and a table of 64 recently seen pixels, indexed by
+// (r * 3 + g * 5 + b * 7) % 64 of the 5/6/5 bit channels. Every decoded
+// pixel, other than those of a run, goes into the table.
+//
+//     00iiiiii           the pixel at table index i
+//     01rrggbb           the previous pixel plus r, g, b - 2 (-2..1)
+//     10gggggg rrrrbbbb  the previous pixel plus g - 32 (-32..31) on green,
+//                        and that plus r - 8, b - 8 (-8..7) on red and blue
+//     11nnnnnn           the previous pixel, n + 1 (1..62) times
+//     11111110 hi lo     the big-endian RGB565 pixel that follows
+//
+// Channels wrap around.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include <display-panel.h>
+
+#define PANEL_QOI_OP_MASK (0xC0)
+#define PANEL_QOI_OP_INDEX (0x00)
+#define PANEL_QOI_OP_DIFF (0x40)
+#define PANEL_QOI_OP_LUMA (0x80)
+#define PANEL_QOI_OP_RUN (0xC0)
+#define PANEL_QOI_OP_RGB565 (0xFE)
+
+// Decodes a PanelQoiImage's data from the start, a line at a time.
+class PanelQoiDecoder {
+    public:
+    PanelQoiDecoder(const uint8_t* data_, size_t size_) : data(data_), size(size_) {}
+
+    /**
+     * Decode the next count pixels into line, as big-endian RGB565.
+     * Pixels past the end of the data are black.
+     */
+    void decodeLine(uint8_t* line, int count) {
+        for (int i = 0; i < count; i++) {
+            const uint16_t pixel = next();
+            line[i * 2] = pixel >> 8;
+            line[i * 2 + 1] = pixel & 0xFF;
+        }
+    }
+
+    // Skip count pixels.
+    void skip(int count) {
+        for (int i = 0; i < count; i++) {
+            next();
+        }
+    }
+
+    private:
+    const uint8_t* data;
+    size_t size;
+    size_t position = 0;
+    uint16_t previous = 0;
+    // Pixels of the current run still to come.
+    int run = 0;
+    uint16_t table[64] = {};
+
+    static int slotOf(uint16_t pixel) {
+        return (((pixel >> 11) & 0x1F) * 3 + ((pixel >> 5) & 0x3F) * 5 + (pixel & 0x1F) * 7) % 64;
+    }
+
+    static uint16_t add(uint16_t pixel, int dr, int dg, int db) {
+        const int r = (((pixel >> 11) & 0x1F) + dr) & 0x1F;
+        const int g = (((pixel >> 5) & 0x3F) + dg) & 0x3F;
+        const int b = ((pixel & 0x1F) + db) & 0x1F;
+        return (r << 11) | (g << 5) | b;
+    }
+
+    uint16_t next() {
+        if (run > 0) {
+            run--;
+            return previous;
+        }
+        if (position >= size) {
+            return 0;
+        }
+        const uint8_t op = data[position++];
+        uint16_t pixel;
+        if (op == PANEL_QOI_OP_RGB565) {
+            pixel = position + 1 < size ? (data[position] << 8) | data[position + 1] : 0;
+            position += 2;
+        }
+        else if ((op & PANEL_QOI_OP_MASK) == PANEL_QOI_OP_INDEX) {
+            pixel = table[op & 0x3F];
+        }
+        else if ((op & PANEL_QOI_OP_MASK) == PANEL_QOI_OP_DIFF) {
+            pixel = add(previous, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2);
+        }
+        else if ((op & PANEL_QOI_OP_MASK) == PANEL_QOI_OP_LUMA) {
+            const int dg = (op & 0x3F) - 32;
+            const uint8_t second = position < size ? data[position] : 0x88;
+            position++;
+            pixel = add(previous, dg + (second >> 4) - 8, dg, dg + (second & 0x0F) - 8);
+        }
+        else {
+            run = op & 0x3F;
+            return previous;
+        }
+        table[slotOf(pixel)] = pixel;
+        previous = pixel;
+        return pixel;
+    }
+};
+
+class PanelQoiImage : public esphome::image::Image {
+    public:
+    // Diagnostics. Lines sent to displays.
+    uint32_t linesDrawn = 0;
+
+    PanelQoiImage(const uint8_t* data_, size_t size_, int width, int height)
+        : esphome::image::Image(NULL, width, height, esphome::image::IMAGE_TYPE_RGB565), data(data_), size(size_) {}
+
+    // Decode and draw the image with its top left corner at (x, y),
+    // clipped to the display.
+    void draw(int x, int y, esphome::display::Display* display, Color colorOn, Color colorOff) override {
+        (void) colorOn;
+        (void) colorOff;
+        const int width = get_width();
+        const int height = get_height();
+        // The columns of the image on the display.
+        const int left = x < 0 ? -x : 0;
+        const int right = x + width > display->get_width() ? display->get_width() - x : width;
+        if (left >= right) {
+            return;
+        }
+        line.resize(width * 2);
+        PanelQoiDecoder decoder(data, size);
+        for (int row = 0; row < height && y + row < display->get_height(); row++) {
+            if (y + row < 0) {
+                decoder.skip(width);
+                continue;
+            }
+            // Every pixel is decoded (runs cross lines), only the visible
+            // ones are sent.
+            decoder.decodeLine(line.data(), width);
+            display->draw_pixels_at(x + left, y + row, right - left, 1, line.data(),
+                esphome::display::COLOR_ORDER_RGB, esphome::display::COLOR_BITNESS_565, true, left, 0, width - right);
+            linesDrawn++;
+        }
+    }
+
+    private:
+    const uint8_t* data;
+    size_t size;
+    // One line of big-endian RGB565. Allocated on the first draw.
+    std::vector<uint8_t> line;
+};
+
+#endif  // PANEL_QOI_IMAGE_H
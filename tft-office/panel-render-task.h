@@ -0,0 +1,414 @@
+#ifndef PANEL_RENDER_TASK_H
+#define PANEL_RENDER_TASK_H
+
+// Optional: draw the panels and write them to the display on the other
+// core.
+//
+// Normally a frame (updatePanelStates(), then drawing and the SPI writes)
+// runs in ESPHome's loop, on the same core as the API and sensor
+// callbacks, which wait for it. With PanelRenderTask the loop only runs
+// updatePanelStates() and publish(), which copies what each panel shows
+// (its geometry, colours, font, image and text) into a panel_frame_t.
+// A FreeRTOS task pinned to PANEL_RENDER_TASK_CORE (the loop runs on core
+// 1) takes the newest frame, copies it onto its own DisplayPanels and
+// draws those, so it never reads a panel the loop is changing.
+//
+// Frames are handed over in PanelFrameBuffer, two panel_frame_t and an
+// atomic state: lock free, with one producer (the loop) and one consumer
+// (the render task). The loop always fills the frame the render task is
+// not reading. A frame the render task hasn't taken yet is replaced by a
+// newer one, so a slow display drops stale frames rather than queueing.
+// The render task only holds a frame while copying it, not while drawing.
+//
+// The render task is then the only task on the display's SPI bus, so
+// given a PanelTouchInput it also reads the touchscreen, every
+// PANEL_RENDER_TOUCH_MS between frames, and hands new presses to the loop
+// in touches (see tft-office-render-task.yaml). The counters it shares
+// with the loop (the frame bytes and bitmap cache hits) are atomic.
+//
+// Build with -DPANEL_RENDER_TASK (and PANEL_BAND_RENDERING: the render task
+// writes the bands to the display itself, see panel-band.h). The frame
+// time sensors (panel-timing.h) assume one task, so build without
+// PANEL_TIMING_ENABLED. The loop's share of each frame is the "Frame CPU
+// Time per Hour" (frame-scheduler.h); touch latency runs to publish().
+//
+// On the host (no ARDUINO) the render task is a std::thread.
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <display-panel.h>
+#include "panel-band.h"
+#include "panel-text.h"
+#ifndef ARDUINO
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#if defined(PANEL_RENDER_TASK) && defined(PANEL_TIMING_ENABLED)
+#error "panel-timing.h times frames on one task; build PANEL_RENDER_TASK without PANEL_TIMING_ENABLED"
+#endif
+
+#ifndef PANEL_RENDER_MAX_PANELS
+#define PANEL_RENDER_MAX_PANELS (16)
+#endif
+#ifndef PANEL_RENDER_TASK_CORE
+#define PANEL_RENDER_TASK_CORE (0)
+#endif
+#define PANEL_RENDER_TASK_STACK (8192)
+#define PANEL_RENDER_TASK_PRIORITY (1)
+// How soon to try again when the render task was taking the last frame.
+#define PANEL_RENDER_RETRY_MS (5)
+// How often the render task reads the touchscreen, as the touchscreen
+// component's update_interval.
+#ifndef PANEL_RENDER_TOUCH_MS
+#define PANEL_RENDER_TOUCH_MS (50)
+#endif
+
+struct panel_model_t {
+    const char* name;
+    int x, y, w, h;
+    bool enabled;
+    bool drawPanelOutline;
+    Color color;
+    Color textColor;
+    esphome::font::Font* font;
+    esphome::image::Image* image;
+    int fontVertOffset;
+    int fontHeightOffset;
+    PanelText text;
+};  // What a DisplayPanel draws, copied for the render task
+
+struct panel_frame_t {
+    int count;
+    panel_model_t panels[PANEL_RENDER_MAX_PANELS];
+    uint32_t publishedUs;   // micros() when published
+};  // The panels of a frame, in draw order
+
+class PanelFrameBuffer {
+    public:
+    // Producer. The frame to fill; the consumer never reads it.
+    panel_frame_t &back() {
+        return frames[1 - (state.load(std::memory_order_acquire) & FRONT)];
+    }
+
+    /**
+     * Producer. Make back() the newest frame. Fails (returns false) while
+     * the consumer is taking the newest frame; back() is then still the
+     * producer's, to fill and publish again.
+     */
+    bool publish() {
+        uint8_t current = state.load(std::memory_order_relaxed);
+        if (current & READING) {
+            return false;
+        }
+        const uint8_t next = ((current & FRONT) ^ FRONT) | FRESH;
+        if (!state.compare_exchange_strong(current, next, std::memory_order_acq_rel)) {
+            return false;
+        }
+        if (current & FRESH) {
+            superseded++;
+        }
+        return true;
+    }
+
+    // Consumer. The newest frame, if there is one it hasn't taken, until
+    // release(). Otherwise NULL.
+    const panel_frame_t* acquire() {
+        uint8_t current = state.load(std::memory_order_acquire);
+        while (current & FRESH) {
+            const uint8_t next = (current & FRONT) | READING;
+            if (state.compare_exchange_weak(current, next, std::memory_order_acq_rel)) {
+                return &frames[current & FRONT];
+            }
+        }
+        return NULL;
+    }
+
+    void release() {
+        state.fetch_and((uint8_t) ~READING, std::memory_order_release);
+    }
+
+    bool hasFresh() const {
+        return state.load(std::memory_order_acquire) & FRESH;
+    }
+
+    // Diagnostics. Frames replaced before the consumer took them.
+    uint32_t superseded = 0;
+
+    private:
+    static const uint8_t FRONT = 1;     // Index of the newest frame.
+    static const uint8_t FRESH = 2;     // The consumer hasn't taken it.
+    static const uint8_t READING = 4;   // The consumer is taking it.
+    panel_frame_t frames[2];
+    std::atomic<uint8_t> state{0};
+};
+
+// Touchscreen presses, read on the render task and taken by the loop.
+// Each new press is posted with its raw position, packed with a sequence
+// number into one atomic word; the loop takes each press once. A press
+// not taken before the next is replaced by it.
+class PanelTouchMailbox {
+    public:
+    // Render task. Whether the touchscreen is pressed, and where.
+    void post(bool pressed, int xRaw, int yRaw) {
+        if (pressed && !wasPressed) {
+            sequence++;
+            latest.store(((uint32_t) sequence << 24) | ((xRaw & 0xFFF) << 12) | (yRaw & 0xFFF),
+                std::memory_order_release);
+        }
+        wasPressed = pressed;
+    }
+
+    // Loop. true, with its raw position, if there was a press since the
+    // last call.
+    bool take(int &xRaw, int &yRaw) {
+        const uint32_t press = latest.load(std::memory_order_acquire);
+        const uint8_t pressSequence = press >> 24;
+        if (pressSequence == taken) {
+            return false;
+        }
+        taken = pressSequence;
+        xRaw = (press >> 12) & 0xFFF;
+        yRaw = press & 0xFFF;
+        return true;
+    }
+
+    private:
+    std::atomic<uint32_t> latest{0};
+    // Render task.
+    uint8_t sequence = 0;
+    bool wasPressed = false;
+    // Loop.
+    uint8_t taken = 0;
+};
+
+class PanelRenderTask {
+    public:
+    // Diagnostics, since the last takeReport(). Frames drawn by the render
+    // task, the time drawing them and from publish() to drawn.
+    std::atomic<uint32_t> framesRendered{0};
+    std::atomic<uint32_t> renderMicros{0};
+    std::atomic<uint32_t> latencyMicros{0};
+    // The last report: frames drawn per hour, the time drawing them as ms
+    // per hour, and the average ms from publish() to drawn (NAN with no
+    // frames).
+    float reportFramesPerHour = 0;
+    float reportRenderMsPerHour = 0;
+    float reportLatencyMs = NAN;
+    // Presses of the touchInput given to begin().
+    PanelTouchMailbox touches;
+
+    /**
+     * Start the render task. render draws the panels (and writes them to
+     * the display); it runs on the render task. If touchInput_ is given,
+     * the render task reads it too (see PanelTouchInput).
+     */
+    void begin(std::function<void(std::vector<DisplayPanel*> &)> render_, PanelTouchInput* touchInput_ = NULL) {
+        render = render_;
+        touchInput = touchInput_;
+        panelStore.reserve(PANEL_RENDER_MAX_PANELS);
+        for (int i = 0; i < PANEL_RENDER_MAX_PANELS; i++) {
+            panelStore.emplace_back(0, 0, 0, 0);
+            panelStore.back().text.reserve(PANEL_TEXT_LINES);
+        }
+        renderPanels.reserve(PANEL_RENDER_MAX_PANELS);
+        reportStartMs = millis();
+#ifdef ARDUINO
+        xTaskCreatePinnedToCore(taskMain, "panels", PANEL_RENDER_TASK_STACK, this,
+            PANEL_RENDER_TASK_PRIORITY, &task, PANEL_RENDER_TASK_CORE);
+#else
+        thread = std::thread(taskMain, this);
+#endif
+    }
+
+    /**
+     * On the loop: hand the panels, as they are now, to the render task.
+     * Returns false if it couldn't this time (the render task was taking
+     * the last frame); publish again shortly.
+     */
+    bool publish(std::vector<DisplayPanel*> &panels) {
+        panel_frame_t &frame = buffer.back();
+        frame.count = std::min((int) panels.size(), PANEL_RENDER_MAX_PANELS);
+        for (int i = 0; i < frame.count; i++) {
+            const DisplayPanel* panel = panels[i];
+            panel_model_t &model = frame.panels[i];
+            model.name = panel->name.c_str();
+            model.x = panel->x;
+            model.y = panel->y;
+            model.w = panel->w;
+            model.h = panel->h;
+            model.enabled = panel->enabled;
+            model.drawPanelOutline = panel->drawPanelOutline;
+            model.color = panel->color;
+            model.textColor = panel->textColor;
+            model.font = panel->font;
+            model.image = panel->image;
+            model.fontVertOffset = panel->fontVertOffset;
+            model.fontHeightOffset = panel->fontHeightOffset;
+            model.text.assign(panel->text);
+        }
+        frame.publishedUs = micros();
+        if (!buffer.publish()) {
+            return false;
+        }
+        wake();
+        return true;
+    }
+
+    // Nothing waiting to be drawn, and not drawing.
+    bool idle() const {
+        return !buffer.hasFresh() && !rendering.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Scale the counts since the last report to an hour into the report
+     * fields, and start counting again. On the loop.
+     */
+    void takeReport() {
+        const uint32_t now = millis();
+        const float hours = (now - reportStartMs) / 3600000.0f;
+        const uint32_t frames = framesRendered.exchange(0);
+        const uint32_t renderTime = renderMicros.exchange(0);
+        const uint32_t latency = latencyMicros.exchange(0);
+        reportFramesPerHour = hours > 0 ? frames / hours : 0;
+        reportRenderMsPerHour = hours > 0 ? renderTime / 1000.0f / hours : 0;
+        reportLatencyMs = frames == 0 ? NAN : latency / 1000.0f / frames;
+        reportStartMs = now;
+    }
+
+#ifndef ARDUINO
+    // Stop the render thread (the host only).
+    void end() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopping = true;
+            woken = true;
+        }
+        wakeCondition.notify_one();
+        thread.join();
+    }
+#endif
+
+    private:
+    PanelFrameBuffer buffer;
+    std::function<void(std::vector<DisplayPanel*> &)> render;
+    // The render task's panels, and the ones in this frame.
+    std::vector<DisplayPanel> panelStore;
+    std::vector<DisplayPanel*> renderPanels;
+    std::atomic<bool> rendering{false};
+    uint32_t reportStartMs = 0;
+    PanelTouchInput* touchInput = NULL;
+    uint32_t lastTouchMs = 0;
+#ifdef ARDUINO
+    TaskHandle_t task = NULL;
+#else
+    std::thread thread;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool woken = false;
+    bool stopping = false;
+#endif
+
+    void wake() {
+#ifdef ARDUINO
+        xTaskNotifyGive(task);
+#else
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            woken = true;
+        }
+        wakeCondition.notify_one();
+#endif
+    }
+
+    // Wait to be woken, or until the touchscreen is due. false when the
+    // task should stop.
+    bool wait() {
+#ifdef ARDUINO
+        ulTaskNotifyTake(pdTRUE, touchInput != NULL ? pdMS_TO_TICKS(PANEL_RENDER_TOUCH_MS) : portMAX_DELAY);
+        return true;
+#else
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (touchInput != NULL) {
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(PANEL_RENDER_TOUCH_MS), [this]() { return woken; });
+        }
+        else {
+            wakeCondition.wait(lock, [this]() { return woken; });
+        }
+        woken = false;
+        return !stopping;
+#endif
+    }
+
+    static void taskMain(void* self) {
+        ((PanelRenderTask*) self)->run();
+    }
+
+    void run() {
+        while (wait()) {
+            rendering = true;
+            const panel_frame_t* frame;
+            while ((frame = buffer.acquire()) != NULL) {
+                const uint32_t publishedUs = frame->publishedUs;
+                applyFrame(*frame);
+                buffer.release();
+
+                const uint32_t start = micros();
+                render(renderPanels);
+                const uint32_t end = micros();
+                renderMicros += end - start;
+                latencyMicros += end - publishedUs;
+                framesRendered++;
+                pollTouch();
+            }
+            rendering = false;
+            pollTouch();
+        }
+    }
+
+    // Read the touchscreen, if it is due.
+    void pollTouch() {
+        const uint32_t now = millis();
+        if (touchInput == NULL || now - lastTouchMs < PANEL_RENDER_TOUCH_MS) {
+            return;
+        }
+        lastTouchMs = now;
+        int xRaw = 0;
+        int yRaw = 0;
+        const bool pressed = touchInput->read(xRaw, yRaw);
+        touches.post(pressed, xRaw, yRaw);
+    }
+
+    // Set the render task's panels to a frame.
+    void applyFrame(const panel_frame_t &frame) {
+        renderPanels.clear();
+        for (int i = 0; i < frame.count; i++) {
+            const panel_model_t &model = frame.panels[i];
+            DisplayPanel &panel = panelStore[i];
+            panel.name = model.name;
+            panel.x = model.x;
+            panel.y = model.y;
+            panel.w = model.w;
+            panel.h = model.h;
+            panel.enabled = model.enabled;
+            panel.touchable = false;
+            panel.drawPanelOutline = model.drawPanelOutline;
+            panel.color = model.color;
+            panel.textColor = model.textColor;
+            panel.font = model.font;
+            panel.image = model.image;
+            panel.fontVertOffset = model.fontVertOffset;
+            panel.fontHeightOffset = model.fontHeightOffset;
+            model.text.applyTo(panel);
+            renderPanels.push_back(&panel);
+        }
+    }
+};
+
+#endif  // PANEL_RENDER_TASK_H
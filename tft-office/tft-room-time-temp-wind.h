@@ -1,6 +1,24 @@
-#include <sstream>
+#include <stdarg.h>
 #include <display-panel.h>
 // #include "display-panel-dev.h"
+#include "panel-damage.h"
+#include "panel-text.h"
+#include "panel-layout.h"
+#include "frame-scheduler.h"
+#include "time-snapshot.h"
+#include "panel-qoi-image.h"
+#include "butterfly-qoi.h"
+#include "alloc-count.h"
+#ifdef PANEL_BAND_RENDERING
+#include "panel-band.h"
+#include "ili9341-spi.h"
+#endif
+#ifdef PANEL_RENDER_TASK
+#ifndef PANEL_BAND_RENDERING
+#error "PANEL_RENDER_TASK writes the bands to the display itself; it needs PANEL_BAND_RENDERING"
+#endif
+#include "panel-render-task.h"
+#endif
 
 // The current page number. This device only has one page.
 int pageNumber = 0;
@@ -11,56 +29,115 @@ DisplayPanel* lastTouchedPanel = NULL;
 // The display/lcd we are working with. Defined in initializePanels().
 esphome::display::Display* lcd = NULL;
 
-// For sprintf calls.
-char buffer[25];
-
 // Size of the actual display
 #define WIDTH 320
 #define HEIGHT 240
-// Convert percentage width or height (0-100) to pixels
-#define PW(PCT_WIDTH) (PCT_WIDTH * 0.01 * WIDTH)
-#define PH(PCT_HEIGHT) (PCT_HEIGHT * 0.01 * HEIGHT)
-
-// Size information about the panels
-// Size for PW(x), PH(x) are percentages, 0-100.
-#define CONT_WIDTH PW(15)
-#define CONT_HEIGHT PH(25)
-
-#define DAY_WIDTH PW(70)
-#define DAY_HEIGHT PH(13)
-#define DATE_WIDTH PW(70)
-#define DATE_HEIGHT PH(12)
-
-#define TIME_WIDTH PW(100)
-#define TIME_HEIGHT PH(40)
-
-#define TEMP_WIDTH PW(50)
-#define TEMP_HEIGHT PH(27)
-#define TEMP_LABEL_WIDTH PW(50)
-#define TEMP_LABEL_HEIGHT PH(8)
-
-#define FLASH_WIDTH PW(90)
-#define FLASH_HEIGHT PH(50)
-#define FLASH_X PW(5)
-#define FLASH_Y PH(20)
-
-// The Panels used by this app
-// X, Y, W, H
-DisplayPanel contDownPanel(0, 0, CONT_WIDTH, CONT_HEIGHT);
-DisplayPanel datePanel(CONT_WIDTH, 0, DATE_WIDTH, DATE_HEIGHT);
-DisplayPanel dayPanel(CONT_WIDTH, DATE_HEIGHT, DAY_WIDTH, DAY_HEIGHT);
-DisplayPanel contUpPanel(PW(85), 0, CONT_WIDTH, CONT_HEIGHT);
 
-DisplayPanel timePanel(0, CONT_HEIGHT, TIME_WIDTH, TIME_HEIGHT);
+// The panels placed by the layouts below, in their order.
+enum layout_panel_t {
+    CONT_DOWN_PANEL,
+    DATE_PANEL,
+    DAY_PANEL,
+    CONT_UP_PANEL,
+    TIME_PANEL,
+    INSIDE_TEMP_PANEL,
+    INSIDE_LABEL_PANEL,
+    OUTDOOR_TEMP_PANEL,
+    OUTDOOR_LABEL_PANEL,
+    LAYOUT_PANELS,
+};
 
-DisplayPanel insideTempPanel(0, CONT_HEIGHT + TIME_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT);
-DisplayPanel insideLabelPanel(0, CONT_HEIGHT + TIME_HEIGHT +  TEMP_HEIGHT, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT);
-DisplayPanel outdoorTempPanel(TEMP_WIDTH, CONT_HEIGHT + TIME_HEIGHT, TEMP_WIDTH, TEMP_HEIGHT);
-DisplayPanel outdoorLabelPanel(TEMP_WIDTH, CONT_HEIGHT + TIME_HEIGHT +  TEMP_HEIGHT, TEMP_LABEL_WIDTH, TEMP_LABEL_HEIGHT);
+// Where the panels go, resolved at compile time. See panel-layout.h.
+// layoutCell() params are percentages (0-100) of the screen: X, Y, W, H.
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_TEMPS = {{
+    layoutCell(WIDTH, HEIGHT, 0, 0, 15, 25),    // contDownPanel
+    layoutCell(WIDTH, HEIGHT, 15, 0, 70, 12),   // datePanel
+    layoutCell(WIDTH, HEIGHT, 15, 12, 70, 13),  // dayPanel
+    layoutCell(WIDTH, HEIGHT, 85, 0, 15, 25),   // contUpPanel
+    layoutCell(WIDTH, HEIGHT, 0, 25, 100, 40),  // timePanel
+    layoutCell(WIDTH, HEIGHT, 0, 65, 50, 27),   // insideTempPanel
+    layoutCell(WIDTH, HEIGHT, 0, 92, 50, 8),    // insideLabelPanel
+    layoutCell(WIDTH, HEIGHT, 50, 65, 50, 27),  // outdoorTempPanel
+    layoutCell(WIDTH, HEIGHT, 50, 92, 50, 8),   // outdoorLabelPanel
+}};
+
+// If we don't have a temperature state, just show time.
+constexpr panel_layout_t<LAYOUT_PANELS> LAYOUT_TIME_ONLY = {{
+    layoutCell(WIDTH, HEIGHT, 0, 0, 15, 25),    // contDownPanel
+    layoutCell(WIDTH, HEIGHT, 15, 0, 70, 12),   // datePanel
+    layoutCell(WIDTH, HEIGHT, 15, 12, 70, 13),  // dayPanel
+    layoutCell(WIDTH, HEIGHT, 85, 0, 15, 25),   // contUpPanel
+    layoutCell(WIDTH, HEIGHT, 0, 25, 100, 40),  // timePanel
+    LAYOUT_HIDDEN,                              // insideTempPanel
+    LAYOUT_HIDDEN,                              // insideLabelPanel
+    LAYOUT_HIDDEN,                              // outdoorTempPanel
+    LAYOUT_HIDDEN,                              // outdoorLabelPanel
+}};
+
+constexpr layout_rect_t FLASH_RECT = layoutCell(WIDTH, HEIGHT, 5, 20, 90, 50);
+
+// The Panels used by this app, placed by applyLayout() in initializePanels()
+DisplayPanel contDownPanel(0, 0, 0, 0);
+DisplayPanel datePanel(0, 0, 0, 0);
+DisplayPanel dayPanel(0, 0, 0, 0);
+DisplayPanel contUpPanel(0, 0, 0, 0);
+
+DisplayPanel timePanel(0, 0, 0, 0);
+
+DisplayPanel insideTempPanel(0, 0, 0, 0);
+DisplayPanel insideLabelPanel(0, 0, 0, 0);
+DisplayPanel outdoorTempPanel(0, 0, 0, 0);
+DisplayPanel outdoorLabelPanel(0, 0, 0, 0);
 
+// X, Y, W, H
 DisplayPanel butterflyPanel(0, 0, 200, 200);
-
-DisplayPanel flashPanel(FLASH_X, FLASH_Y, FLASH_WIDTH, FLASH_HEIGHT);
+// images/butterfly.png, compressed. See panel-qoi-image.h.
+PanelQoiImage butterflyImage(BUTTERFLY_QOI, sizeof(BUTTERFLY_QOI), BUTTERFLY_QOI_WIDTH, BUTTERFLY_QOI_HEIGHT);
+
+DisplayPanel flashPanel(FLASH_RECT.x, FLASH_RECT.y, FLASH_RECT.w, FLASH_RECT.h);
+
+// The panels the layouts place, in layout_panel_t order.
+std::array<DisplayPanel*, LAYOUT_PANELS> layoutPanels = {{
+    &contDownPanel,
+    &datePanel,
+    &dayPanel,
+    &contUpPanel,
+    &timePanel,
+    &insideTempPanel,
+    &insideLabelPanel,
+    &outdoorTempPanel,
+    &outdoorLabelPanel,
+}};
+
+// Renders a frame only when the screen can change. See frame-scheduler.h.
+FrameScheduler frameScheduler;
+// Redraws only the panels that changed. See panel-damage.h.
+PanelDamage panelDamage;
+// Rendered panels, so unchanged text is blitted rather than re-rasterized.
+PanelBitmapCache panelBitmapCache;
+
+#ifdef PANEL_BAND_RENDERING
+// Low-RAM rendering (tft-office-low-ram.yaml): no ili9xxx display and its
+// screen buffer, the panels are drawn a band at a time. See panel-band.h.
+PanelBands panelBands(WIDTH, HEIGHT);
+#ifdef ARDUINO
+// Same wiring as the ili9xxx display in tft-office.yaml.
+Ili9341Spi lcdSpi(18, 19, 23, 33, 5, 16, 40000000);
+// The touchscreen, on lcdSpi's bus. Same pin and threshold as touchscreen:
+// in tft-office.yaml. See takeTouch().
+Xpt2046Spi touchSpi(32, 400);
+#endif
+#endif
+#ifdef PANEL_RENDER_TASK
+// Draws the panels and writes the bands on the other core, and reads the
+// touchscreen between frames. See panel-render-task.h.
+PanelRenderTask panelRenderTask;
+#ifdef ARDUINO
+PanelTouchInput* panelTouchInput = &touchSpi;
+#else
+PanelTouchInput* panelTouchInput = NULL;
+#endif
+#endif
 
 std::vector<std::vector<DisplayPanel*>> pages = {
     {
@@ -87,9 +164,38 @@ std::vector<std::string> outdoorLabelText = {"outside"};
 
 std::vector<std::string> blankText = {};
 
+// Set by the state callbacks registered in initializePanels() when
+// an input of a panel changes. The panel text is only rebuilt then,
+// so most frames do no string work at all.
+bool windChanged = true;
+bool temperatureChanged = true;
+// The clock, sampled once per frame. The time and day panels are
+// rebuilt when its minute changes.
+TimeSnapshot timeSnapshot;
+
+// Diagnostics. Panel text rebuilds, and C++ allocations made by
+// updatePanelStates(), over updateFrames frames.
+uint32_t textRebuilds = 0;
+uint32_t updateAllocations = 0;
+uint32_t updateFrames = 0;
+
+// Register for changes to the inputs of the panels, and render a frame
+// when one changes.
+void watchPanelInputs() {
+    wind_speed->add_on_state_callback([](float) { windChanged = true; frameScheduler.requestFrame(); });
+    wind_gust_speed->add_on_state_callback([](float) { windChanged = true; frameScheduler.requestFrame(); });
+    wind_direction->add_on_state_callback([](std::string) { windChanged = true; frameScheduler.requestFrame(); });
+    inside_temperature->add_on_state_callback([](float) { temperatureChanged = true; frameScheduler.requestFrame(); });
+    back_yard_temperature->add_on_state_callback([](float) { temperatureChanged = true; frameScheduler.requestFrame(); });
+}
+
 // One time, initialize the Panels
 void initializePanels(esphome::display::Display &display) {
     lcd = &display;
+    panelDamage.bitmapCache = &panelBitmapCache;
+    applyLayout(layoutPanels, LAYOUT_TIME_ONLY);
+    PanelText::reserve(pages[pageNumber]);
+    flashPanel.text.reserve(PANEL_TEXT_LINES);
 
     timePanel.font = font_time;
     timePanel.color = Color::BLACK;
@@ -98,11 +204,13 @@ void initializePanels(esphome::display::Display &display) {
     timePanel.touchable = true;
     timePanel.name = "timePanel";
 
+    dayPanel.name = "dayPanel";
     dayPanel.font = font_day;
     dayPanel.color = Color::BLACK;
     dayPanel.textColor = color_text_white;
     dayPanel.touchable = false;
 
+    datePanel.name = "datePanel";
     datePanel.font = font_date;
     datePanel.color = Color::BLACK;
     datePanel.textColor = color_text_white;
@@ -122,38 +230,44 @@ void initializePanels(esphome::display::Display &display) {
     contDownPanel.name = "contDownPanel";
     contDownPanel.tag = contDownPanel.name + " tag";
 
+    insideTempPanel.name = "insideTempPanel";
     insideTempPanel.font = font_temp;
     insideTempPanel.color = Color::BLACK;
     insideTempPanel.textColor = color_text_white;
     insideTempPanel.fontVertOffset = 6;
     insideTempPanel.touchable = false;
 
+    insideLabelPanel.name = "insideLabelPanel";
     insideLabelPanel.font = font_temp_label;
     insideLabelPanel.color = Color::BLACK;
     insideLabelPanel.textColor = color_text_white;
     insideLabelPanel.text = insideLabelText;
     insideLabelPanel.touchable = false;
 
+    outdoorTempPanel.name = "outdoorTempPanel";
     outdoorTempPanel.font = font_temp;
     outdoorTempPanel.color = Color::BLACK;
     outdoorTempPanel.textColor = color_text_white;
     outdoorTempPanel.fontVertOffset = 6;
     outdoorTempPanel.touchable = false;
 
+    outdoorLabelPanel.name = "outdoorLabelPanel";
     outdoorLabelPanel.font = font_temp_label;
     outdoorLabelPanel.color = Color::BLACK;
     outdoorLabelPanel.textColor = color_text_white;
     outdoorLabelPanel.text = outdoorLabelText;
     outdoorLabelPanel.touchable = false;
 
+    butterflyPanel.name = "butterflyPanel";
     butterflyPanel.font = font_flash;
     butterflyPanel.color = color_text_white;;
     butterflyPanel.textColor = color_green;
-    butterflyPanel.image = butterfly_image;
+    butterflyPanel.image = &butterflyImage;
     butterflyPanel.enabled = false;   // Was just for testing.
     butterflyPanel.tag = "hello, baby";
     butterflyPanel.touchable = false;
 
+    flashPanel.name = "flashPanel";
     flashPanel.font = font_flash;
     flashPanel.color = Color::BLACK;
     flashPanel.textColor = color_text_white;
@@ -163,90 +277,199 @@ void initializePanels(esphome::display::Display &display) {
 
     // Restore brightness from the global
     backlight->set_level(brightness->value());
+
+    // Only rebuild panel text when its inputs change.
+    watchPanelInputs();
+
+    // Fill the screen the first time to have BLACK in any gaps in Panels.
+    display.fill(Color::BLACK);
+
+#if defined(PANEL_BAND_RENDERING) && defined(ARDUINO)
+    touchSpi.begin();
+#endif
+#ifdef PANEL_RENDER_TASK
+    // From here on, only the render task draws, or uses the bus.
+    panelRenderTask.begin([](std::vector<DisplayPanel*> &renderPanels) {
+        panelBands.draw(panelDamage, renderPanels);
+    }, panelTouchInput);
+#endif
 }
 
 // The time until which to display flash
 esphome::ESPTime flashUntil;
 
-// Enable the Flash message with some specific text
-void enableFlash(std::vector<std::string> flashText) {
+// Enable the Flash message with a title and a message,
+// formatted like printf.
+__attribute__((format(printf, 2, 3)))
+void enableFlash(const char* title, const char* format, ...) {
     flashUntil = esptime->now();
     flashUntil.increment_second();
     flashPanel.enabled = true;
-    flashPanel.text = flashText;
+    PanelText flashText;
+    flashText.add(title);
+    va_list args;
+    va_start(args, format);
+    flashText.vaddf(format, args);
+    va_end(args);
+    flashText.applyTo(flashPanel);
+    frameScheduler.requestFrame();
 }
 
-// Once per "frame", update the state of all of the panels.
+// Once per "frame", update the state of the panels whose inputs changed.
 // This does NOT draw.
 void updatePanelStates() {
-    // Time      
-    auto now = esptime->now();
-    int hour = now.hour;
-    int minute = now.minute;
-    bool is_pm = hour >= 12;
-    hour = hour == 0 ? 12 : 
-        hour > 12 ? hour - 12 : hour;
-
-    // Time
-    timePanel.text = { str_sprintf("%d:%02d", hour, minute) };
-
-    // Day of the week
-    dayPanel.text = { now.strftime("%a") + "/" + now.strftime("%b") + " " + std::to_string(now.day_of_month) };
+    PANEL_TIMING_FRAME_BEGIN();
+    PANEL_TIMING_START(updateStart);
+    const uint32_t allocationsBefore = allocationCount;
+
+    // Time and day, when the minute rolls over (or the clock is set).
+    if (timeSnapshot.tick(esptime->now())) {
+        // Time
+        PanelText timeText;
+        timeText.add(timeSnapshot.hourMinute).applyTo(timePanel);
+
+        // Day of the week
+        PanelText dayText;
+        dayText.addf("%s/%s %s", timeSnapshot.dayName, timeSnapshot.monthName, timeSnapshot.dayOfMonth)
+            .applyTo(dayPanel);
+        textRebuilds += 2;
+    }
 
     // Wind speed, gust, and direction
-    if (wind_speed->has_state() && wind_speed->state < 200) {
-        std::stringstream ss;
-        ss << "Wind " << value_accuracy_to_string(wind_speed->state, 0);
-        if (wind_gust_speed->has_state()) {
-            ss << "+";
+    if (windChanged) {
+        windChanged = false;
+        if (wind_speed->has_state() && wind_speed->state < 200) {
+            PanelText windText;
+            windText.addf("Wind %.0f", wind_speed->state);
+            if (wind_gust_speed->has_state()) {
+                windText.appendf("+");
+            }
+            if (wind_direction->has_state()) {
+                windText.appendf(" %s", wind_direction->state.c_str());
+            }
+            windText.applyTo(datePanel);
+            textRebuilds++;
         }
-        if (wind_direction->has_state()) {
-            ss << " " << wind_direction->state.c_str();
-        }
-        datePanel.text = { ss.str() };
     }
 
-    if (back_yard_temperature->has_state() || inside_temperature->has_state()) {
-        insideLabelPanel.enabled = true;
-        insideTempPanel.enabled = true;
-        outdoorLabelPanel.enabled = true;
-        outdoorTempPanel.enabled = true;
-        if (inside_temperature->has_state()) {
-            // Temperature
-            insideTempPanel.text = { str_sprintf("%.0f°", inside_temperature->state) };
+    if (temperatureChanged) {
+        temperatureChanged = false;
+        if (back_yard_temperature->has_state() || inside_temperature->has_state()) {
+            applyLayout(layoutPanels, LAYOUT_TIME_TEMPS);
+            if (inside_temperature->has_state()) {
+                // Temperature
+                PanelText tempText;
+                tempText.addf("%.0f°", inside_temperature->state).applyTo(insideTempPanel);
+                textRebuilds++;
+            }
+            if (back_yard_temperature->has_state()) {
+                // Temperature
+                PanelText tempText;
+                tempText.addf("%.0f°", back_yard_temperature->state).applyTo(outdoorTempPanel);
+                textRebuilds++;
+            }
         }
-        if (back_yard_temperature->has_state()) {
-            // Temperature
-            outdoorTempPanel.text = { str_sprintf("%.0f°", back_yard_temperature->state) };
+        else {
+            applyLayout(layoutPanels, LAYOUT_TIME_ONLY);
         }
     }
-    else {
-        // If we don't have a temperature state, just show time.
-        insideLabelPanel.enabled = false;
-        insideTempPanel.enabled = false;
-        outdoorLabelPanel.enabled = false;
-        outdoorTempPanel.enabled = false;
-    }
 
-    if (flashPanel.enabled && now > flashUntil) {
+    if (flashPanel.enabled && timeSnapshot.now > flashUntil) {
         flashPanel.enabled = false;
     }
+
+    updateAllocations += allocationCount - allocationsBefore;
+    updateFrames++;
+    PANEL_TIMING_PHASE(PANEL_PHASE_UPDATE, updateStart);
 }
 
-// Draw all of the panels
+// Ask for the next frame when the screen will next change on its own:
+// the minute rolling over, or the flash panel expiring.
+void scheduleNextFrame() {
+    uint32_t ms = timeSnapshot.secondsToNextMinute() * 1000;
+    if (flashPanel.enabled) {
+        // It is disabled once now > flashUntil.
+        const uint32_t flashMs = (flashUntil.timestamp + 1 - timeSnapshot.now.timestamp) * 1000;
+        ms = flashMs < ms ? flashMs : ms;
+    }
+    frameScheduler.frameIn(ms);
+}
+
+// The panels of the current page followed by flashPanel,
+// so it over-draws what is below it.
+std::vector<DisplayPanel*> drawOrder;
+
+// Draw the panels that changed since the last frame
 void drawPanels() {
-    // drawAllPanels is generally preferred
-    DisplayPanel::drawAllPanels(*lcd, pages[pageNumber]);
-    // But draw flashPanel separately so it over-draws
-    // what is below it.
-    flashPanel.draw(*lcd);
+    if (drawOrder.empty()) {
+        drawOrder = pages[pageNumber];
+        drawOrder.push_back(&flashPanel);
+    }
+#if defined(PANEL_RENDER_TASK)
+    const bool published = panelRenderTask.publish(drawOrder);
+#elif defined(PANEL_BAND_RENDERING)
+    panelBands.draw(panelDamage, drawOrder);
+#else
+    panelDamage.draw(*lcd, drawOrder);
+#endif
+    PANEL_TIMING_FRAME_END();
+    scheduleNextFrame();
+#ifdef PANEL_RENDER_TASK
+    if (!published) {
+        frameScheduler.frameIn(PANEL_RENDER_RETRY_MS);
+    }
+#endif
 }
 
 // See if one of the enabled, touchable panels on the
 // current page has been touched.
 // lastTouchedPanel will be set to a pointer to the
 // touched panel (or NULL of no panel was found for the coordinates).
+// A hit starts timing the touch, until frameScheduler has drawn what the
+// touch handler changed (see frame-scheduler.h).
 boolean isPanelTouched(int tpX, int tpY) {
+    const uint32_t touchUs = micros();
     lastTouchedPanel = DisplayPanel::touchedPanel(pages[pageNumber], tpX, tpY);
+    if (lastTouchedPanel != NULL) {
+        frameScheduler.touchedAt(touchUs);
+    }
     return lastTouchedPanel != NULL;
 }
+
+#ifdef PANEL_BAND_RENDERING
+// Without a display there is no touchscreen component to map touches to
+// the screen. Map the raw xpt2046 values with the calibration from
+// touchscreen: in tft-office.yaml (the max is below the min for a reversed
+// axis).
+#define TOUCH_X_MIN (426)
+#define TOUCH_X_MAX (3771)
+#define TOUCH_Y_MIN (3845)
+#define TOUCH_Y_MAX (471)
+
+int touchToScreenX(int xRaw) {
+    const int x = (xRaw - TOUCH_X_MIN) * WIDTH / (TOUCH_X_MAX - TOUCH_X_MIN);
+    return std::min(std::max(x, 0), WIDTH - 1);
+}
+
+int touchToScreenY(int yRaw) {
+    const int y = (yRaw - TOUCH_Y_MIN) * HEIGHT / (TOUCH_Y_MAX - TOUCH_Y_MIN);
+    return std::min(std::max(y, 0), HEIGHT - 1);
+}
+
+#ifdef ARDUINO
+// A new press of the touchscreen since the last call, with its raw
+// position. The render task reads it between frames; otherwise it is read
+// here, on the loop that writes the bands.
+bool takeTouch(int &xRaw, int &yRaw) {
+#ifdef PANEL_RENDER_TASK
+    return panelRenderTask.touches.take(xRaw, yRaw);
+#else
+    static bool wasPressed = false;
+    const bool pressed = touchSpi.read(xRaw, yRaw);
+    const bool newPress = pressed && !wasPressed;
+    wasPressed = pressed;
+    return newPress;
+#endif
+}
+#endif
+#endif